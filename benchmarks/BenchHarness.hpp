@@ -0,0 +1,40 @@
+/**
+ * @file BenchHarness.hpp
+ * @brief 基准测试的公共工具：计时、防止结果被优化掉
+ *
+ * 基准测试都是独立的可执行文件（不参与游戏构建），在项目根目录运行，结果以表格形式输出到控制台。
+ */
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+namespace bench {
+
+/**
+ * @brief 重复运行 fn，返回单次耗时的中位数（毫秒）
+ * @param repeats 重复次数（至少 1 次）
+ * @param fn 被测函数
+ */
+template <typename Fn>
+double measureMs(int repeats, Fn&& fn) {
+    std::vector<double> samples;
+    samples.reserve(static_cast<size_t>(std::max(repeats, 1)));
+    for (int i = 0; i < std::max(repeats, 1); ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        fn();
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        samples.push_back(elapsed.count());
+    }
+    std::nth_element(samples.begin(), samples.begin() + samples.size() / 2, samples.end());
+    return samples[samples.size() / 2];
+}
+
+/// @brief 把结果写入 volatile 变量，防止编译器把被测代码整个优化掉
+inline void keep(size_t value) {
+    static volatile size_t sink = 0;
+    sink = sink + value;
+}
+
+} // namespace bench
@@ -0,0 +1,94 @@
+/**
+ * @file BroadphaseBench.cpp
+ * @brief 物体间碰撞粗检测的基准测试：空间哈希 (SpatialHash) 与原先的两层循环对比
+ *
+ * 物体数量从 100 到 10000，世界面积随物体数量增长（密度不变，与关卡中的敌人、道具分布相近）。
+ * 两种方法使用同一个 AABB 精确检测，并核对输出的碰撞对完全一致。
+ *
+ * 用法（在项目根目录运行）：
+ *     BroadphaseBench [网格尺寸，默认 64]
+ */
+#include "BenchHarness.hpp"
+#include "../src/engine/physics/SpatialHash.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using Pair = std::pair<std::uint32_t, std::uint32_t>;
+
+/// @brief 与 collision::checkAABBOverlap 相同的判断（边界接触不算重叠）
+bool overlaps(const engine::utils::Rect& a, const engine::utils::Rect& b) {
+    return a.position.x < b.position.x + b.size.x && a.position.x + a.size.x > b.position.x &&
+           a.position.y < b.position.y + b.size.y && a.position.y + a.size.y > b.position.y;
+}
+
+/// @brief 生成 count 个 8~48 像素的物体，平均每个物体占 64x64 像素的面积
+std::vector<engine::utils::Rect> makeBodies(size_t count) {
+    std::mt19937 rng(12345);
+    const float worldSize = std::sqrt(static_cast<float>(count)) * 64.0f;
+    std::uniform_real_distribution<float> position(0.0f, worldSize);
+    std::uniform_real_distribution<float> size(8.0f, 48.0f);
+    std::vector<engine::utils::Rect> bodies;
+    bodies.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        bodies.emplace_back(glm::vec2(position(rng), position(rng)), glm::vec2(size(rng), size(rng)));
+    }
+    return bodies;
+}
+
+/// @brief 原先的做法：两层循环检测所有物体对
+void bruteForce(const std::vector<engine::utils::Rect>& bodies, std::vector<Pair>& out) {
+    out.clear();
+    for (size_t i = 0; i < bodies.size(); ++i) {
+        for (size_t j = i + 1; j < bodies.size(); ++j) {
+            if (overlaps(bodies[i], bodies[j])) out.emplace_back(static_cast<std::uint32_t>(i), static_cast<std::uint32_t>(j));
+        }
+    }
+}
+
+/// @brief PhysicsEngine::checkObjectCollisions 的做法：每步重建网格，只检测共享网格的候选对
+void spatialHash(engine::physics::SpatialHash& hash, const std::vector<engine::utils::Rect>& bodies, std::vector<Pair>& out) {
+    out.clear();
+    hash.clear();
+    for (size_t i = 0; i < bodies.size(); ++i) {
+        hash.insert(static_cast<std::uint32_t>(i), bodies[i]);
+    }
+    for (const auto& [i, j] : hash.computePairs()) {
+        if (overlaps(bodies[i], bodies[j])) out.emplace_back(i, j);
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const float cellSize = argc > 1 ? static_cast<float>(std::atof(argv[1])) : 64.0f;
+    engine::physics::SpatialHash hash(cellSize);
+    std::vector<Pair> expected;
+    std::vector<Pair> actual;
+
+    spdlog::info("BROADPHASEBENCH::网格尺寸 {} 像素，每项取中位数", hash.getCellSize());
+    spdlog::info("BROADPHASEBENCH::{:>8} {:>10} {:>14} {:>14} {:>8}", "物体数", "碰撞对", "两层循环(ms)", "空间哈希(ms)", "加速比");
+    bool isAllMatched = true;
+    for (size_t count : {100, 250, 500, 1000, 2500, 5000, 10000}) {
+        const auto bodies = makeBodies(count);
+        // 两层循环在 10000 个物体时每次约数百毫秒，按规模减少重复次数
+        const int repeats = count <= 1000 ? 20 : (count <= 5000 ? 5 : 3);
+        const double bruteMs = bench::measureMs(repeats, [&] { bruteForce(bodies, expected); });
+        const double hashMs = bench::measureMs(repeats * 5, [&] { spatialHash(hash, bodies, actual); });
+        bench::keep(expected.size() + actual.size());
+
+        const bool isMatched = expected == actual;
+        isAllMatched = isAllMatched && isMatched;
+        spdlog::info("BROADPHASEBENCH::{:>8} {:>10} {:>14.3f} {:>14.3f} {:>7.1f}x{}", count, expected.size(), bruteMs, hashMs,
+                     bruteMs / hashMs, isMatched ? "" : "  输出不一致!");
+    }
+    return isAllMatched ? 0 : 1;
+}
@@ -0,0 +1,130 @@
+/**
+ * @file JobSystemBench.cpp
+ * @brief 任务系统的基准测试：任务调度开销、并行 for，以及后台解码 (ImageDecoder) 与顺序解码对比
+ *
+ * - 调度开销：提交 N 个空任务并等待完成，得到每个任务的平均开销
+ * - 并行 for：对同一数组做逐元素计算，与单线程循环对比
+ * - 图片解码：assets 下所有 .png，主线程依次 IMG_Load（原先 TextureManager 的加载方式）
+ *   与 ImageDecoder 在工作线程并行解码、主线程 poll 取出结果对比（都不包括上传纹理）
+ *
+ * 用法（在项目根目录运行）：
+ *     JobSystemBench [工作线程数，默认 CPU 核心数 - 1]
+ */
+#include "BenchHarness.hpp"
+#include "../src/engine/core/JobSystem.hpp"
+#include "../src/engine/resource/ImageDecoder.hpp"
+
+#include <SDL3/SDL_surface.h>
+#include <SDL3_image/SDL_image.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+const char* const ASSET_DIR = "assets";
+
+/// @brief 收集目录（递归）中的所有 .png 文件
+std::vector<std::string> collectImages(const std::filesystem::path& dir) {
+    std::vector<std::string> images;
+    if (!std::filesystem::is_directory(dir)) {
+        spdlog::error("JOBSYSTEMBENCH::collectImages::目录不存在: {}", dir.string());
+        return images;
+    }
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(dir)) {
+        if (entry.is_regular_file() && entry.path().extension() == ".png") {
+            images.push_back(entry.path().generic_string());
+        }
+    }
+    std::sort(images.begin(), images.end());
+    return images;
+}
+
+/// @brief 逐元素计算（并行 for 的被测任务）
+void transform(std::vector<float>& data, size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+        data[i] = std::sqrt(data[i] * 1.0001f + 1.0f);
+    }
+}
+
+/// @brief 原先的做法：主线程依次解码
+size_t decodeSequential(const std::vector<std::string>& images) {
+    size_t decoded = 0;
+    for (const auto& path : images) {
+        engine::resource::ImageDecoder::SurfacePtr surface(IMG_Load(path.c_str()));
+        if (surface) ++decoded;
+    }
+    return decoded;
+}
+
+/// @brief ImageDecoder：全部提交后，主线程轮询取出结果（与 TextureManager 的用法相同）
+size_t decodeParallel(engine::core::JobSystem& jobSystem, const std::vector<std::string>& images) {
+    engine::resource::ImageDecoder decoder(jobSystem);
+    for (const auto& path : images) {
+        decoder.request(path);
+    }
+    size_t decoded = 0;
+    engine::resource::ImageDecoder::Result result;
+    while (decoder.getInFlightCount() > 0) {
+        if (!decoder.poll(result)) {
+            std::this_thread::yield();
+            continue;
+        }
+        if (result.surface) ++decoded;
+    }
+    return decoded;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    const size_t workerCount = argc > 1 ? static_cast<size_t>(std::atoi(argv[1])) : 0;
+    engine::core::JobSystem jobSystem(workerCount);
+    spdlog::info("JOBSYSTEMBENCH::工作线程 {} 个，每项取中位数", jobSystem.getWorkerCount());
+
+    // 1. 调度开销
+    for (size_t count : {1000, 10000, 100000}) {
+        const double ms = bench::measureMs(10, [&] {
+            engine::core::JobCounter counter;
+            for (size_t i = 0; i < count; ++i) {
+                jobSystem.schedule([] {}, &counter);
+            }
+            jobSystem.wait(counter);
+        });
+        spdlog::info("JOBSYSTEMBENCH::空任务 {:>7} 个: {:>9.3f} ms（每个 {:.3f} us）", count, ms, ms * 1000.0 / count);
+    }
+
+    // 2. 并行 for
+    std::vector<float> data(1 << 22, 1.0f);
+    const double serialMs = bench::measureMs(10, [&] { transform(data, 0, data.size()); });
+    const double parallelMs = bench::measureMs(10, [&] {
+        jobSystem.parallelFor(data.size(), 0, [&data](size_t begin, size_t end) { transform(data, begin, end); });
+    });
+    bench::keep(static_cast<size_t>(data[0]));
+    spdlog::info("JOBSYSTEMBENCH::并行 for ({} 个元素): 单线程 {:.3f} ms, 并行 {:.3f} ms, 加速比 {:.1f}x",
+                 data.size(), serialMs, parallelMs, serialMs / parallelMs);
+
+    // 3. 图片解码
+    const auto images = collectImages(ASSET_DIR);
+    if (images.empty()) {
+        spdlog::error("JOBSYSTEMBENCH::没有找到图片文件，请在项目根目录运行");
+        return 1;
+    }
+    size_t sequentialCount = 0;
+    size_t parallelCount = 0;
+    const double sequentialMs = bench::measureMs(5, [&] { sequentialCount = decodeSequential(images); });
+    const double decoderMs = bench::measureMs(5, [&] { parallelCount = decodeParallel(jobSystem, images); });
+    spdlog::info("JOBSYSTEMBENCH::解码 {} 张图片: 顺序 {:.3f} ms, ImageDecoder {:.3f} ms, 加速比 {:.1f}x",
+                 images.size(), sequentialMs, decoderMs, sequentialMs / decoderMs);
+    if (sequentialCount != images.size() || parallelCount != sequentialCount) {
+        spdlog::error("JOBSYSTEMBENCH::解码数量不一致: 顺序 {}, ImageDecoder {}, 共 {}", sequentialCount, parallelCount, images.size());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,104 @@
+/**
+ * @file LevelLoadBench.cpp
+ * @brief 关卡加载的基准测试：解析 Tiled 地图 (.tmj/.tsj) 与读取预处理关卡 (.lvlb) 对比
+ *
+ * 对每张地图分别计时：
+ * - JSON：LevelParser::parse（读取并解析 .tmj 与引用的 .tsj，按 gid 查表生成 LevelData）
+ * - 预处理：MappedFile 内存映射 + CookedLevel::load（包括源文件校验）
+ * 预处理文件写到临时目录，不修改 assets/maps。
+ *
+ * 用法（在项目根目录运行）：
+ *     LevelLoadBench [地图文件...]
+ * 未指定地图文件时，默认测试 assets/maps 下的所有 .tmj 文件。
+ */
+#include "BenchHarness.hpp"
+#include "../src/engine/scene/CookedLevel.hpp"
+#include "../src/engine/scene/LevelParser.hpp"
+#include "../src/engine/utils/MappedFile.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace {
+
+const char* const DEFAULT_MAP_DIR = "assets/maps";
+constexpr int REPEATS = 50;
+
+/// @brief 收集目录中的所有 .tmj 地图文件（路径相对于运行目录）
+std::vector<std::string> collectMaps(const std::filesystem::path& dir) {
+    std::vector<std::string> maps;
+    if (!std::filesystem::is_directory(dir)) {
+        spdlog::error("LEVELLOADBENCH::collectMaps::目录不存在: {}", dir.string());
+        return maps;
+    }
+    for (const auto& entry : std::filesystem::directory_iterator(dir)) {
+        if (entry.is_regular_file() && entry.path().extension() == ".tmj") {
+            maps.push_back(entry.path().generic_string());
+        }
+    }
+    std::sort(maps.begin(), maps.end());
+    return maps;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::vector<std::string> maps(argv + 1, argv + argc);
+    if (maps.empty()) {
+        maps = collectMaps(DEFAULT_MAP_DIR);
+    }
+    if (maps.empty()) {
+        spdlog::error("LEVELLOADBENCH::没有找到需要测试的地图文件");
+        return 1;
+    }
+
+    const auto tempDir = std::filesystem::temp_directory_path();
+    int failedCount = 0;
+    spdlog::info("LEVELLOADBENCH::每项重复 {} 次取中位数", REPEATS);
+    spdlog::info("LEVELLOADBENCH::{:<24} {:>12} {:>14} {:>12} {:>8}", "地图", "JSON(ms)", "预处理(ms)", "文件(KB)", "加速比");
+    for (const auto& mapPath : maps) {
+        spdlog::set_level(spdlog::level::warn);     // 解析过程的日志会影响计时，输出结果前再恢复
+        engine::scene::LevelData level;
+        engine::scene::LevelParser parser;
+        if (!parser.parse(mapPath, level)) {
+            spdlog::error("LEVELLOADBENCH::解析地图失败: {}", mapPath);
+            ++failedCount;
+            continue;
+        }
+        const auto cookedPath = (tempDir / std::filesystem::path(engine::scene::CookedLevel::getCookedPath(mapPath)).filename()).string();
+        if (!engine::scene::CookedLevel::save(level, cookedPath)) {
+            ++failedCount;
+            continue;
+        }
+
+        bool isOk = true;
+        const double jsonMs = bench::measureMs(REPEATS, [&] {
+            engine::scene::LevelData data;
+            engine::scene::LevelParser jsonParser;
+            isOk = jsonParser.parse(mapPath, data) && isOk;
+            bench::keep(data.layers.size());
+        });
+        const double cookedMs = bench::measureMs(REPEATS, [&] {
+            engine::scene::LevelData data;
+            engine::utils::MappedFile file;
+            isOk = file.open(cookedPath) && engine::scene::CookedLevel::load(file.getBytes(), data) && isOk;
+            bench::keep(data.layers.size());
+        });
+        spdlog::set_level(spdlog::level::info);
+        if (!isOk) {
+            spdlog::error("LEVELLOADBENCH::加载失败: {}", mapPath);
+            ++failedCount;
+        }
+
+        std::error_code ec;
+        const auto fileSize = std::filesystem::file_size(cookedPath, ec);
+        spdlog::info("LEVELLOADBENCH::{:<24} {:>12.3f} {:>14.3f} {:>12.1f} {:>7.1f}x",
+                     mapPath, jsonMs, cookedMs, fileSize / 1024.0, jsonMs / cookedMs);
+        std::filesystem::remove(cookedPath, ec);
+    }
+    return failedCount == 0 ? 0 : 1;
+}
@@ -0,0 +1,187 @@
+/**
+ * @file PhysicsQueryBench.cpp
+ * @brief 物理引擎空间查询的基准测试：overlapBox、queryRadius、raycast、findNearest 的单次耗时，
+ *        以及与游戏逻辑原先的做法（遍历所有游戏对象）对比
+ *
+ * 物体数量从 100 到 10000，世界面积随物体数量增长（密度不变，与 BroadphaseBench 相同），约 1/10 为静态的 SOLID 物体，
+ * 世界中有一个约 5% 为实心瓦片的碰撞瓦片层。每种查询在同一组随机位置上各运行 QUERIES 次。
+ * 矩形查询与遍历所有对象的结果数量必须一致。
+ *
+ * 只使用物理相关的组件，不需要 Context 和渲染器。
+ * 用法（在项目根目录运行）：
+ *     PhysicsQueryBench
+ */
+#include "BenchHarness.hpp"
+#include "../src/engine/component/ColliderComponent.hpp"
+#include "../src/engine/component/PhysicsComponent.hpp"
+#include "../src/engine/component/TilelayerComponent.hpp"
+#include "../src/engine/component/TransformComponent.hpp"
+#include "../src/engine/object/GameObject.hpp"
+#include "../src/engine/physics/Collider.hpp"
+#include "../src/engine/physics/PhysicsEngine.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <random>
+#include <vector>
+
+using engine::object::GameObject;
+
+namespace {
+
+constexpr int QUERIES = 1000;
+constexpr int REPEATS = 20;
+constexpr float BOX_SIZE = 64.0f;
+constexpr float RADIUS = 48.0f;
+constexpr float RAY_LENGTH = 256.0f;
+constexpr float NEAREST_DISTANCE = 256.0f;
+
+/// @brief 物理引擎与其中的物体，析构时先清理物体（注销物理组件和瓦片层）
+struct World {
+    engine::physics::PhysicsEngine physics;
+    std::vector<std::unique_ptr<GameObject>> objects;
+    float size = 0.0f;
+
+    ~World() {
+        for (auto& object : objects) object->clean();
+    }
+};
+
+/// @brief 生成 count 个 8~48 像素的物体（平均每个物体占 64x64 像素的面积）和一个碰撞瓦片层，并更新一次
+void buildWorld(World& world, size_t count) {
+    std::mt19937 rng(12345);
+    world.size = std::sqrt(static_cast<float>(count)) * 64.0f;
+    std::uniform_real_distribution<float> position(0.0f, world.size);
+    std::uniform_real_distribution<float> extent(8.0f, 48.0f);
+    for (size_t i = 0; i < count; ++i) {
+        const bool isSolid = i % 10 == 0;
+        auto object = std::make_unique<GameObject>("body", isSolid ? "solid" : (i % 2 ? "enemy" : "item"));
+        object->addComponent<engine::component::TransformComponent>(glm::vec2(position(rng), position(rng)));
+        object->addComponent<engine::component::ColliderComponent>(
+            std::make_unique<engine::physics::AABBCollider>(glm::vec2(extent(rng), extent(rng))));
+        object->addComponent<engine::component::PhysicsComponent>(&world.physics, false);
+        world.objects.push_back(std::move(object));
+    }
+
+    const int tiles = static_cast<int>(std::ceil(world.size / 16.0f));
+    std::vector<engine::component::TileInfo> palette = {{}, {engine::render::Sprite(), engine::component::TileType::SOLID}};
+    std::vector<std::uint16_t> cells(static_cast<size_t>(tiles) * tiles, 0);
+    std::bernoulli_distribution isSolidTile(0.05);
+    for (auto& cell : cells) cell = isSolidTile(rng) ? 1 : 0;
+    auto object = std::make_unique<GameObject>("tiles");
+    auto* layer = object->addComponent<engine::component::TileLayerComponent>(glm::ivec2(16, 16), glm::ivec2(tiles, tiles),
+                                                                              std::move(palette), std::move(cells));
+    world.physics.registerCollisionLayer(layer);
+    world.objects.push_back(std::move(object));
+
+    world.physics.update(1.0f / 60.0f);     // 静态物体转移、建立粗检测网格
+}
+
+/// @brief 从组件计算包围盒（游戏逻辑遍历对象时的做法），没有碰撞器时返回 std::nullopt
+std::optional<engine::utils::Rect> getObjectAABB(GameObject& object) {
+    auto* tc = object.getComponent<engine::component::TransformComponent>();
+    auto* cc = object.getComponent<engine::component::ColliderComponent>();
+    if (!tc || !cc || !cc->getCollider()) return std::nullopt;
+    return engine::utils::Rect(tc->getPosition() + cc->getOffset(), cc->getCollider()->getAABBSize() * tc->getScale());
+}
+
+/// @brief 原先的做法：遍历所有对象检测矩形重叠（边界接触不算重叠）
+size_t overlapBoxLinear(World& world, const engine::utils::Rect& box) {
+    size_t count = 0;
+    for (auto& object : world.objects) {
+        const auto aabb = getObjectAABB(*object);
+        if (!aabb) continue;
+        if (aabb->position.x < box.position.x + box.size.x && aabb->position.x + aabb->size.x > box.position.x &&
+            aabb->position.y < box.position.y + box.size.y && aabb->position.y + aabb->size.y > box.position.y) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+/// @brief 原先的做法：遍历所有对象查找最近的敌人
+GameObject* findNearestLinear(World& world, glm::vec2 point) {
+    GameObject* nearest = nullptr;
+    float nearestDistSq = NEAREST_DISTANCE * NEAREST_DISTANCE;
+    for (auto& object : world.objects) {
+        if (object->getTag() != "enemy") continue;
+        const auto aabb = getObjectAABB(*object);
+        if (!aabb) continue;
+        const auto offset = aabb->position + 0.5f * aabb->size - point;
+        const float distSq = offset.x * offset.x + offset.y * offset.y;
+        if (distSq <= nearestDistSq) {
+            nearestDistSq = distSq;
+            nearest = object.get();
+        }
+    }
+    return nearest;
+}
+
+/// @brief 运行 QUERIES 次查询，返回单次查询的耗时（微秒，取中位数）
+template <typename Fn>
+double measureQueryUs(Fn&& fn) {
+    return bench::measureMs(REPEATS, [&] {
+        for (int q = 0; q < QUERIES; ++q) fn(q);
+    }) * 1000.0 / QUERIES;
+}
+
+} // namespace
+
+int main() {
+    spdlog::info("PHYSICSQUERYBENCH::每种查询 {} 次，单位为微秒/次，取 {} 轮的中位数", QUERIES, REPEATS);
+    spdlog::info("PHYSICSQUERYBENCH::{:>8} {:>10} {:>10} {:>10} {:>10} {:>14} {:>14}",
+                 "物体数", "矩形", "圆形", "射线", "最近", "矩形(遍历)", "最近(遍历)");
+    bool isAllMatched = true;
+    for (size_t count : {100, 1000, 10000}) {
+        spdlog::set_level(spdlog::level::warn);     // 组件注册的日志会影响计时，输出结果前再恢复
+        World world;
+        buildWorld(world, count);
+
+        std::mt19937 rng(54321);
+        std::uniform_real_distribution<float> position(0.0f, world.size);
+        std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+        std::vector<glm::vec2> points(QUERIES);
+        std::vector<glm::vec2> directions(QUERIES);
+        for (int q = 0; q < QUERIES; ++q) {
+            points[q] = {position(rng), position(rng)};
+            directions[q] = glm::vec2(std::cos(angle(rng)), std::sin(angle(rng))) * RAY_LENGTH;
+        }
+
+        std::array<GameObject*, 64> results{};
+        engine::physics::QueryFilter enemies;
+        enemies.tag = "enemy";
+        size_t boxCount = 0;
+        size_t linearBoxCount = 0;
+        const double boxUs = measureQueryUs([&](int q) {
+            boxCount += world.physics.overlapBox({points[q], glm::vec2(BOX_SIZE)}, results);
+        });
+        const double radiusUs = measureQueryUs([&](int q) {
+            bench::keep(world.physics.queryRadius(points[q], RADIUS, results));
+        });
+        const double rayUs = measureQueryUs([&](int q) {
+            engine::physics::RaycastHit hit;
+            bench::keep(world.physics.raycast(points[q], points[q] + directions[q], hit) ? 1 : 0);
+        });
+        const double nearestUs = measureQueryUs([&](int q) {
+            bench::keep(world.physics.findNearest(points[q], NEAREST_DISTANCE, enemies) != nullptr ? 1 : 0);
+        });
+        const double linearBoxUs = measureQueryUs([&](int q) {
+            linearBoxCount += overlapBoxLinear(world, {points[q], glm::vec2(BOX_SIZE)});
+        });
+        const double linearNearestUs = measureQueryUs([&](int q) {
+            bench::keep(findNearestLinear(world, points[q]) != nullptr ? 1 : 0);
+        });
+
+        spdlog::set_level(spdlog::level::info);
+        const bool isMatched = boxCount == linearBoxCount;
+        isAllMatched = isAllMatched && isMatched;
+        spdlog::info("PHYSICSQUERYBENCH::{:>8} {:>10.3f} {:>10.3f} {:>10.3f} {:>10.3f} {:>14.3f} {:>14.3f}{}", count, boxUs, radiusUs,
+                     rayUs, nearestUs, linearBoxUs, linearNearestUs, isMatched ? "" : "  矩形查询结果数量不一致!");
+    }
+    return isAllMatched ? 0 : 1;
+}
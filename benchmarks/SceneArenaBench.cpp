@@ -0,0 +1,141 @@
+/**
+ * @file SceneArenaBench.cpp
+ * @brief 场景内存区的基准测试：启用与不启用内存池时，关卡加载/卸载的耗时与堆分配次数对比
+ *
+ * 对每张地图重复“构造场景 -> LevelLoader::loadLevel -> clean -> 销毁场景”，分别统计：
+ * - 加载、卸载（clean + 销毁场景与内存区）的耗时
+ * - 加载期间全局 operator new 的调用次数（本文件替换了全局 operator new 以计数）
+ * - 场景内存区的分配次数与峰值（游戏对象、碰撞器、动画、UI 元素，两种模式相同）
+ * 不启用内存池时，场景内存区只做统计，分配直接转发给全局堆（即 config 中 performance.scene_arena 为 false 时的行为）。
+ *
+ * 需要与游戏相同的运行环境（离屏视频驱动 + 软件渲染器，见 tests/TestContext.hpp）。
+ * 用法（在项目根目录运行）：
+ *     SceneArenaBench [地图文件...]
+ */
+#include "BenchHarness.hpp"
+#include "../tests/TestContext.hpp"
+#include "../src/engine/scene/LevelLoader.hpp"
+#include "../src/engine/scene/Scene.hpp"
+#include "../src/engine/scene/SceneManager.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace {
+std::atomic<size_t> g_heapAllocations = 0;     ///< @brief 全局 operator new 的累计调用次数
+} // namespace
+
+void* operator new(std::size_t size) {
+    g_heapAllocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+namespace {
+
+const char* const DEFAULT_MAPS[] = {"assets/maps/level0.tmj", "assets/maps/level1.tmj", "assets/maps/level2.tmj"};
+constexpr int REPEATS = 20;
+
+/// @brief 一次加载/卸载的统计
+struct Sample {
+    double loadMs = 0.0;
+    double unloadMs = 0.0;
+    size_t heapAllocations = 0;     ///< @brief 加载期间全局 operator new 的调用次数
+    size_t arenaAllocations = 0;    ///< @brief 场景内存区的分配次数
+    size_t peakBytes = 0;           ///< @brief 场景内存区的使用峰值
+};
+
+/// @brief 中位数（各次的分配次数相同，只对耗时取中位数）
+double median(std::vector<double> values) {
+    std::nth_element(values.begin(), values.begin() + values.size() / 2, values.end());
+    return values[values.size() / 2];
+}
+
+/// @brief 加载并卸载一次地图，返回是否加载成功
+bool loadOnce(engine::scene::SceneManager& sceneManager, const std::string& mapPath, Sample& sample) {
+    using Clock = std::chrono::steady_clock;
+    auto scene = std::make_unique<engine::scene::Scene>("SceneArenaBench", sceneManager.getContext(), sceneManager);
+    auto& arena = scene->getArena();
+
+    const size_t heapBefore = g_heapAllocations.load(std::memory_order_relaxed);
+    const auto loadStart = Clock::now();
+    bool isOk = false;
+    {
+        engine::utils::ArenaScope scope(&arena);    // 与 SceneManager::initScene 相同
+        engine::scene::LevelLoader loader;
+        isOk = loader.loadLevel(mapPath, *scene);
+        scene->init();
+    }
+    const std::chrono::duration<double, std::milli> loadElapsed = Clock::now() - loadStart;
+    sample.heapAllocations = g_heapAllocations.load(std::memory_order_relaxed) - heapBefore;
+    sample.arenaAllocations = arena.getAllocationCount();
+    sample.peakBytes = arena.getPeakBytes();
+
+    const auto unloadStart = Clock::now();
+    scene->clean();
+    scene.reset();
+    const std::chrono::duration<double, std::milli> unloadElapsed = Clock::now() - unloadStart;
+    sample.loadMs = loadElapsed.count();
+    sample.unloadMs = unloadElapsed.count();
+    return isOk;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::vector<std::string> maps(argv + 1, argv + argc);
+    if (maps.empty()) {
+        maps.assign(std::begin(DEFAULT_MAPS), std::end(DEFAULT_MAPS));
+    }
+
+    test::TestContext context;
+    engine::scene::SceneManager sceneManager(context.get());
+    bool isAllOk = true;
+    spdlog::info("SCENEARENABENCH::每项重复 {} 次取中位数（两种模式交替运行）", REPEATS);
+    spdlog::info("SCENEARENABENCH::{:<24} {:<8} {:>10} {:>10} {:>12} {:>12} {:>10}",
+                 "地图", "内存池", "加载(ms)", "卸载(ms)", "堆分配次数", "场景分配次数", "峰值(KB)");
+    for (const auto& mapPath : maps) {
+        std::vector<double> loadMs[2];
+        std::vector<double> unloadMs[2];
+        Sample last[2];
+        spdlog::set_level(spdlog::level::warn);     // 加载过程的日志会影响计时，输出结果前再恢复
+        for (int i = 0; i < REPEATS; ++i) {
+            for (int mode = 0; mode < 2; ++mode) {
+                sceneManager.setSceneArenaEnabled(mode == 0);
+                Sample sample;
+                isAllOk = loadOnce(sceneManager, mapPath, sample) && isAllOk;
+                loadMs[mode].push_back(sample.loadMs);
+                unloadMs[mode].push_back(sample.unloadMs);
+                last[mode] = sample;
+            }
+        }
+        spdlog::set_level(spdlog::level::info);
+        for (int mode = 0; mode < 2; ++mode) {
+            spdlog::info("SCENEARENABENCH::{:<24} {:<8} {:>10.3f} {:>10.3f} {:>12} {:>12} {:>10.1f}",
+                         mapPath, mode == 0 ? "启用" : "不启用", median(loadMs[mode]), median(unloadMs[mode]),
+                         last[mode].heapAllocations, last[mode].arenaAllocations, last[mode].peakBytes / 1024.0);
+        }
+    }
+    if (!isAllOk) {
+        spdlog::error("SCENEARENABENCH::部分地图加载失败");
+        return 1;
+    }
+    return 0;
+}
@@ -1,5 +1,6 @@
 #pragma once
 #include "../utils/Math.hpp"
+#include "../utils/MemoryArena.hpp"
 #include <SDL3/SDL_rect.h>
 #include <memory>
 #include <vector>
@@ -17,7 +18,7 @@ namespace engine::ui {
  * 管理子元素的层次结构。
  * 提供事件处理、更新和渲染的虚方法。
  */
-class UIElement {
+class UIElement : public engine::utils::ArenaAllocated {
 protected:
     glm::vec2 m_position;                                    ///< @brief 相对于父元素的局部位置
     glm::vec2 m_size;                                        ///< @brief 元素大小
@@ -22,6 +22,8 @@ namespace engine::component {
  */
 class AnimationComponent : public Component {
     friend class engine::object::GameObject;
+public:
+    static constexpr ComponentId COMPONENT_ID = ANIMATION_COMPONENT_ID;   ///< @brief 组件编号（GameObject 组件槽位的下标）
 private:
     std::unordered_map<std::string, std::unique_ptr<engine::render::Animation>> m_animations; /// @brief 动画名称到Animation对象的映射
     SpriteComponent* m_spriteComponent = nullptr;               ///< @brief 指向必需的SpriteComponent的指针
@@ -20,6 +20,8 @@ namespace engine::component {
  */
 class ColliderComponent final : public Component {
     friend class engine::object::GameObject;
+public:
+    static constexpr ComponentId COMPONENT_ID = COLLIDER_COMPONENT_ID;   ///< @brief 组件编号（GameObject 组件槽位的下标）
 private:
     TransformComponent* m_transform = nullptr;               ///< @brief 缓存的 TransformComponent 指针 (非拥有)
 
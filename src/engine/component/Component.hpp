@@ -1,5 +1,6 @@
 #pragma once
 #include "../core/Context.hpp"
+#include "ComponentId.hpp"
 
 namespace engine::object {
 class GameObject;
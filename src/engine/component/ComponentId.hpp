@@ -0,0 +1,39 @@
+/**
+ * @file ComponentId.hpp
+ * @brief 组件编号：每种组件在编译期拥有唯一的编号，GameObject 以此为下标在固定大小的槽位数组中存取组件
+ */
+#pragma once
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+namespace engine::component {
+
+using ComponentId = std::uint8_t;
+
+inline constexpr std::size_t MAX_COMPONENTS = 16;   ///< @brief 每个游戏对象最多拥有的组件种类数（槽位数组大小）
+
+/// @name 引擎组件编号
+/// @{
+inline constexpr ComponentId TRANSFORM_COMPONENT_ID = 0;
+inline constexpr ComponentId SPRITE_COMPONENT_ID    = 1;
+inline constexpr ComponentId ANIMATION_COMPONENT_ID = 2;
+inline constexpr ComponentId COLLIDER_COMPONENT_ID  = 3;
+inline constexpr ComponentId PHYSICS_COMPONENT_ID   = 4;
+inline constexpr ComponentId HEALTH_COMPONENT_ID    = 5;
+inline constexpr ComponentId PARALLAX_COMPONENT_ID  = 6;
+inline constexpr ComponentId TILELAYER_COMPONENT_ID = 7;
+/// @}
+
+inline constexpr ComponentId FIRST_GAME_COMPONENT_ID = 8;  ///< @brief 游戏层组件的编号从这里开始（见 game/component/GameComponentId.hpp）
+
+/**
+ * @brief 带有组件编号的组件类型
+ * @note 组件类通过 static constexpr ComponentId COMPONENT_ID 声明自己的编号，编号必须唯一且小于 MAX_COMPONENTS
+ */
+template <typename T>
+concept HasComponentId = requires {
+    { T::COMPONENT_ID } -> std::convertible_to<ComponentId>;
+} && (T::COMPONENT_ID < MAX_COMPONENTS);
+
+} // namespace engine::component
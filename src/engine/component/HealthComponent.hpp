@@ -8,6 +8,8 @@ namespace engine::component {
  */
 class HealthComponent final : public engine::component::Component {
     friend class engine::object::GameObject;
+public:
+    static constexpr engine::component::ComponentId COMPONENT_ID = engine::component::HEALTH_COMPONENT_ID;   ///< @brief 组件编号（GameObject 组件槽位的下标）
 private:
     int m_maxHealth = 1;                    ///< @brief 最大生命值
     int m_currentHealth = 1;                ///< @brief 当前生命值
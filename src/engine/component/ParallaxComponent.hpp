@@ -10,6 +10,8 @@ class TransformComponent;
 
 class ParallaxComponent final : public Component {
     friend class engine::object::GameObject;
+public:
+    static constexpr ComponentId COMPONENT_ID = PARALLAX_COMPONENT_ID;   ///< @brief 组件编号（GameObject 组件槽位的下标）
 private:
     TransformComponent* m_transform = nullptr;   ///< @brief 缓存变换组件
 
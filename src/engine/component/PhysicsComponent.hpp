@@ -19,6 +19,8 @@ class TransformComponent;
 class PhysicsComponent final: public Component {
     friend class engine::object::GameObject;
 public:
+    static constexpr ComponentId COMPONENT_ID = PHYSICS_COMPONENT_ID;   ///< @brief 组件编号（GameObject 组件槽位的下标）
+
     glm::vec2 m_velocity = {0.0f, 0.0f};             ///< @brief 物体的速度，设为公共成员变量，方便PhysicsEngine访问更新
 
 private:
@@ -3,6 +3,8 @@
 #include "../render/Sprite.hpp"
 #include "../render/Renderer.hpp"
 #include "../resource/ResourceManager.hpp"
+#include "../core/Context.hpp"
+#include "../core/Time.hpp"
 #include "../object/GameObject.hpp"
 
 #include <spdlog/spdlog.h>
@@ -128,8 +130,9 @@ void SpriteComponent::render(engine::core::Context &context) {
         return;
     }
 
-    // 获取变换信息（考虑偏移量）
-    const glm::vec2& pos = m_transform->getPosition() + m_offset;
+    // 获取变换信息（考虑偏移量，位置在最近两次逻辑更新之间插值）
+    const auto& time = context.getTime();
+    const glm::vec2 pos = m_transform->getInterpolatedPosition(static_cast<float>(time.getAlpha()), time.getTickCount()) + m_offset;
     const glm::vec2& scale = m_transform->getScale();
     float rotationDegrees = m_transform->getRotation();
 
@@ -39,6 +39,8 @@ class TransformComponent;
  */
 class SpriteComponent final : public Component {
     friend class engine::object::GameObject;  ///< 声明为友元类，允许GameObject访问私有成员
+public:
+    static constexpr ComponentId COMPONENT_ID = SPRITE_COMPONENT_ID;   ///< @brief 组件编号（GameObject 组件槽位的下标）
 private:
     resource::ResourceManager* m_resourceManager = nullptr;   ///< @brief 保存资源管理器指针，用于获取纹理大小
     TransformComponent*        m_transform       = nullptr;   ///< @brief 缓存 TransformComponent 指针（非必须）
@@ -0,0 +1,34 @@
+/**
+ * @file TileType.hpp
+ * @brief 瓦片的逻辑类型（不依赖渲染，瓦片层组件与瓦片碰撞解算共用）
+ */
+#pragma once
+#include <cstdint>
+
+namespace engine::component {
+/**
+ * @brief 定义瓦片的类型，用于游戏逻辑（例如碰撞）。
+ */
+enum class TileType : std::uint8_t {
+    EMPTY,      ///< @brief 空白瓦片
+    NORMAL,     ///< @brief 普通瓦片
+    SOLID,      ///< @brief 静止可碰撞瓦片
+    UNISOLID,   ///< @brief 单向静止可碰撞瓦片
+    SLOPE_0_1,  ///< @brief 斜坡瓦片，高度:左0  右1
+    SLOPE_1_0,  ///< @brief 斜坡瓦片，高度:左1  右0
+    SLOPE_0_2,  ///< @brief 斜坡瓦片，高度:左0  右1/2
+    SLOPE_2_1,  ///< @brief 斜坡瓦片，高度:左1/2右1
+    SLOPE_1_2,  ///< @brief 斜坡瓦片，高度:左1  右1/2
+    SLOPE_2_0,  ///< @brief 斜坡瓦片，高度:左1/2右0
+    HAZARD,     ///< @brief 危险瓦片（例如火焰、尖刺等）
+    LADDER,     ///< @brief 梯子瓦片
+    // 未来补充其它类型
+};
+
+/// @brief 瓦片类型对应的位（用于按位组合多个瓦片类型）
+constexpr std::uint32_t tileTypeBit(TileType type) { return 1u << static_cast<std::uint8_t>(type); }
+
+/// @brief 触发器瓦片：物体与之重叠时由物理引擎检测（不参与碰撞解算）
+inline constexpr std::uint32_t TRIGGER_TILE_MASK = tileTypeBit(TileType::HAZARD) | tileTypeBit(TileType::LADDER);
+
+} // namespace engine::component
@@ -4,20 +4,101 @@
 #include "../render/Renderer.hpp"
 #include "../render/Camera.hpp"
 #include "../physics/PhysicsEngine.hpp"
+#include "../resource/ResourceManager.hpp"
 
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <cmath>
+
 namespace engine::component {
-TileLayerComponent::TileLayerComponent(glm::ivec2 tileSize, glm::ivec2 mapSize, std::vector<TileInfo> &&tiles)
-    : m_tileSize(tileSize), m_mapSize(mapSize), m_tiles(std::move(tiles)) {
-    if (m_tiles.size() != static_cast<size_t>(m_mapSize.x * m_mapSize.y)) {
-        spdlog::error("TILELAYERCOMPONENT::地图尺寸与提供的瓦片向量大小不匹配。瓦片数据将被清除。");
-        m_tiles.clear();
+TileLayerComponent::TileLayerComponent(glm::ivec2 tileSize, glm::ivec2 mapSize, std::vector<TileInfo> &&palette, std::vector<std::uint16_t> &&cells)
+    : m_tileSize(tileSize), m_mapSize(mapSize), m_palette(std::move(palette)), m_cells(std::move(cells)) {
+    if (m_palette.empty()) {
+        m_palette.emplace_back();   // 保证 0 号空瓦片存在
+    }
+    const bool indicesValid = std::all_of(m_cells.begin(), m_cells.end(), [this](std::uint16_t index) { return index < m_palette.size(); });
+    if (m_cells.size() != static_cast<size_t>(m_mapSize.x * m_mapSize.y) || !indicesValid) {
+        spdlog::error("TILELAYERCOMPONENT::地图尺寸与提供的瓦片数据不匹配（或调色板索引越界）。瓦片数据将被清除。");
+        m_cells.clear();
         m_mapSize = {0, 0};
     }
+    buildCollisionGrid();
+    computeCullMargin();
+    setupChunks();
+    spdlog::debug("TILELAYERCOMPONENT::瓦片数据占用 {} 字节（调色板 {} 项）", getMemoryUsage(), m_palette.size());
     spdlog::trace("TILELAYERCOMPONENT::构造完成");
 }
 
+TileLayerComponent::~TileLayerComponent() {
+    releaseChunks();
+}
+
+void TileLayerComponent::buildCollisionGrid() {
+    // 瓦片数据构造后不再改变，因此只需构建一次
+    m_collisionGridStride = m_mapSize.x + 2;
+    m_collisionGrid.assign(static_cast<size_t>(m_collisionGridStride) * (m_mapSize.y + 2), static_cast<std::uint8_t>(TileType::EMPTY));
+    for (int y = 0; y < m_mapSize.y; ++y) {
+        for (int x = 0; x < m_mapSize.x; ++x) {
+            m_collisionGrid[static_cast<size_t>(y + 1) * m_collisionGridStride + (x + 1)] = static_cast<std::uint8_t>(tileAt(x, y).type);
+        }
+    }
+    // 触发器瓦片的二维前缀和，供 getTriggerTypesIn 快速排除不含触发器的范围
+    const size_t countStride = static_cast<size_t>(m_mapSize.x) + 1;
+    m_triggerCounts.assign(countStride * (m_mapSize.y + 1), 0);
+    m_triggerTypeMask = 0;
+    for (int y = 0; y < m_mapSize.y; ++y) {
+        std::uint32_t rowCount = 0;
+        for (int x = 0; x < m_mapSize.x; ++x) {
+            const std::uint32_t bit = tileTypeBit(tileAt(x, y).type) & TRIGGER_TILE_MASK;
+            m_triggerTypeMask |= bit;
+            rowCount += bit != 0;
+            m_triggerCounts[(y + 1) * countStride + (x + 1)] = m_triggerCounts[y * countStride + (x + 1)] + rowCount;
+        }
+    }
+}
+
+std::uint32_t TileLayerComponent::getTriggerTypesIn(glm::ivec2 start, glm::ivec2 end) const {
+    if (m_triggerTypeMask == 0) return 0;
+    const int x0 = std::clamp(start.x, 0, m_mapSize.x);
+    const int y0 = std::clamp(start.y, 0, m_mapSize.y);
+    const int x1 = std::clamp(end.x, 0, m_mapSize.x);
+    const int y1 = std::clamp(end.y, 0, m_mapSize.y);
+    if (x0 >= x1 || y0 >= y1) return 0;
+    const size_t countStride = static_cast<size_t>(m_mapSize.x) + 1;
+    const std::uint32_t count = m_triggerCounts[y1 * countStride + x1] - m_triggerCounts[y0 * countStride + x1]
+                              - m_triggerCounts[y1 * countStride + x0] + m_triggerCounts[y0 * countStride + x0];
+    if (count == 0) return 0;
+    // 范围内有触发器瓦片，逐格收集类型（出现所有类型后提前结束）
+    std::uint32_t types = 0;
+    for (int y = y0; y < y1; ++y) {
+        const std::uint8_t* row = &m_collisionGrid[static_cast<size_t>(y + 1) * m_collisionGridStride + 1];
+        for (int x = x0; x < x1; ++x) {
+            types |= tileTypeBit(static_cast<TileType>(row[x])) & TRIGGER_TILE_MASK;
+        }
+        if (types == m_triggerTypeMask) break;
+    }
+    return types;
+}
+
+void TileLayerComponent::computeCullMargin() {
+    m_cullMargin = {0, 0};
+    if (m_tileSize.x <= 0 || m_tileSize.y <= 0) return;
+    float maxWidth = static_cast<float>(m_tileSize.x);
+    float maxHeight = static_cast<float>(m_tileSize.y);
+    for (const auto& tile : m_palette) {     // 只需检查调色板中的不同瓦片
+        if (tile.type == TileType::EMPTY) continue;
+        if (const auto& srcRect = tile.sprite.getSourceRect(); srcRect) {
+            maxWidth = std::max(maxWidth, srcRect->w);
+            maxHeight = std::max(maxHeight, srcRect->h);
+        }
+    }
+    // 图片向右延伸（左上角对齐到瓦片左侧），因此左侧视口外的瓦片可能可见
+    m_cullMargin.x = static_cast<int>(std::ceil((maxWidth - m_tileSize.x) / m_tileSize.x));
+    // 图片向上延伸（底部对齐到瓦片底部），因此下方视口外的瓦片可能可见
+    m_cullMargin.y = static_cast<int>(std::ceil((maxHeight - m_tileSize.y) / m_tileSize.y));
+}
+
 void TileLayerComponent::init() {
     if (!m_owner) {
         spdlog::warn("TILELAYERCOMPONENT::init::TileLayerComponent 的 m_owner 未设置。");
@@ -29,30 +110,181 @@ void TileLayerComponent::render(engine::core::Context& context) {
     if (m_tileSize.x <= 0 || m_tileSize.y <= 0) {
         return; // 防止除以零或无效尺寸
     }
-    // 遍历所有瓦片
-    for (int y = 0; y < m_mapSize.y; ++y) {
-        for (int x = 0; x < m_mapSize.x; ++x) {
-            size_t index = static_cast<size_t>(y) * m_mapSize.x + x;
-            // 检查索引有效性以及瓦片是否需要渲染
-            if (index < m_tiles.size() && m_tiles[index].type != TileType::EMPTY) {
-                const auto& tileInfo = m_tiles[index];
-                // 计算该瓦片在世界中的左上角位置 (drawSprite 预期接收左上角坐标)
-                glm::vec2 tileLeftTopPos = {
-                    m_offset.x + static_cast<float>(x) * m_tileSize.x,
-                    m_offset.y + static_cast<float>(y) * m_tileSize.y
-                };
-                // 但如果图片的大小与瓦片的大小不一致，需要调整 y 坐标 (瓦片层的对齐点是左下角)
-                if(static_cast<int>(tileInfo.sprite.getSourceRect()->h) != m_tileSize.y) {
-                    tileLeftTopPos.y -= (tileInfo.sprite.getSourceRect()->h - static_cast<float>(m_tileSize.y));
-                }
+    ++m_frameCounter;
+    // 根据相机计算可见范围 (screenToWorld 使用相机实际渲染的位置)
+    const auto& camera = context.getCamera();
+    const glm::vec2 viewMin = camera.screenToWorld(glm::vec2(0.0f)) - m_offset;
+    const glm::vec2 viewMax = viewMin + camera.getViewportSize();
+
+    // 优先使用区块缓存，失败则回退为逐瓦片绘制
+    if (m_chunkCacheEnabled && renderChunks(context, viewMin, viewMax)) {
+        return;
+    }
+
+    // 只遍历可见范围内的瓦片
+    const int startX = std::max(0, static_cast<int>(std::floor(viewMin.x / m_tileSize.x)) - m_cullMargin.x);
+    const int startY = std::max(0, static_cast<int>(std::floor(viewMin.y / m_tileSize.y)));
+    const int endX = std::min(m_mapSize.x, static_cast<int>(std::floor(viewMax.x / m_tileSize.x)) + 1);
+    const int endY = std::min(m_mapSize.y, static_cast<int>(std::floor(viewMax.y / m_tileSize.y)) + 1 + m_cullMargin.y);
+    renderTiles(context, {startX, startY}, {endX, endY});
+}
+
+glm::vec2 TileLayerComponent::getTileDrawPosition(int x, int y, const TileInfo& tileInfo) const {
+    // 计算该瓦片在世界中的左上角位置 (drawSprite 预期接收左上角坐标)
+    glm::vec2 tileLeftTopPos = {
+        m_offset.x + static_cast<float>(x) * m_tileSize.x,
+        m_offset.y + static_cast<float>(y) * m_tileSize.y
+    };
+    // 但如果图片的大小与瓦片的大小不一致，需要调整 y 坐标 (瓦片层的对齐点是左下角)
+    if(static_cast<int>(tileInfo.sprite.getSourceRect()->h) != m_tileSize.y) {
+        tileLeftTopPos.y -= (tileInfo.sprite.getSourceRect()->h - static_cast<float>(m_tileSize.y));
+    }
+    return tileLeftTopPos;
+}
+
+void TileLayerComponent::renderTiles(engine::core::Context& context, glm::ivec2 start, glm::ivec2 end) {
+    for (int y = start.y; y < end.y; ++y) {
+        for (int x = start.x; x < end.x; ++x) {
+            const auto& tileInfo = tileAt(x, y);
+            // 检查瓦片是否需要渲染
+            if (tileInfo.type != TileType::EMPTY) {
                 // 执行绘制
-                context.getRenderer().drawSprite(context.getCamera(), tileInfo.sprite, tileLeftTopPos);
+                context.getRenderer().drawSprite(context.getCamera(), tileInfo.sprite, getTileDrawPosition(x, y, tileInfo));
+            }
+        }
+    }
+}
+
+void TileLayerComponent::setupChunks() {
+    releaseChunks();
+    m_chunks.clear();
+    m_chunkTiles = {0, 0};
+    m_chunkCount = {0, 0};
+    if (m_tileSize.x <= 0 || m_tileSize.y <= 0 || m_mapSize.x <= 0 || m_mapSize.y <= 0) return;
+    m_chunkTiles = {std::max(1, CHUNK_PIXEL_SIZE / m_tileSize.x), std::max(1, CHUNK_PIXEL_SIZE / m_tileSize.y)};
+    m_chunkCount = {(m_mapSize.x + m_chunkTiles.x - 1) / m_chunkTiles.x, (m_mapSize.y + m_chunkTiles.y - 1) / m_chunkTiles.y};
+    m_chunks.resize(static_cast<size_t>(m_chunkCount.x) * m_chunkCount.y);
+}
+
+glm::ivec2 TileLayerComponent::getChunkPixelSize(int chunkX, int chunkY) const {
+    const int tilesX = std::min(m_chunkTiles.x, m_mapSize.x - chunkX * m_chunkTiles.x);
+    const int tilesY = std::min(m_chunkTiles.y, m_mapSize.y - chunkY * m_chunkTiles.y);
+    return {tilesX * m_tileSize.x, tilesY * m_tileSize.y};
+}
+
+bool TileLayerComponent::renderChunks(engine::core::Context& context, glm::vec2 viewMin, glm::vec2 viewMax) {
+    if (m_chunks.empty()) return false;
+    // 纹理仍在后台解码时不烘焙区块（否则占位纹理会被烘焙进去），暂时逐瓦片绘制
+    if (context.getResourceManager().hasPendingTextures()) return false;
+    auto& renderer = context.getRenderer();
+    const glm::vec2 chunkPixel = glm::vec2(m_chunkTiles * m_tileSize);
+
+    // 可见的区块范围
+    const int startX = std::max(0, static_cast<int>(std::floor(viewMin.x / chunkPixel.x)));
+    const int startY = std::max(0, static_cast<int>(std::floor(viewMin.y / chunkPixel.y)));
+    const int endX = std::min(m_chunkCount.x, static_cast<int>(std::floor(viewMax.x / chunkPixel.x)) + 1);
+    const int endY = std::min(m_chunkCount.y, static_cast<int>(std::floor(viewMax.y / chunkPixel.y)) + 1);
+
+    // 绘制可见区块（未烘焙的立即烘焙）
+    for (int cy = startY; cy < endY; ++cy) {
+        for (int cx = startX; cx < endX; ++cx) {
+            auto& chunk = m_chunks[static_cast<size_t>(cy) * m_chunkCount.x + cx];
+            if (!chunk.texture && !bakeChunk(renderer, cx, cy)) {
+                // 渲染目标不可用，关闭区块缓存，之后一直逐瓦片绘制
+                spdlog::warn("TILELAYERCOMPONENT::renderChunks::区块烘焙失败，回退为逐瓦片绘制");
+                setChunkCacheEnabled(false);
+                return false;
+            }
+            chunk.lastUsedFrame = m_frameCounter;
+            const glm::vec2 chunkPos = m_offset + glm::vec2(cx, cy) * chunkPixel;
+            renderer.drawTexture(context.getCamera(), chunk.texture, chunkPos, glm::vec2(getChunkPixelSize(cx, cy)));
+        }
+    }
+
+    // 预烘焙可见范围外一圈的区块（每帧最多一个，避免卡顿）
+    for (int cy = std::max(0, startY - 1); cy < std::min(m_chunkCount.y, endY + 1); ++cy) {
+        for (int cx = std::max(0, startX - 1); cx < std::min(m_chunkCount.x, endX + 1); ++cx) {
+            auto& chunk = m_chunks[static_cast<size_t>(cy) * m_chunkCount.x + cx];
+            if (!chunk.texture) {
+                if (bakeChunk(renderer, cx, cy)) chunk.lastUsedFrame = m_frameCounter;
+                evictChunks();
+                return true;
+            }
+        }
+    }
+    evictChunks();
+    return true;
+}
+
+bool TileLayerComponent::bakeChunk(engine::render::Renderer& renderer, int chunkX, int chunkY) {
+    auto& chunk = m_chunks[static_cast<size_t>(chunkY) * m_chunkCount.x + chunkX];
+    const glm::ivec2 pixelSize = getChunkPixelSize(chunkX, chunkY);
+    chunk.texture = renderer.createRenderTarget(pixelSize.x, pixelSize.y);
+    if (!chunk.texture) return false;
+    m_chunkRenderer = &renderer;
+    if (!renderer.beginRenderToTexture(chunk.texture)) {
+        renderer.destroyRenderTarget(chunk.texture);
+        chunk.texture = nullptr;
+        return false;
+    }
+
+    // 区块覆盖的瓦片范围，再加上可能伸入本区块的大尺寸瓦片（左侧的宽瓦片、下方的高瓦片）
+    const glm::ivec2 start = {chunkX * m_chunkTiles.x, chunkY * m_chunkTiles.y};
+    const glm::ivec2 end = {std::min(m_mapSize.x, start.x + m_chunkTiles.x), std::min(m_mapSize.y, start.y + m_chunkTiles.y + m_cullMargin.y)};
+    const glm::vec2 chunkOrigin = m_offset + glm::vec2(start * m_tileSize);
+    // 与逐瓦片绘制保持相同的“行主序”绘制顺序，保证重叠部分的遮挡关系一致
+    for (int y = start.y; y < end.y; ++y) {
+        for (int x = std::max(0, start.x - m_cullMargin.x); x < end.x; ++x) {
+            const auto& tileInfo = tileAt(x, y);
+            if (tileInfo.type == TileType::EMPTY) continue;
+            renderer.drawUISprite(tileInfo.sprite, getTileDrawPosition(x, y, tileInfo) - chunkOrigin);
+        }
+    }
+    renderer.endRenderToTexture();
+
+    m_chunkMemoryUsed += static_cast<size_t>(pixelSize.x) * pixelSize.y * 4;
+    spdlog::trace("TILELAYERCOMPONENT::bakeChunk::烘焙区块 ({}, {}), 已占用显存 {} KB", chunkX, chunkY, m_chunkMemoryUsed / 1024);
+    return true;
+}
+
+void TileLayerComponent::evictChunks() {
+    while (m_chunkMemoryUsed > m_chunkMemoryBudget) {
+        // 找到最久未使用、且本帧没有被绘制的区块
+        TileChunk* oldest = nullptr;
+        int oldestIndex = -1;
+        for (size_t i = 0; i < m_chunks.size(); ++i) {
+            auto& chunk = m_chunks[i];
+            if (!chunk.texture || chunk.lastUsedFrame == m_frameCounter) continue;
+            if (!oldest || chunk.lastUsedFrame < oldest->lastUsedFrame) {
+                oldest = &chunk;
+                oldestIndex = static_cast<int>(i);
             }
         }
+        if (!oldest) break;     // 所有区块都在使用中，只能暂时超出预算
+        const glm::ivec2 pixelSize = getChunkPixelSize(oldestIndex % m_chunkCount.x, oldestIndex / m_chunkCount.x);
+        m_chunkRenderer->destroyRenderTarget(oldest->texture);
+        oldest->texture = nullptr;
+        m_chunkMemoryUsed -= static_cast<size_t>(pixelSize.x) * pixelSize.y * 4;
     }
 }
 
+void TileLayerComponent::releaseChunks() {
+    for (auto& chunk : m_chunks) {
+        if (chunk.texture && m_chunkRenderer) {
+            m_chunkRenderer->destroyRenderTarget(chunk.texture);
+        }
+        chunk.texture = nullptr;
+    }
+    m_chunkMemoryUsed = 0;
+}
+
+void TileLayerComponent::setChunkCacheEnabled(bool enabled) {
+    m_chunkCacheEnabled = enabled;
+    if (!enabled) releaseChunks();
+}
+
 void TileLayerComponent::clean() {
+    releaseChunks();
     if (m_physicsEngine) {
         m_physicsEngine->unregisterCollisionLayer(this);
     }
@@ -65,13 +297,21 @@ const TileInfo* TileLayerComponent::getTileInfoAt(glm::ivec2 pos) const {
     }
     size_t index = static_cast<size_t>(pos.y * m_mapSize.x + pos.x);
     // 瓦片索引不能越界
-    if (index < m_tiles.size()) {
-        return &m_tiles[index];
+    if (index < m_cells.size()) {
+        return &m_palette[m_cells[index]];
     }
     spdlog::warn("TILELAYERCOMPONENT::getTileInfoAt::瓦片索引越界: {}", index);
     return nullptr;
 }
 
+size_t TileLayerComponent::getMemoryUsage() const {
+    size_t bytes = m_cells.capacity() * sizeof(std::uint16_t) + m_collisionGrid.capacity() + m_triggerCounts.capacity() * sizeof(std::uint32_t);
+    for (const auto& tile : m_palette) {
+        bytes += sizeof(TileInfo) + tile.sprite.getTextureID().size();
+    }
+    return bytes;
+}
+
 TileType TileLayerComponent::getTileTypeAt(glm::ivec2 pos) const {
     const TileInfo* info = getTileInfoAt(pos);
     return info ? info->type : TileType::EMPTY;
@@ -1,11 +1,18 @@
 #pragma once
 #include "Component.hpp"
+#include "TileType.hpp"
+#include "../physics/TileSweep.hpp"
 #include "../render/Sprite.hpp"
 #include <vector>
+#include <cstdint>
+#include <algorithm>
 #include <glm/vec2.hpp>
 
+struct SDL_Texture;
+
 namespace engine::render {
 class Sprite;
+class Renderer;
 }
 
 namespace engine::core {
@@ -17,25 +24,6 @@ class PhysicsEngine;
 }
 
 namespace engine::component {
-/**
- * @brief 定义瓦片的类型，用于游戏逻辑（例如碰撞）。
- */
-enum class TileType {
-    EMPTY,      ///< @brief 空白瓦片
-    NORMAL,     ///< @brief 普通瓦片
-    SOLID,      ///< @brief 静止可碰撞瓦片
-    UNISOLID,   ///< @brief 单向静止可碰撞瓦片
-    SLOPE_0_1,  ///< @brief 斜坡瓦片，高度:左0  右1
-    SLOPE_1_0,  ///< @brief 斜坡瓦片，高度:左1  右0
-    SLOPE_0_2,  ///< @brief 斜坡瓦片，高度:左0  右1/2
-    SLOPE_2_1,  ///< @brief 斜坡瓦片，高度:左1/2右1
-    SLOPE_1_2,  ///< @brief 斜坡瓦片，高度:左1  右1/2
-    SLOPE_2_0,  ///< @brief 斜坡瓦片，高度:左1/2右0
-    HAZARD,     ///< @brief 危险瓦片（例如火焰、尖刺等）
-    LADDER,     ///< @brief 梯子瓦片
-    // 未来补充其它类型
-};
-
 /**
  * @brief 包含单个瓦片的渲染和逻辑信息。
  */
@@ -45,37 +33,79 @@ struct TileInfo {
     TileInfo(render::Sprite s = render::Sprite(), TileType t = TileType::EMPTY) : sprite(std::move(s)), type(t) {}
 };
 
+/**
+ * @brief 预烘焙的瓦片区块（一张渲染目标纹理，覆盖固定数量的瓦片）
+ */
+struct TileChunk {
+    SDL_Texture* texture = nullptr;     ///< @brief 烘焙好的纹理，nullptr 表示尚未烘焙（或已被回收）
+    std::uint64_t lastUsedFrame = 0;    ///< @brief 最近一次被绘制的帧序号，用于回收
+};
+
 /**
  * @brief 管理和渲染瓦片地图层。
  *
  * 存储瓦片地图的布局、每个瓦片的精灵信息和类型。
  * 负责在渲染阶段绘制可见的瓦片。
+ *
+ * 同一图层中重复出现的瓦片只有少数几种，因此瓦片以“调色板 + 索引”的方式紧凑存储：
+ * m_palette 保存不重复的 TileInfo（0 号固定为空瓦片），每个格子只存一个 uint16_t 调色板索引。
+ *
+ * 瓦片数据在构造后不再改变，因此默认将瓦片层按区块（约 CHUNK_PIXEL_SIZE 像素见方）
+ * 烘焙到渲染目标纹理中：相机附近的区块按需烘焙，超出显存预算时回收最久未使用的区块，
+ * 每帧只需绘制少量区块纹理。渲染目标不可用时回退为逐瓦片绘制。
  */
 class TileLayerComponent final : public Component {
     friend class engine::object::GameObject;
+public:
+    static constexpr ComponentId COMPONENT_ID = TILELAYER_COMPONENT_ID;   ///< @brief 组件编号（GameObject 组件槽位的下标）
 private:
-    glm::ivec2 m_tileSize;               ///< @brief 单个瓦片尺寸（像素）
-    glm::ivec2 m_mapSize;                ///< @brief 地图尺寸（瓦片数）
-    std::vector<TileInfo> m_tiles;       ///< @brief 存储所有瓦片信息 (按"行主序"存储, index = y * map_width_ + x)
+    glm::ivec2 m_tileSize = {0, 0};      ///< @brief 单个瓦片尺寸（像素）
+    glm::ivec2 m_mapSize = {0, 0};       ///< @brief 地图尺寸（瓦片数）
+    std::vector<TileInfo> m_palette;     ///< @brief 瓦片调色板：图层中不重复的瓦片信息 (0 号为空瓦片)
+    std::vector<std::uint16_t> m_cells;  ///< @brief 每个格子的调色板索引 (按"行主序"存储, index = y * map_width_ + x)
+    /// @brief 紧凑的碰撞类型网格 (每格1字节, 四周各多出一圈 EMPTY 边框, 尺寸为 (mapSize.x + 2) * (mapSize.y + 2))
+    std::vector<std::uint8_t> m_collisionGrid;
+    int m_collisionGridStride = 2;       ///< @brief 碰撞类型网格每行的字节数 (mapSize.x + 2)
+    /// @brief 触发器瓦片数量的二维前缀和 ((mapSize.x + 1) * (mapSize.y + 1)，[y][x] 为 [0, x) * [0, y) 范围内的数量)
+    std::vector<std::uint32_t> m_triggerCounts;
+    std::uint32_t m_triggerTypeMask = 0;  ///< @brief 图层中出现过的触发器瓦片类型 (tileTypeBit 的组合)
+    /// @brief 视锥剔除时额外扩展的瓦片数 (x: 向左扩展，用于比瓦片宽的图片; y: 向下扩展，用于底部对齐、比瓦片高的图片)
+    glm::ivec2 m_cullMargin = {0, 0};
     glm::vec2 m_offset = {0.0f, 0.0f};   ///< @brief 瓦片层在世界中的偏移量 (瓦片层通常不需要缩放及旋转，因此不引入Transform组件) offset_ 最好也保持默认的0，以免增加不必要的复杂性
     bool m_isHidden = false;             ///< @brief 是否隐藏（不渲染）
     physics::PhysicsEngine* m_physicsEngine = nullptr;   ///< @brief 物理引擎的指针， clean()函数中可能需要反注册
 
+    /// @name 区块缓存
+    /// @{
+    static constexpr int CHUNK_PIXEL_SIZE = 512;                    ///< @brief 区块的目标边长（像素）
+    static constexpr size_t DEFAULT_CHUNK_MEMORY_BUDGET = 32u << 20; ///< @brief 默认区块纹理显存预算（字节）
+    std::vector<TileChunk> m_chunks;                 ///< @brief 所有区块 (按"行主序"存储)
+    glm::ivec2 m_chunkTiles = {0, 0};                ///< @brief 每个区块包含的瓦片数
+    glm::ivec2 m_chunkCount = {0, 0};                ///< @brief 区块数量
+    size_t m_chunkMemoryBudget = DEFAULT_CHUNK_MEMORY_BUDGET;   ///< @brief 区块纹理显存预算（字节）
+    size_t m_chunkMemoryUsed = 0;                    ///< @brief 已烘焙区块占用的显存（字节，按 RGBA 估算）
+    std::uint64_t m_frameCounter = 0;                ///< @brief 渲染帧序号
+    bool m_chunkCacheEnabled = true;                 ///< @brief 是否启用区块缓存
+    engine::render::Renderer* m_chunkRenderer = nullptr;   ///< @brief 创建区块纹理的渲染器，用于释放纹理
+    /// @}
+
 public:
-    TileLayerComponent() = default;
+    TileLayerComponent() : m_palette(1) { buildCollisionGrid(); }
+    ~TileLayerComponent() override;
 
     /**
      * @brief 构造函数
      * @param tileSize 单个瓦片尺寸（像素）
      * @param mapSize 地图尺寸（瓦片数）
-     * @param tiles 初始化瓦片数据的容器 (会被移动)
+     * @param palette 瓦片调色板 (会被移动，0 号应为空瓦片)
+     * @param cells 每个格子的调色板索引，数量为 mapSize.x * mapSize.y (会被移动)
      */
-    TileLayerComponent(glm::ivec2 tileSize, glm::ivec2 mapSize, std::vector<TileInfo>&& tiles);
+    TileLayerComponent(glm::ivec2 tileSize, glm::ivec2 mapSize, std::vector<TileInfo>&& palette, std::vector<std::uint16_t>&& cells);
 
     /**
      * @brief 根据瓦片坐标获取瓦片信息
      * @param pos 瓦片坐标 (0 <= x < map_size_.x, 0 <= y < map_size_.y)
-     * @return const TileInfo* 指向瓦片信息的指针，如果坐标无效则返回 nullptr
+     * @return const TileInfo* 指向瓦片信息（调色板中的项，相同瓦片共享同一项）的指针，如果坐标无效则返回 nullptr
      */
     const TileInfo* getTileInfoAt(glm::ivec2 pos) const;
 
@@ -93,20 +123,70 @@ public:
      */
     TileType getTileTypeAtWorldPos(const glm::vec2& worldPos) const;
 
+    /**
+     * @brief 根据瓦片坐标获取碰撞类型（供物理引擎的高频查询使用）
+     * @param pos 瓦片坐标，可以越界（越界时返回 TileType::EMPTY，且不输出警告）
+     * @return TileType 瓦片类型
+     * @note 坐标被夹取到带边框的网格内，无需越界分支，每次查询只读取一个字节
+     */
+    TileType getCollisionTypeAt(glm::ivec2 pos) const { return getCollisionGrid().getCollisionTypeAt(pos); }
+
+    /// @brief 获取碰撞类型网格的只读视图（瓦片数据构造后不再改变，视图在组件销毁前一直有效）
+    engine::physics::TileGridView getCollisionGrid() const {
+        return {m_collisionGrid.data(), m_collisionGridStride, m_mapSize, glm::vec2(m_tileSize)};
+    }
+
+    /**
+     * @brief 获取瓦片坐标范围 [start, end) 内出现的触发器瓦片类型
+     * @param start 范围起点（含），可以越界
+     * @param end 范围终点（不含），可以越界
+     * @return std::uint32_t 出现的触发器瓦片类型 (tileTypeBit 的组合)，没有则为 0
+     * @note 先用前缀和 O(1) 判断范围内是否有触发器瓦片，绝大多数查询在此返回；有时才逐格读取类型
+     */
+    std::uint32_t getTriggerTypesIn(glm::ivec2 start, glm::ivec2 end) const;
+
     /// @name getters and setters
     /// @{
     glm::ivec2 getTileSize() const { return m_tileSize; }               ///< @brief 获取单个瓦片尺寸
     glm::ivec2 getMapSize() const { return m_mapSize; }                 ///< @brief 获取地图尺寸
     glm::vec2 getWorldSize() const { return glm::vec2(m_mapSize.x * m_tileSize.x, m_mapSize.y * m_tileSize.y); }
-    const std::vector<TileInfo>& getTiles() const { return m_tiles; }    ///< @brief 获取瓦片容器
+    const std::vector<TileInfo>& getPalette() const { return m_palette; }       ///< @brief 获取瓦片调色板
+    const std::vector<std::uint16_t>& getCells() const { return m_cells; }      ///< @brief 获取每个格子的调色板索引
+    size_t getMemoryUsage() const;                                              ///< @brief 获取瓦片数据占用的内存（字节，估算）
     const glm::vec2& getOffset() const { return m_offset; }              ///< @brief 获取瓦片层的偏移量
     bool isHidden() const { return m_isHidden; }                        ///< @brief 获取是否隐藏（不渲染）
 
     void setOffset(glm::vec2 offset) { m_offset = std::move(offset); }       ///< @brief 设置瓦片层的偏移量
     void setHidden(bool hidden) { m_isHidden = hidden; }                ///< @brief 设置是否隐藏（不渲染）
     void setPhysicsEngine(engine::physics::PhysicsEngine* physicsEngine) {m_physicsEngine = physicsEngine; }
+    void setChunkCacheEnabled(bool enabled);                                ///< @brief 设置是否启用区块缓存（关闭时释放已烘焙的区块）
+    bool isChunkCacheEnabled() const { return m_chunkCacheEnabled; }        ///< @brief 获取是否启用区块缓存
+    void setChunkMemoryBudget(size_t bytes) { m_chunkMemoryBudget = bytes; }  ///< @brief 设置区块纹理显存预算（字节）
+    size_t getChunkMemoryUsed() const { return m_chunkMemoryUsed; }           ///< @brief 获取已烘焙区块占用的显存（字节）
     /// @}
 
+private:
+    void buildCollisionGrid();   ///< @brief 根据瓦片数据构建碰撞类型网格
+    void computeCullMargin();    ///< @brief 根据最大的瓦片图片尺寸计算视锥剔除的扩展范围
+    void setupChunks();          ///< @brief 计算区块划分
+
+    /// @brief 获取瓦片 (x, y) 图片左上角的世界坐标（图片比瓦片高时底部对齐）
+    glm::vec2 getTileDrawPosition(int x, int y, const TileInfo& tileInfo) const;
+    /// @brief 获取格子 (x, y) 的瓦片信息（调用者保证坐标有效）
+    const TileInfo& tileAt(int x, int y) const { return m_palette[m_cells[static_cast<size_t>(y) * m_mapSize.x + x]]; }
+    /// @brief 逐个绘制 [start, end) 范围内的瓦片（不使用区块缓存）
+    void renderTiles(engine::core::Context& context, glm::ivec2 start, glm::ivec2 end);
+    /**
+     * @brief 使用区块缓存绘制可见区域
+     * @return 是否成功（失败时调用者应回退到逐瓦片绘制）
+     */
+    bool renderChunks(engine::core::Context& context, glm::vec2 viewMin, glm::vec2 viewMax);
+    /// @brief 烘焙指定区块，返回是否成功
+    bool bakeChunk(engine::render::Renderer& renderer, int chunkX, int chunkY);
+    glm::ivec2 getChunkPixelSize(int chunkX, int chunkY) const;   ///< @brief 获取区块纹理尺寸（地图边缘的区块较小）
+    void evictChunks();          ///< @brief 超出显存预算时，回收最久未使用的区块
+    void releaseChunks();        ///< @brief 释放所有区块纹理
+
 protected:
     // 核心循环方法
     void init() override;
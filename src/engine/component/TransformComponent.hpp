@@ -2,7 +2,9 @@
 #include "Component.hpp"
 
 #include <utility>
+#include <cstdint>
 #include <glm/vec2.hpp>
+#include <glm/common.hpp>
 
 namespace engine::component {
 /**
@@ -17,12 +19,19 @@ namespace engine::component {
  */
 class TransformComponent final : public Component {
     friend class engine::object::GameObject;        // 友元不能继承，必须每个子类单独添加
-
 public:
+    static constexpr ComponentId COMPONENT_ID = TRANSFORM_COMPONENT_ID;   ///< @brief 组件编号（GameObject 组件槽位的下标）
+
     glm::vec2 m_position = {0.0f, 0.0f};     ///< @brief 对象在2D空间中的位置坐标
     glm::vec2 m_scale = {1.0f, 1.0f};        ///< @brief 对象在X和Y轴上的缩放比例
     float m_rotation = 0.0f;                 ///< @brief 对象的旋转角度（角度制）
 
+private:
+    glm::vec2 m_prevPosition = {0.0f, 0.0f}; ///< @brief 上一次逻辑更新开始时的位置（用于渲染插值）
+    std::uint64_t m_prevTick = 0;            ///< @brief m_prevPosition 记录于哪一次逻辑更新
+
+public:
+
     /**
      * @brief 构造函数
      * @param position 初始位置，默认为原点(0,0)
@@ -30,7 +39,7 @@ public:
      * @param rotation 初始旋转角度（角度制），默认为0度
      */
     TransformComponent(glm::vec2 position = {0.0f, 0.0f}, glm::vec2 scale = {1.0f, 1.0f}, float rotation = 0.0f)
-        : m_position(std::move(position)), m_scale(std::move(scale)), m_rotation(rotation) {}
+        : m_position(std::move(position)), m_scale(std::move(scale)), m_rotation(rotation), m_prevPosition(m_position) {}
 
     /// @name 禁止拷贝和移动
     /// @{
@@ -58,6 +67,23 @@ public:
      */
     void translate(const glm::vec2& offset);
 
+    /// @name 渲染插值
+    /// @{
+    /**
+     * @brief 记录逻辑更新开始前的位置（由 Scene 在每次逻辑更新开始时调用）
+     * @param tick 本次逻辑更新的序号
+     */
+    void storePreviousPosition(std::uint64_t tick) { m_prevPosition = m_position; m_prevTick = tick; }
+    /**
+     * @brief 获取用于渲染的插值位置
+     * @param alpha 插值系数，0 为上一次逻辑更新前的位置，1 为当前位置
+     * @param tick 最近一次逻辑更新的序号。如果本对象没有参与该次更新（例如场景被暂停覆盖），直接返回当前位置
+     */
+    glm::vec2 getInterpolatedPosition(float alpha, std::uint64_t tick) const {
+        return m_prevTick == tick ? glm::mix(m_prevPosition, m_position, alpha) : m_position;
+    }
+    /// @}
+
 private:
     /**
      * @brief 更新组件状态
@@ -5,6 +5,7 @@
 
 #include <filesystem>
 #include <fstream>
+#include <optional>
 
 namespace engine::core {
 
@@ -53,6 +54,47 @@ bool Config::saveToFile(std::string_view filepath) {
     return false;
 }
 
+void Config::applyCommandLine(const std::vector<std::string>& args) {
+    // 取出 "--name=value" 形式参数的值
+    auto getValue = [](std::string_view arg, std::string_view name) -> std::optional<std::string_view> {
+        if (arg.size() > name.size() && arg.starts_with(name) && arg[name.size()] == '=') {
+            return arg.substr(name.size() + 1);
+        }
+        return std::nullopt;
+    };
+    for (const auto& arg : args) {
+        try {
+            if (arg == "--headless") {
+                m_headless = true;
+            } else if (arg == "--render") {
+                m_headlessRender = true;
+            } else if (auto value = getValue(arg, "--frames")) {
+                m_headlessFrames = std::stoi(std::string(*value));
+            } else if (auto value = getValue(arg, "--delta-time")) {
+                m_headlessDeltaTime = std::stod(std::string(*value));
+            } else if (auto value = getValue(arg, "--input-script")) {
+                m_headlessInputScript = *value;
+            } else {
+                spdlog::warn("CONFIG::applyCommandLine::忽略未知的命令行参数: {}", arg);
+            }
+        } catch (const std::exception&) {
+            spdlog::warn("CONFIG::applyCommandLine::无法解析命令行参数: {}", arg);
+        }
+    }
+    validateHeadless();
+}
+
+void Config::validateHeadless() {
+    if (m_headlessFrames <= 0) {
+        spdlog::warn("CONFIG::validateHeadless::无头模式帧数必须为正数. 设置为 3600");
+        m_headlessFrames = 3600;
+    }
+    if (m_headlessDeltaTime <= 0.0) {
+        spdlog::warn("CONFIG::validateHeadless::无头模式时间间隔必须为正数. 设置为 1/60 秒");
+        m_headlessDeltaTime = 1.0 / 60.0;
+    }
+}
+
 void Config::fromJson(const nlohmann::json& j) {
     if (j.contains("window")) {
         const auto& window_config = j["window"];
@@ -64,6 +106,7 @@ void Config::fromJson(const nlohmann::json& j) {
     if (j.contains("graphics")) {
         const auto& graphics_config = j["graphics"];
         m_vsyncEnabled = graphics_config.value("vsync", m_vsyncEnabled);
+        m_textureAtlasManifest = graphics_config.value("texture_atlas", m_textureAtlasManifest);
     }
     if (j.contains("performance")) {
         const auto& perf_config = j["performance"];
@@ -72,6 +115,33 @@ void Config::fromJson(const nlohmann::json& j) {
             spdlog::warn("CONFIG::fromJson::目标 FPS 不能为负数. 设置为 0 ( 无限制 )");
             m_targetFPS = 0;
         }
+        m_fixedTimestep = perf_config.value("fixed_timestep", m_fixedTimestep);
+        m_tickRate = perf_config.value("tick_rate", m_tickRate);
+        if (m_tickRate <= 0) {
+            spdlog::warn("CONFIG::fromJson::逻辑更新频率必须为正数. 设置为 60");
+            m_tickRate = 60;
+        }
+        m_maxCatchUpSteps = perf_config.value("max_catch_up_steps", m_maxCatchUpSteps);
+        if (m_maxCatchUpSteps < 1) {
+            spdlog::warn("CONFIG::fromJson::单帧最大追赶次数不能小于 1. 设置为 1");
+            m_maxCatchUpSteps = 1;
+        }
+        m_workerThreads = perf_config.value("worker_threads", m_workerThreads);
+        if (m_workerThreads < 0) {
+            spdlog::warn("CONFIG::fromJson::工作线程数不能为负数. 设置为 0 ( 自动 )");
+            m_workerThreads = 0;
+        }
+        m_sceneArena = perf_config.value("scene_arena", m_sceneArena);
+        m_sweptTileCollision = perf_config.value("swept_tile_collision", m_sweptTileCollision);
+    }
+    if (j.contains("headless")) {
+        const auto& headless_config = j["headless"];
+        m_headless = headless_config.value("enabled", m_headless);
+        m_headlessFrames = headless_config.value("frames", m_headlessFrames);
+        m_headlessDeltaTime = headless_config.value("delta_time", m_headlessDeltaTime);
+        m_headlessRender = headless_config.value("render", m_headlessRender);
+        m_headlessInputScript = headless_config.value("input_script", m_headlessInputScript);
+        validateHeadless();
     }
     if (j.contains("audio")) {
         const auto& audio_config = j["audio"];
@@ -104,10 +174,24 @@ nlohmann::ordered_json Config::toJson() const {
             {"resizable", m_windowResizable}
         }},
         {"graphics", {
-            {"vsync", m_vsyncEnabled}
+            {"vsync", m_vsyncEnabled},
+            {"texture_atlas", m_textureAtlasManifest}
         }},
         {"performance", {
-            {"target_fps", m_targetFPS}
+            {"target_fps", m_targetFPS},
+            {"fixed_timestep", m_fixedTimestep},
+            {"tick_rate", m_tickRate},
+            {"max_catch_up_steps", m_maxCatchUpSteps},
+            {"worker_threads", m_workerThreads},
+            {"scene_arena", m_sceneArena},
+            {"swept_tile_collision", m_sweptTileCollision}
+        }},
+        {"headless", {
+            {"enabled", m_headless},
+            {"frames", m_headlessFrames},
+            {"delta_time", m_headlessDeltaTime},
+            {"render", m_headlessRender},
+            {"input_script", m_headlessInputScript}
         }},
         {"audio", {
             {"music_volume", m_musicVolume},
@@ -30,7 +30,21 @@ public:
     bool m_windowResizable = true;
 
     bool m_vsyncEnabled = true;
+    std::string m_textureAtlasManifest = "assets/textures/atlas/atlas.json";    ///< @brief 纹理图集清单路径（为空或文件不存在时不使用图集）
     int m_targetFPS = 60;
+    bool m_fixedTimestep = true;        ///< @brief 是否使用固定时间步长更新游戏逻辑与物理
+    int m_tickRate = 60;                ///< @brief 固定时间步长模式下每秒的逻辑更新次数
+    int m_maxCatchUpSteps = 5;          ///< @brief 单帧最多追赶的逻辑更新次数（防止卡顿后“死亡螺旋”）
+    int m_workerThreads = 0;            ///< @brief 任务系统的工作线程数（0 表示 CPU 核心数 - 1）
+    bool m_sceneArena = true;           ///< @brief 场景中的游戏对象、UI 元素等是否从场景内存池分配（关闭时使用全局堆）
+    bool m_sweptTileCollision = true;   ///< @brief 物理引擎是否对瓦片层做连续碰撞检测（允许更大的时间步长而不穿墙）
+
+    /// @brief 无头模式：不显示窗口、不等待帧率，用固定的合成时间间隔运行指定帧数，结束时输出模拟吞吐量（用于性能测试与 CI）
+    bool m_headless = false;
+    int m_headlessFrames = 3600;                    ///< @brief 无头模式下运行的帧数
+    double m_headlessDeltaTime = 1.0 / 60.0;        ///< @brief 无头模式下每帧的合成时间间隔（秒）
+    bool m_headlessRender = false;                  ///< @brief 无头模式下是否仍然渲染（软件渲染到离屏窗口）
+    std::string m_headlessInputScript;              ///< @brief 无头模式下回放的输入脚本（为空则没有输入）
     
     float m_musicVolume = 1.0f;
     float m_soundVolume = 1.0f;
@@ -47,7 +61,8 @@ public:
         {"move_down", {"S", "Down"}},
         {"jump", {"J", "Space"}},
         {"attack", {"K", "MouseLeft"}},
-        {"pause", {"P", "Escape"}}
+        {"pause", {"P", "Escape"}},
+        {"profiler_capture", {"F9"}}        // 导出最近几秒的性能分析记录 (需启用 SL_ENABLE_PROFILER)
     };
     /// @}
 
@@ -82,6 +97,15 @@ public:
      */
     [[nodiscard]] bool saveToFile(std::string_view filePath);
 
+    /**
+     * @brief 用命令行参数覆盖配置（在加载配置文件之后调用）
+     * 
+     * 支持的参数：--headless, --frames=N, --delta-time=秒, --render, --input-script=路径
+     * 
+     * @param args 命令行参数（不含程序名）
+     */
+    void applyCommandLine(const std::vector<std::string>& args);
+
 private:
     /**
      * @brief 从JSON对象加载配置
@@ -100,6 +124,9 @@ private:
      * @return 包含当前配置数据的有序JSON对象
      */
     nlohmann::ordered_json toJson() const;
+
+    /// @brief 检查无头模式配置，非法值恢复为默认值
+    void validateHeadless();
 };
 
 } // namespace engine::core
\ No newline at end of file
@@ -16,9 +16,12 @@ Context::Context(
     engine::render::TextRenderer &textRenderer,
     engine::resource::ResourceManager &resourceManager, 
     engine::physics::PhysicsEngine &physicsEngine,
-    engine::core::GameState& gameState
+    engine::core::GameState& gameState,
+    engine::core::Time& time,
+    engine::core::JobSystem& jobSystem
 ) : m_inputManager(inputManager), m_renderer(renderer), m_camera(camera),
-    m_textRenderer(textRenderer), m_resourceManager(resourceManager), m_physicsEngine(physicsEngine), m_gameState(gameState) {
-    spdlog::trace("CONTEXT::上下文已创建，包括：输入管理器、渲染器、相机、资源管理器、物理引擎和游戏状态");
+    m_textRenderer(textRenderer), m_resourceManager(resourceManager), m_physicsEngine(physicsEngine), m_gameState(gameState), m_time(time),
+    m_jobSystem(jobSystem) {
+    spdlog::trace("CONTEXT::上下文已创建，包括：输入管理器、渲染器、相机、资源管理器、物理引擎、游戏状态、时间管理器和任务系统");
 }
 } // namespace engine::core
\ No newline at end of file
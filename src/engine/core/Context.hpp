@@ -30,6 +30,8 @@ class PhysicsEngine;
 
 namespace engine::core {
     class GameState;
+    class Time;
+    class JobSystem;
 
 /**
  * @class Context
@@ -50,6 +52,8 @@ private:
     engine::resource::ResourceManager& m_resourceManager; ///< 资源管理器引用
     engine::physics::PhysicsEngine& m_physicsEngine;      ///< 物理引擎引用
     engine::core::GameState& m_gameState;                 ///< 游戏状态
+    engine::core::Time& m_time;                           ///< 时间管理器引用
+    engine::core::JobSystem& m_jobSystem;                 ///< 任务系统引用
 
 public:
     /**
@@ -61,6 +65,8 @@ public:
      * @param resourceManager 资源管理器引用
      * @param physicsEngine 物理引擎引用
      * @param gameState 游戏状态引用
+     * @param time 时间管理器引用
+     * @param jobSystem 任务系统引用
      */
     Context(
         engine::input::InputManager& inputManager,
@@ -69,7 +75,9 @@ public:
         engine::render::TextRenderer& textRenderer,
         engine::resource::ResourceManager& resourceManager,
         engine::physics::PhysicsEngine& physicsEngine,
-        engine::core::GameState& gameState
+        engine::core::GameState& gameState,
+        engine::core::Time& time,
+        engine::core::JobSystem& jobSystem
     );
 
     /// @name 禁止拷贝和移动
@@ -89,6 +97,8 @@ public:
     engine::resource::ResourceManager& getResourceManager() const { return m_resourceManager; } ///< @brief 获取资源管理器
     engine::physics::PhysicsEngine& getPhysicsEngine() const { return m_physicsEngine; }         ///< @brief 获取物理引擎
     engine::core::GameState& getGameState() const { return m_gameState; }                       ///< @brief 获取游戏状态
+    engine::core::Time& getTime() const { return m_time; }                                       ///< @brief 获取时间管理器
+    engine::core::JobSystem& getJobSystem() const { return m_jobSystem; }                       ///< @brief 获取任务系统
     /// @}
 };
 
@@ -2,6 +2,7 @@
 #include "Time.hpp"
 #include "Config.hpp"
 #include "GameState.hpp"
+#include "JobSystem.hpp"
 #include "../resource/ResourceManager.hpp"
 #include "../render/Renderer.hpp"
 #include "../render/Camera.hpp"
@@ -12,12 +13,20 @@
 #include "../component/TransformComponent.hpp"
 #include "../physics/PhysicsEngine.hpp"
 #include "../scene/SceneManager.hpp"
+#include "../input/InputScript.hpp"
+#include "../utils/Profiler.hpp"
 
 #include "../../game/scene/TitleScene.hpp"
 
 #include <SDL3/SDL.h>
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <iomanip>
+#include <sstream>
+
 namespace engine::core {
 
 Game::Game() = default;
@@ -37,19 +46,51 @@ void Game::run() {
         spdlog::error("GAME::游戏初始化失败");
         return;
     }
+    const auto runStartTime = std::chrono::steady_clock::now();
     while (m_isRunning) {
         m_time->update();
-        float deltaTime = static_cast<float>(m_time->getDeltaTime());
         m_inputManager->update();
+        if (m_inputScript) {
+            m_inputScript->apply(m_frameCount, *m_inputManager);
+        }
 
         handleEvents();
-        update(deltaTime);
+        m_jobSystem->update();      // 执行已就绪的主线程延续任务
+        if (m_time->isFixedTimestep()) {
+            // 固定时间步长：逻辑与物理按固定频率推进，与渲染帧率无关
+            const int steps = m_time->consumeFixedSteps();
+            const float fixedDeltaTime = static_cast<float>(m_time->getFixedDeltaTime());
+            for (int i = 0; i < steps; ++i) {
+                m_time->advanceTick();
+                update(fixedDeltaTime);
+            }
+        } else {
+            m_time->advanceTick();
+            update(static_cast<float>(m_time->getDeltaTime()));
+        }
         render();
-        // spdlog::info("FPS: {}", 1.0f / deltaTime);
+        SL_PROFILE_END_FRAME();
+        // 无头模式运行满指定帧数后退出
+        ++m_frameCount;
+        if (m_config->m_headless && m_frameCount >= static_cast<std::uint64_t>(m_config->m_headlessFrames)) {
+            m_isRunning = false;
+        }
+    }
+    if (m_config->m_headless) {
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - runStartTime;
+        reportHeadlessStats(elapsed.count());
     }
     close();
 }
 
+void Game::setCommandLine(int argc, char* argv[]) {
+    m_commandLine.assign(argv + std::min(argc, 1), argv + argc);    // 跳过程序名
+}
+
+bool Game::isHeadless() const {
+    return m_config && m_config->m_headless;
+}
+
 void Game::registerSceneSetup(std::function<void(engine::scene::SceneManager &)> func) {
     m_sceneSetupFunc = std::move(func);
     spdlog::trace("GAME::registerSceneSetup::已注册场景设置函数。");
@@ -65,6 +106,7 @@ bool Game::init() {
     if (!initConfig()) return false;
     if (!initWindow()) return false;
     if (!initTime()) return false;
+    if (!initJobSystem()) return false;
     if (!initResourceManager()) return false;
     if (!initRenderer()) return false;
     if (!initCamera()) return false;
@@ -77,6 +119,7 @@ bool Game::init() {
     if (!initSceneManager()) return false;
 
     m_sceneSetupFunc(*m_sceneManager);
+    SL_PROFILE_THREAD_NAME("Main");
     m_isRunning = true;
     spdlog::trace("GAME::初始化成功。");
     return true;
@@ -88,14 +131,66 @@ void Game::handleEvents() {
         m_isRunning = false;
         return;
     }
+#if SL_ENABLE_PROFILER
+    if (m_inputManager->isActionPressed("profiler_capture")) {
+        dumpProfile();
+    }
+#endif
     m_sceneManager->handleInput();
 }
 
+void Game::reportHeadlessStats(double elapsedSeconds) const {
+    const auto ticks = m_time->getTickCount();
+    const double seconds = std::max(elapsedSeconds, 1e-9);
+    spdlog::info("GAME::reportHeadlessStats::无头模式运行结束: {} 帧, {} 次逻辑更新, 模拟时间 {:.2f} 秒, 实际耗时 {:.3f} 秒",
+                 m_frameCount, ticks, static_cast<double>(m_frameCount) * m_config->m_headlessDeltaTime, elapsedSeconds);
+    spdlog::info("GAME::reportHeadlessStats::吞吐量: {:.1f} 次逻辑更新/秒, {:.1f} 帧/秒",
+                 static_cast<double>(ticks) / seconds, static_cast<double>(m_frameCount) / seconds);
+#if SL_ENABLE_PROFILER
+    // 各子系统耗时（来自性能分析区段，按总耗时从高到低）
+    auto totals = engine::utils::Profiler::get().getTotalStats();
+    std::sort(totals.begin(), totals.end(), [](const auto& a, const auto& b) { return a.totalMs > b.totalMs; });
+    const auto frames = std::max<std::uint64_t>(engine::utils::Profiler::get().getTotalFrames(), 1);
+    const double totalMs = elapsedSeconds * 1000.0;
+    for (const auto& stats : totals) {
+        spdlog::info("GAME::reportHeadlessStats::    {:<40} 共 {:10.3f} ms  {:8.4f} ms/帧  {:5.1f}%  {} 次",
+                     stats.name, stats.totalMs, stats.totalMs / static_cast<double>(frames),
+                     totalMs > 0.0 ? stats.totalMs / totalMs * 100.0 : 0.0, stats.calls);
+    }
+#else
+    spdlog::info("GAME::reportHeadlessStats::未启用性能分析器 (ENABLE_PROFILER=OFF)，不输出各子系统耗时");
+#endif
+}
+
+void Game::dumpProfile() {
+    // 文件名带上时间，多次导出不会互相覆盖
+    const auto now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+    std::tm localTime{};
+#ifdef _WIN32
+    localtime_s(&localTime, &now);
+#else
+    localtime_r(&now, &localTime);
+#endif
+    std::ostringstream path;
+    path << "profile_" << std::put_time(&localTime, "%Y%m%d_%H%M%S") << ".json";
+    if (!engine::utils::Profiler::get().dumpChromeTrace(path.str())) {
+        spdlog::warn("GAME::dumpProfile::导出性能分析记录失败");
+    }
+}
+
 void Game::update(float deltaTime) {
     m_sceneManager->update(deltaTime);
 }
 
 void Game::render() {
+    if (m_config->m_headless && !m_config->m_headlessRender) {
+        m_resourceManager->update();    // 不绘制，但仍然上传解码完成的纹理（保持与正常运行相同的资源状态）
+        return;
+    }
+    // 根据累加器剩余时间，在最近两次逻辑更新的结果之间插值渲染
+    m_camera->setInterpolation(static_cast<float>(m_time->getAlpha()), m_time->getTickCount());
+    // 上传后台解码完成的纹理（每帧数量有限）
+    m_resourceManager->update();
     m_renderer->clearScreen();
     m_sceneManager->render();
     m_renderer->present();
@@ -106,6 +201,7 @@ void Game::close()  {
 
     m_sceneManager->close();
     m_resourceManager.reset();
+    m_jobSystem.reset();        // 资源管理器等使用任务系统的模块释放后再停止工作线程
     
     if (m_SDLRenderer) {
         SDL_DestroyRenderer(m_SDLRenderer);
@@ -125,6 +221,7 @@ void Game::close()  {
 bool Game::initConfig(){
     try {
         m_config = std::make_unique<engine::core::Config>("assets/config.json");
+        m_config->applyCommandLine(m_commandLine);
     } catch (const std::exception& e) {
         spdlog::error("GAME::initConfig::初始化配置失败: {}", e.what());
         return false;
@@ -134,16 +231,23 @@ bool Game::initConfig(){
 }
 
 bool Game::initWindow() {
+    const bool isHeadless = m_config->m_headless;
+    if (isHeadless) {
+        // 无头模式：离屏视频驱动 + 虚拟音频驱动，不需要显示器、GPU 和声卡
+        SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "offscreen");
+        SDL_SetHint(SDL_HINT_AUDIO_DRIVER, "dummy");
+    }
     if (!SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO)) {
         spdlog::error("GAME::initWindow::SDL初始化失败: {}", SDL_GetError());
         return false;
     }
-    m_window = SDL_CreateWindow(m_config->m_windowTitle.c_str(), m_config->m_windowWidth, m_config->m_windowHeight, SDL_WINDOW_RESIZABLE);
+    m_window = SDL_CreateWindow(m_config->m_windowTitle.c_str(), m_config->m_windowWidth, m_config->m_windowHeight,
+                                isHeadless ? SDL_WINDOW_HIDDEN : SDL_WINDOW_RESIZABLE);
     if (!m_window) {
         spdlog::error("GAME::initWindow::SDL窗口创建失败: {}", SDL_GetError());
         return false;
     }
-    m_SDLRenderer = SDL_CreateRenderer(m_window, nullptr);
+    m_SDLRenderer = SDL_CreateRenderer(m_window, isHeadless ? SDL_SOFTWARE_RENDERER : nullptr);
     if (!m_SDLRenderer) {
         spdlog::error("GAME::initWindow::SDL渲染器创建失败: {}", SDL_GetError());
         return false;
@@ -151,7 +255,7 @@ bool Game::initWindow() {
     // 设置渲染器支持透明色
     SDL_SetRenderDrawBlendMode(m_SDLRenderer, SDL_BLENDMODE_BLEND);
     // 设置 VSync (注意: VSync 开启时，驱动程序会尝试将帧率限制到显示器刷新率，有可能会覆盖我们手动设置的 target_fps)
-    int vsyncMode = m_config->m_vsyncEnabled ? SDL_RENDERER_VSYNC_ADAPTIVE : SDL_RENDERER_VSYNC_DISABLED;
+    int vsyncMode = m_config->m_vsyncEnabled && !isHeadless ? SDL_RENDERER_VSYNC_ADAPTIVE : SDL_RENDERER_VSYNC_DISABLED;
     SDL_SetRenderVSync(m_SDLRenderer, vsyncMode);
     spdlog::trace("GAME::initWindow::vsync 设置为: {}", vsyncMode == SDL_RENDERER_VSYNC_ADAPTIVE ? "自适应" : "禁用");
     // 设置逻辑分辨率为窗口大小的一半（针对像素游戏）
@@ -168,13 +272,37 @@ bool Game::initTime() {
         return false;
     }
     m_time->setTargetFPS(m_config->m_targetFPS);
-    spdlog::trace("GAME::initTime::时间管理器初始化成功, FPS: {}", m_config->m_targetFPS);
+    m_time->setFixedTimestep(m_config->m_fixedTimestep);
+    m_time->setTickRate(m_config->m_tickRate);
+    m_time->setMaxCatchUpSteps(m_config->m_maxCatchUpSteps);
+    if (m_config->m_headless) {
+        // 无头模式：每帧固定的合成时间间隔，不限制帧率
+        m_time->setTargetFPS(0);
+        m_time->setSyntheticDeltaTime(m_config->m_headlessDeltaTime);
+        spdlog::info("GAME::initTime::无头模式: 运行 {} 帧, 每帧 {:.6f} 秒", m_config->m_headlessFrames, m_config->m_headlessDeltaTime);
+    }
+    spdlog::trace("GAME::initTime::时间管理器初始化成功, FPS: {}, 固定时间步长: {}, 逻辑频率: {}",
+                  m_config->m_targetFPS, m_config->m_fixedTimestep, m_config->m_tickRate);
+    return true;
+}
+
+bool Game::initJobSystem() {
+    try {
+        m_jobSystem = std::make_unique<JobSystem>(static_cast<size_t>(m_config->m_workerThreads));
+    } catch (const std::exception &e) {
+        spdlog::error("GAME::initJobSystem::任务系统初始化失败: {}", e.what());
+        return false;
+    }
+    spdlog::trace("GAME::initJobSystem::任务系统初始化成功, 工作线程数: {}", m_jobSystem->getWorkerCount());
     return true;
 }
 
 bool Game::initResourceManager(){
     try {
-        m_resourceManager = std::make_unique<resource::ResourceManager>(m_SDLRenderer);
+        m_resourceManager = std::make_unique<resource::ResourceManager>(m_SDLRenderer, *m_jobSystem);
+        if (!m_config->m_textureAtlasManifest.empty()) {
+            m_resourceManager->loadTextureAtlas(m_config->m_textureAtlasManifest);   // 图集清单不存在时所有图片单独加载
+        }
     } catch (const std::exception &e) {
         spdlog::error("GAME::initResourceManager::资源管理器初始化失败: {}", e.what());
         return false;
@@ -219,12 +347,20 @@ bool Game::initInputManager() {
         spdlog::error("GAME::initInputManager::输入管理器初始化失败: {}", e.what());
         return false;
     }
+    if (m_config->m_headless && !m_config->m_headlessInputScript.empty()) {
+        m_inputScript = std::make_unique<engine::input::InputScript>();
+        if (!m_inputScript->loadFromFile(m_config->m_headlessInputScript)) {
+            spdlog::error("GAME::initInputManager::输入脚本加载失败: {}", m_config->m_headlessInputScript);
+            return false;
+        }
+    }
     return true;
 }
 
 bool Game::initPhysicsEngine() {
     try {
         m_physicsEngine = std::make_unique<engine::physics::PhysicsEngine>();
+        m_physicsEngine->setSweptTileCollisionEnabled(m_config->m_sweptTileCollision);
     } catch (const std::exception &e) {
         spdlog::error("GAME::initPhysicsEngine::物理引擎初始化失败: {}", e.what());
         return false;
@@ -251,7 +387,9 @@ bool Game::initContext() {
             *m_textRenderer,
             *m_resourceManager, 
             *m_physicsEngine,
-            *m_gameState
+            *m_gameState,
+            *m_time,
+            *m_jobSystem
         );
     } catch (const std::exception &e) {
         spdlog::error("GAME::initContext::上下文初始化失败: {}", e.what());
@@ -262,6 +400,7 @@ bool Game::initContext() {
 bool Game::initSceneManager() {
     try {
         m_sceneManager = std::make_unique<engine::scene::SceneManager>(*m_context);
+        m_sceneManager->setSceneArenaEnabled(m_config->m_sceneArena);
     } catch (const std::exception &e) {
         spdlog::error("GAME::initSceneManager::场景管理器初始化失败: {}", e.what());
         return false;
@@ -4,8 +4,11 @@
  */
 
 #pragma once
+#include <cstdint>
 #include <memory>
 #include <functional>
+#include <string>
+#include <vector>
 
 
 /// @name 前向声明
@@ -25,6 +28,7 @@ class TextRenderer;
 
 namespace engine::input {
 class InputManager;
+class InputScript;
 } // namespace engine::input
 
 namespace engine::scene {
@@ -43,6 +47,7 @@ class Time; // 前向声明
 class Config;
 class Context;
 class GameState;
+class JobSystem;
 
 /**
  * @class Game
@@ -66,6 +71,7 @@ private:
     std::function<void(engine::scene::SceneManager&)> m_sceneSetupFunc;
 
     std::unique_ptr<Time>                      m_time            = nullptr;   /**< 指向时间管理组件的智能指针 */
+    std::unique_ptr<JobSystem>                 m_jobSystem       = nullptr;   /**< 指向任务系统的智能指针 */
     std::unique_ptr<resource::ResourceManager> m_resourceManager = nullptr;   /**< 指向资源管理组件的智能指针 */
     std::unique_ptr<render::Renderer>          m_renderer        = nullptr;   /**< 指向渲染器组件的智能指针 */
     std::unique_ptr<render::Camera>            m_camera          = nullptr;   /**< 指向相机组件的智能指针 */
@@ -76,8 +82,12 @@ private:
     std::unique_ptr<scene::SceneManager>       m_sceneManager    = nullptr;   /**< 指向场景管理器的智能指针 */
     std::unique_ptr<physics::PhysicsEngine>    m_physicsEngine   = nullptr;   /**< 指向物理引擎的智能指针 */
     std::unique_ptr<engine::core::GameState>   m_gameState       = nullptr;   /**< 指向游戏状态的智能指针 */
+    std::unique_ptr<input::InputScript>        m_inputScript     = nullptr;   /**< 无头模式下回放的输入脚本（没有则为空） */
     /// @}
 
+    std::vector<std::string> m_commandLine;    /**< 命令行参数（不含程序名），加载配置后用于覆盖配置 */
+    std::uint64_t m_frameCount = 0;            /**< 已运行的帧数 */
+
 public:
     Game();
     ~Game();
@@ -89,6 +99,15 @@ public:
      * @param func 一个接收 SceneManager 引用的函数对象。
      */
     void registerSceneSetup(std::function<void(engine::scene::SceneManager&)> func);
+    /**
+     * @brief 设置命令行参数（在 run 之前调用），参数会覆盖配置文件中的对应设置
+     * @param argc main 函数的 argc
+     * @param argv main 函数的 argv
+     * @see Config::applyCommandLine
+     */
+    void setCommandLine(int argc, char* argv[]);
+    /// @brief 是否运行在无头模式（配置加载后才有效，场景设置函数中可以使用）
+    bool isHeadless() const;
 
     /// @name 禁用拷贝和移动
     /// @ {
@@ -106,6 +125,8 @@ private:
     void update(float deltaTime);   /// @brief 更新游戏状态
     void render();                  /// @brief 渲染游戏画面
     void close();                   /// @brief 关闭SDL窗口和渲染器，释放资源
+    void dumpProfile();             /// @brief 导出最近几秒的性能分析记录 (Chrome trace JSON，按 F9 触发)
+    void reportHeadlessStats(double elapsedSeconds) const; /// @brief 无头模式结束时输出模拟吞吐量与各子系统耗时
     /// @}
 
     /// @name 游戏组件管理
@@ -113,6 +134,7 @@ private:
     [[nodiscard]] bool initConfig();             /// @brief 初始化配置类
     [[nodiscard]] bool initWindow();             /// @brief 初始化SDL窗口
     [[nodiscard]] bool initTime();               /// @brief 初始化时间管理组件
+    [[nodiscard]] bool initJobSystem();          /// @brief 初始化任务系统（工作线程池）
     [[nodiscard]] bool initResourceManager();    /// @brief 初始化资源管理组件
     [[nodiscard]] bool initRenderer();           /// @brief 初始化渲染器组件
     [[nodiscard]] bool initCamera();             /// @brief 初始化相机组件
@@ -0,0 +1,229 @@
+#include "JobSystem.hpp"
+#include "../utils/Profiler.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <exception>
+#include <string>
+
+namespace engine::core {
+
+namespace {
+thread_local const JobSystem* t_ownerSystem = nullptr;   ///< @brief 当前工作线程所属的任务系统
+thread_local int t_workerIndex = -1;                      ///< @brief 当前工作线程的下标（非工作线程为 -1）
+} // namespace
+
+JobSystem::JobSystem(size_t workerCount) : m_mainThreadId(std::this_thread::get_id()) {
+    if (workerCount == 0) {
+        const size_t cores = std::thread::hardware_concurrency();
+        workerCount = cores > 1 ? cores - 1 : 1;    // 留一个核心给主线程
+    }
+    m_queues.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; ++i) {
+        m_queues.push_back(std::make_unique<WorkerQueue>());
+    }
+    m_workers.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; ++i) {
+        m_workers.emplace_back(&JobSystem::workerLoop, this, i);
+    }
+    spdlog::trace("JOBSYSTEM::启动 {} 个工作线程", workerCount);
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard lock(m_sleepMutex);
+        m_isStopping = true;
+    }
+    m_sleepCondition.notify_all();
+    for (auto& worker : m_workers) {
+        worker.join();
+    }
+    if (!m_mainThreadTasks.empty()) {
+        spdlog::warn("JOBSYSTEM::丢弃 {} 个未执行的主线程任务", m_mainThreadTasks.size());
+    }
+    spdlog::trace("JOBSYSTEM::工作线程已退出");
+}
+
+void JobSystem::schedule(Job job, JobCounter* counter) {
+    if (counter) counter->m_count.fetch_add(1, std::memory_order_relaxed);
+    push({std::move(job), counter});
+}
+
+void JobSystem::scheduleAfter(JobCounter& dependency, Job job, JobCounter* counter) {
+    // 提交时就计入自己的计数器，等待该计数器的人不会在任务真正开始前误以为已完成
+    if (counter) counter->m_count.fetch_add(1, std::memory_order_relaxed);
+    addWaiter(dependency, {std::move(job), counter, false});
+}
+
+void JobSystem::parallelFor(size_t count, size_t grainSize, const RangeJob& job) {
+    if (count == 0) return;
+    if (grainSize == 0) {
+        const size_t threads = getWorkerCount() + 1;    // 调用线程也参与
+        grainSize = (count + threads - 1) / threads;
+    }
+    if (count <= grainSize) {
+        job(0, count);
+        return;
+    }
+    JobCounter counter;
+    // 第一段留给调用线程，其余分发到工作线程
+    for (size_t begin = grainSize; begin < count; begin += grainSize) {
+        const size_t end = std::min(count, begin + grainSize);
+        schedule([&job, begin, end] { job(begin, end); }, &counter);
+    }
+    job(0, grainSize);
+    wait(counter);
+}
+
+void JobSystem::wait(JobCounter& counter) {
+    Task task;
+    while (!counter.isDone()) {
+        if (tryPop(task)) {
+            execute(task);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    // 完成最后一个任务的线程在持有计数器的锁时才会令其归零，加锁一次确保它已不再访问计数器
+    std::lock_guard lock(counter.m_mutex);
+}
+
+void JobSystem::runOnMainThread(Job job, JobCounter* counter) {
+    if (counter) counter->m_count.fetch_add(1, std::memory_order_relaxed);
+    pushMainThread({std::move(job), counter});
+}
+
+void JobSystem::runOnMainThreadAfter(JobCounter& dependency, Job job, JobCounter* counter) {
+    if (counter) counter->m_count.fetch_add(1, std::memory_order_relaxed);
+    addWaiter(dependency, {std::move(job), counter, true});
+}
+
+void JobSystem::update() {
+    std::vector<Task> tasks;
+    {
+        std::lock_guard lock(m_mainThreadMutex);
+        tasks.swap(m_mainThreadTasks);
+    }
+    // 执行期间新提交的主线程任务留到下一帧
+    for (auto& task : tasks) {
+        execute(task);
+    }
+}
+
+void JobSystem::workerLoop(size_t index) {
+    t_ownerSystem = this;
+    t_workerIndex = static_cast<int>(index);
+    SL_PROFILE_THREAD_NAME("Worker " + std::to_string(index));
+    Task task;
+    while (true) {
+        if (tryPop(task)) {
+            execute(task);
+            continue;
+        }
+        std::unique_lock lock(m_sleepMutex);
+        m_sleepCondition.wait(lock, [this] { return m_isStopping || m_queuedJobs.load(std::memory_order_acquire) > 0; });
+        if (m_isStopping && m_queuedJobs.load(std::memory_order_acquire) == 0) return;   // 已提交的任务执行完才退出
+    }
+}
+
+void JobSystem::push(Task task) {
+    // 工作线程提交到自己的队列，其他线程轮流分配
+    const size_t index = (t_ownerSystem == this)
+        ? static_cast<size_t>(t_workerIndex)
+        : m_nextQueue.fetch_add(1, std::memory_order_relaxed) % m_queues.size();
+    {
+        std::lock_guard lock(m_queues[index]->mutex);
+        m_queues[index]->tasks.push_back(std::move(task));
+    }
+    m_queuedJobs.fetch_add(1, std::memory_order_release);
+    {
+        std::lock_guard lock(m_sleepMutex);     // 避免与正在进入休眠的工作线程错过通知
+    }
+    m_sleepCondition.notify_one();
+}
+
+void JobSystem::pushMainThread(Task task) {
+    std::lock_guard lock(m_mainThreadMutex);
+    m_mainThreadTasks.push_back(std::move(task));
+}
+
+bool JobSystem::tryPop(Task& task) {
+    const size_t queueCount = m_queues.size();
+    const bool isWorker = t_ownerSystem == this;
+    // 1. 自己的队列：从尾部取最近提交的任务
+    if (isWorker) {
+        auto& queue = *m_queues[t_workerIndex];
+        std::lock_guard lock(queue.mutex);
+        if (!queue.tasks.empty()) {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+            m_queuedJobs.fetch_sub(1, std::memory_order_acq_rel);
+            return true;
+        }
+    }
+    // 2. 从其他队列的头部窃取
+    const size_t start = isWorker ? static_cast<size_t>(t_workerIndex) + 1 : 0;
+    for (size_t i = 0; i < queueCount; ++i) {
+        auto& queue = *m_queues[(start + i) % queueCount];
+        std::lock_guard lock(queue.mutex);
+        if (!queue.tasks.empty()) {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            m_queuedJobs.fetch_sub(1, std::memory_order_acq_rel);
+            return true;
+        }
+    }
+    return false;
+}
+
+void JobSystem::execute(Task& task) {
+    SL_PROFILE_ZONE("JobSystem::job");
+    try {
+        task.job();
+    } catch (const std::exception& e) {
+        spdlog::error("JOBSYSTEM::execute::任务抛出异常: {}", e.what());
+    } catch (...) {
+        // 非 std::exception 的异常也不能逃出工作线程，否则计数器永远不会归零
+        spdlog::error("JOBSYSTEM::execute::任务抛出未知异常");
+    }
+    task.job = nullptr;     // 尽早释放任务捕获的资源
+    finish(task.counter);
+}
+
+void JobSystem::addWaiter(JobCounter& dependency, JobCounter::Waiter waiter) {
+    {
+        std::lock_guard lock(dependency.m_mutex);
+        if (!dependency.isDone()) {
+            dependency.m_waiters.push_back(std::move(waiter));
+            return;
+        }
+    }
+    // 依赖已完成，直接提交
+    if (waiter.isMainThread) {
+        pushMainThread({std::move(waiter.job), waiter.counter});
+    } else {
+        push({std::move(waiter.job), waiter.counter});
+    }
+}
+
+void JobSystem::finish(JobCounter* counter) {
+    if (!counter) return;
+    std::vector<JobCounter::Waiter> waiters;
+    {
+        // 在锁内归零并取走等待的任务：addWaiter 看到未归零时，任务一定会在这里被取走
+        std::lock_guard lock(counter->m_mutex);
+        if (counter->m_count.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+        waiters.swap(counter->m_waiters);
+    }
+    // 此后不再访问 counter（等待者可能已将其销毁）
+    for (auto& waiter : waiters) {
+        if (waiter.isMainThread) {
+            pushMainThread({std::move(waiter.job), waiter.counter});
+        } else {
+            push({std::move(waiter.job), waiter.counter});
+        }
+    }
+}
+
+} // namespace engine::core
@@ -0,0 +1,176 @@
+/**
+ * @file JobSystem.hpp
+ * @brief 任务系统：工作窃取线程池，提供并行 for、任务依赖（计数器）以及主线程延续任务
+ */
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace engine::core {
+class JobSystem;
+
+/**
+ * @class JobCounter
+ * @brief 任务计数器：记录关联的任务中尚未完成的数量
+ *
+ * 提交任务时传入计数器，计数器加一；任务执行完毕后减一。
+ * 计数器归零即表示这批任务全部完成，可用于 JobSystem::wait 等待，
+ * 或通过 JobSystem::scheduleAfter / runOnMainThreadAfter 让后续任务在其完成后才开始。
+ * @note 计数器必须比关联的任务活得更久
+ */
+class JobCounter final {
+    friend class JobSystem;
+
+    /// @brief 等待计数器归零后才提交的任务
+    struct Waiter {
+        std::function<void()> job;          ///< @brief 任务
+        JobCounter* counter = nullptr;      ///< @brief 该任务自己的计数器（可为空）
+        bool isMainThread = false;          ///< @brief 是否在主线程执行
+    };
+
+    std::atomic<int> m_count = 0;           ///< @brief 未完成的任务数
+    std::mutex m_mutex;                     ///< @brief 保护 m_waiters
+    std::vector<Waiter> m_waiters;          ///< @brief 依赖本计数器的任务
+
+public:
+    JobCounter() = default;
+
+    /// @name 禁止拷贝和移动
+    /// @{
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+    JobCounter(JobCounter&&) = delete;
+    JobCounter& operator=(JobCounter&&) = delete;
+    /// @}
+
+    bool isDone() const { return m_count.load(std::memory_order_acquire) == 0; }   ///< @brief 关联的任务是否全部完成
+    int getCount() const { return m_count.load(std::memory_order_acquire); }       ///< @brief 未完成的任务数
+};
+
+/**
+ * @class JobSystem
+ * @brief 工作窃取线程池，由 Game 持有，通过 Context::getJobSystem 访问
+ *
+ * 每个工作线程有自己的任务队列：工作线程提交的任务放入自己的队列尾部并从尾部取出（缓存友好），
+ * 自己的队列为空时从其他线程的队列头部“窃取”任务；其他线程（如主线程）提交的任务轮流分配到各队列。
+ * 需要访问 SDL 渲染器等只能在主线程使用的资源时，用 runOnMainThread 提交延续任务，
+ * 它们在主线程调用 update 时执行。
+ */
+class JobSystem final {
+public:
+    using Job = std::function<void()>;
+    using RangeJob = std::function<void(size_t begin, size_t end)>;     ///< @brief 并行 for 的任务，处理 [begin, end)
+
+private:
+    /// @brief 队列中的任务
+    struct Task {
+        Job job;                            ///< @brief 任务
+        JobCounter* counter = nullptr;      ///< @brief 任务完成后需要减一的计数器（可为空）
+    };
+
+    /// @brief 一个工作线程的任务队列
+    struct WorkerQueue {
+        std::mutex mutex;                   ///< @brief 保护 tasks
+        std::deque<Task> tasks;             ///< @brief 任务（所有者从尾部取，窃取者从头部取）
+    };
+
+    std::vector<std::unique_ptr<WorkerQueue>> m_queues;    ///< @brief 各工作线程的任务队列
+    std::vector<std::thread> m_workers;                    ///< @brief 工作线程
+    std::atomic<size_t> m_nextQueue = 0;                   ///< @brief 外部线程提交任务时轮流选择的队列
+    std::atomic<int> m_queuedJobs = 0;                     ///< @brief 所有队列中的任务总数
+    std::mutex m_sleepMutex;                               ///< @brief 配合 m_sleepCondition 使用
+    std::condition_variable m_sleepCondition;              ///< @brief 有新任务或需要退出时唤醒空闲的工作线程
+    std::atomic<bool> m_isStopping = false;                ///< @brief 是否正在退出
+
+    std::mutex m_mainThreadMutex;                          ///< @brief 保护 m_mainThreadTasks
+    std::vector<Task> m_mainThreadTasks;                   ///< @brief 等待在主线程执行的任务
+    std::thread::id m_mainThreadId;                        ///< @brief 主线程（创建 JobSystem 的线程）
+
+public:
+    /**
+     * @brief 构造函数，启动工作线程
+     * @param workerCount 工作线程数量，0 表示 CPU 核心数 - 1（至少 1 个）
+     */
+    explicit JobSystem(size_t workerCount = 0);
+    ~JobSystem();   ///< @brief 执行完已提交的任务后退出工作线程
+
+    /// @name 禁止拷贝和移动
+    /// @{
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+    JobSystem(JobSystem&&) = delete;
+    JobSystem& operator=(JobSystem&&) = delete;
+    /// @}
+
+    /**
+     * @brief 提交任务到工作线程
+     * @param job 任务
+     * @param counter 任务计数器（可为空），提交时加一、任务完成后减一
+     */
+    void schedule(Job job, JobCounter* counter = nullptr);
+    /**
+     * @brief 提交依赖其他任务的任务：dependency 归零后才会被执行
+     * @param dependency 依赖的任务计数器（已归零时立即提交）
+     * @param job 任务
+     * @param counter 该任务自己的计数器（可为空）
+     */
+    void scheduleAfter(JobCounter& dependency, Job job, JobCounter* counter = nullptr);
+    /**
+     * @brief 并行执行 [0, count) 范围内的任务，返回时全部完成
+     * @param count 元素数量
+     * @param grainSize 每个任务处理的元素数量（为 0 时按线程数平均分配）
+     * @param job 处理 [begin, end) 的任务，会在多个线程上同时调用
+     * @note 调用线程也会参与执行；count 不超过 grainSize 时直接在调用线程执行
+     */
+    void parallelFor(size_t count, size_t grainSize, const RangeJob& job);
+    /**
+     * @brief 等待计数器归零，等待期间调用线程会执行队列中的任务
+     * @note 主线程延续任务不会在这里执行，不要在主线程等待依赖主线程延续任务的计数器
+     * @note 销毁计数器前应先对其调用 wait（仅检查 isDone 不够，完成任务的线程可能仍在访问计数器）
+     */
+    void wait(JobCounter& counter);
+
+    /**
+     * @brief 提交只能在主线程执行的任务，在下一次 update 时执行
+     * @param job 任务
+     * @param counter 任务计数器（可为空）
+     */
+    void runOnMainThread(Job job, JobCounter* counter = nullptr);
+    /**
+     * @brief 提交主线程延续任务：dependency 归零后，在主线程的 update 中执行
+     * @param dependency 依赖的任务计数器
+     * @param job 任务
+     * @param counter 该任务自己的计数器（可为空）
+     */
+    void runOnMainThreadAfter(JobCounter& dependency, Job job, JobCounter* counter = nullptr);
+    /// @brief 执行已就绪的主线程任务（每帧在主线程调用一次）
+    void update();
+
+    size_t getWorkerCount() const { return m_workers.size(); }          ///< @brief 工作线程数量
+    bool isMainThread() const { return std::this_thread::get_id() == m_mainThreadId; }  ///< @brief 当前是否在主线程
+
+private:
+    void workerLoop(size_t index);              ///< @brief 工作线程主循环
+    void push(Task task);                       ///< @brief 把任务放入某个工作线程的队列
+    void pushMainThread(Task task);             ///< @brief 把任务放入主线程队列
+    /**
+     * @brief 取出一个任务：先取自己的队列（工作线程），再从其他队列窃取
+     * @param task 输出的任务
+     * @return 是否取到任务
+     */
+    bool tryPop(Task& task);
+    void execute(Task& task);                   ///< @brief 执行任务并更新其计数器
+    /// @brief 把等待中的任务加入计数器，计数器已归零时直接提交
+    void addWaiter(JobCounter& dependency, JobCounter::Waiter waiter);
+    /// @brief 任务完成后计数器减一，归零时提交依赖它的任务
+    void finish(JobCounter* counter);
+};
+
+} // namespace engine::core
@@ -3,6 +3,8 @@
 #include <SDL3/SDL_Timer.h>
 #include <spdlog/spdlog.h>
 
+#include <cmath>
+
 namespace engine::core {
 
 Time::Time() {
@@ -14,8 +16,7 @@ Time::Time() {
 Time::Time(int fps) {
     m_endTime = SDL_GetTicksNS();
     m_startTime = m_endTime;
-    m_targrtFPS = fps;
-    m_targetFrameTime = 1.0f / fps;
+    setTargetFPS(fps);
     m_timeScale = 1.0;
 }
 
@@ -24,22 +25,46 @@ Time::~Time() {
 }
 
 void Time::update() {
+    if (m_syntheticDeltaTime > 0.0) {
+        // 合成时间：每帧时间间隔固定，与真实耗时无关，也不限制帧率（结果可重现）
+        m_deltaTime = m_syntheticDeltaTime;
+        return;
+    }
     m_startTime = SDL_GetTicksNS();
     auto currentDeltaTime = static_cast<double>(m_startTime - m_endTime) / 1000000000.0; // 计算当前帧时间
+    m_deltaTime = currentDeltaTime;
     if (currentDeltaTime > 0.0) {
         limitFrameRate(static_cast<float>(currentDeltaTime)); // 如果设置了帧率限制，则限制帧率
-    } else {
-        m_deltaTime = currentDeltaTime; // 如果当前帧时间小于0，则直接使用当前帧时间
     }
     m_endTime = SDL_GetTicksNS(); // 更新结束时间
 }
 
+int Time::consumeFixedSteps() {
+    if (!m_fixedTimestep) {
+        m_alpha = 1.0;
+        return 1;
+    }
+    m_accumulator += getDeltaTime();
+    int steps = static_cast<int>(m_accumulator / m_fixedDeltaTime);
+    if (steps > m_maxCatchUpSteps) {
+        // 积压太多（例如窗口被拖动、断点调试），只追赶有限次数，丢弃剩余的积压时间
+        spdlog::debug("TIME::consumeFixedSteps::需要 {} 次逻辑更新, 超过上限 {}, 丢弃积压时间", steps, m_maxCatchUpSteps);
+        steps = m_maxCatchUpSteps;
+        m_accumulator = std::fmod(m_accumulator, m_fixedDeltaTime);
+    } else {
+        m_accumulator -= steps * m_fixedDeltaTime;
+    }
+    m_alpha = m_accumulator / m_fixedDeltaTime;
+    return steps;
+}
+
 void Time::limitFrameRate(float currentDeltaTime) {
     if (currentDeltaTime < m_targetFrameTime) {
         double timeToWait = m_targetFrameTime - currentDeltaTime;
         Uint64 nsToWait = static_cast<Uint64>(timeToWait * 1000000000.0);
         SDL_DelayNS(nsToWait);
-        m_deltaTime = static_cast<double>(SDL_GetTicksNS() - m_startTime) / 1000000000.0;
+        // 帧时间 = 上一帧结束到等待结束的完整时间
+        m_deltaTime = static_cast<double>(SDL_GetTicksNS() - m_endTime) / 1000000000.0;
     }
 }
 
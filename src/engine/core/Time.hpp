@@ -24,6 +24,17 @@ private:
     /// @{
     int    m_targrtFPS       = 60;    ///< @brief 目标帧率
     double m_targetFrameTime = 0.0;  ///< @brief 帧时间
+    double m_syntheticDeltaTime = 0.0;  ///< @brief 合成时间间隔（大于 0 时每帧固定使用该值且不等待，用于无头模式）
+    /// @}
+
+    /// @brief 固定时间步长相关
+    /// @{
+    bool   m_fixedTimestep   = false;         ///< @brief 是否启用固定时间步长
+    double m_fixedDeltaTime  = 1.0 / 60.0;    ///< @brief 每次逻辑更新的时间步长（秒）
+    int    m_maxCatchUpSteps = 5;             ///< @brief 单帧最多执行的逻辑更新次数
+    double m_accumulator     = 0.0;           ///< @brief 尚未被逻辑更新消耗的时间（秒）
+    double m_alpha           = 1.0;           ///< @brief 渲染插值系数 [0, 1)，= 累加器剩余时间 / 步长
+    Uint64 m_tickCount       = 0;             ///< @brief 已执行的逻辑更新次数
     /// @}
 
 public:
@@ -42,15 +53,32 @@ public:
     /// @brief 更新时间
     void update();
 
+    /**
+     * @brief 把本帧时间累加到累加器中，并计算本帧需要执行的固定步数（仅固定时间步长模式下使用）
+     * @return 本帧需要执行的逻辑更新次数（不超过最大追赶次数，超出的积压时间会被丢弃）
+     * @note 同时更新渲染插值系数，可通过 getAlpha() 获取
+     */
+    int consumeFixedSteps();
+    /// @brief 开始一次逻辑更新（逻辑更新计数 +1），每次调用场景更新前调用
+    void advanceTick() { ++m_tickCount; }
+
     /// @name setters / getters
     /// @{
-    void setTargetFPS(int fps) { m_targrtFPS = fps; m_targetFrameTime = 1.0f / fps; }
+    void setTargetFPS(int fps) { m_targrtFPS = fps; m_targetFrameTime = fps > 0 ? 1.0 / fps : 0.0; }
     void setTimeScale(double scale) { m_timeScale = scale; }
+    void setFixedTimestep(bool enabled) { m_fixedTimestep = enabled; m_accumulator = 0.0; m_alpha = 1.0; }
+    void setTickRate(int tickRate) { if (tickRate > 0) m_fixedDeltaTime = 1.0 / tickRate; }
+    void setMaxCatchUpSteps(int steps) { m_maxCatchUpSteps = steps > 0 ? steps : 1; }
+    void setSyntheticDeltaTime(double deltaTime) { m_syntheticDeltaTime = deltaTime > 0.0 ? deltaTime : 0.0; }  ///< @brief 设置合成时间间隔（0 表示使用真实时间）
 
     double getDeltaTime() const { return m_deltaTime * m_timeScale; }
     double getUnscaledDeltaTime() const { return m_deltaTime; }
     double getTimeScale() const { return m_timeScale; }
     double getFrameTime() const { return m_targetFrameTime; }
+    bool isFixedTimestep() const { return m_fixedTimestep; }
+    double getFixedDeltaTime() const { return m_fixedDeltaTime; }
+    double getAlpha() const { return m_alpha; }
+    Uint64 getTickCount() const { return m_tickCount; }
     /// @}
 
 private:
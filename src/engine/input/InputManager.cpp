@@ -1,5 +1,6 @@
 #include "InputManager.hpp"
 #include "../core/Config.hpp"
+#include "../utils/Profiler.hpp"
 
 #include <spdlog/spdlog.h>
 
@@ -23,6 +24,7 @@ InputManager::InputManager(SDL_Renderer *SDLRenderer, const engine::core::Config
 }
 
 void InputManager::update() {
+    SL_PROFILE_ZONE("InputManager::update");
     // 1. 根据上一帧的值更新默认的动作状态
     for (auto& [actionName, state] : m_actionStates) {
         if (state == ActionState::PRESSED_THIS_FRAME) {
@@ -183,6 +185,10 @@ Uint32 InputManager::mouseButtonFromString(std::string_view buttonName) {
     return 0; // 0 不是有效的按钮值，表示无效
 }
 
+void InputManager::injectAction(std::string_view actionName, bool isPressed) {
+    updateActionState(actionName, isPressed, false);
+}
+
 void InputManager::updateActionState(std::string_view actionName, bool isInputActive, bool isRepeatEvent) {
     auto it = m_actionStates.find(std::string(actionName));
     if (it == m_actionStates.end()) {
@@ -109,6 +109,15 @@ public:
      * @note 此方法不会消耗动作状态，可以安全地多次调用
      */
     bool isActionReleased(std::string_view actionName) const;    ///< @brief 动作是否在本帧刚刚释放
+    /**
+     * @brief 直接设置动作的按下/释放（不经过 SDL 事件），用于回放输入脚本
+     * 
+     * @param actionName 动作名称（必须已在输入映射中注册）
+     * @param isPressed true 为按下，false 为释放
+     * 
+     * @note 需在本帧的 update() 之后调用，效果与真实按键相同
+     */
+    void injectAction(std::string_view actionName, bool isPressed);
     /// @}
 
 
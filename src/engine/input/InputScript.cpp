@@ -0,0 +1,57 @@
+#include "InputScript.hpp"
+#include "InputManager.hpp"
+
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+namespace engine::input {
+
+bool InputScript::loadFromFile(std::string_view path) {
+    std::ifstream file{std::filesystem::path(path)};
+    if (!file.is_open()) {
+        spdlog::error("INPUTSCRIPT::loadFromFile::无法打开输入脚本: {}", path);
+        return false;
+    }
+    m_events.clear();
+    m_nextEvent = 0;
+    try {
+        nlohmann::json json;
+        file >> json;
+        if (!json.is_array()) {
+            spdlog::error("INPUTSCRIPT::loadFromFile::输入脚本必须是 JSON 数组: {}", path);
+            return false;
+        }
+        for (const auto& eventJson : json) {
+            Event event;
+            event.frame = eventJson.value("frame", std::uint64_t{0});
+            event.action = eventJson.value("action", "");
+            event.isPressed = eventJson.value("pressed", true);
+            if (event.action.empty()) {
+                spdlog::warn("INPUTSCRIPT::loadFromFile::忽略缺少 'action' 的事件: {}", eventJson.dump());
+                continue;
+            }
+            m_events.push_back(std::move(event));
+        }
+    } catch (const std::exception& e) {
+        spdlog::error("INPUTSCRIPT::loadFromFile::解析输入脚本失败: {} : {}", path, e.what());
+        m_events.clear();
+        return false;
+    }
+    // 同一帧内保持脚本中的先后顺序
+    std::stable_sort(m_events.begin(), m_events.end(), [](const Event& a, const Event& b) { return a.frame < b.frame; });
+    spdlog::info("INPUTSCRIPT::loadFromFile::加载输入脚本: {} ({} 个事件)", path, m_events.size());
+    return true;
+}
+
+void InputScript::apply(std::uint64_t frame, InputManager& inputManager) {
+    while (m_nextEvent < m_events.size() && m_events[m_nextEvent].frame <= frame) {
+        const auto& event = m_events[m_nextEvent++];
+        inputManager.injectAction(event.action, event.isPressed);
+    }
+}
+
+} // namespace engine::input
@@ -0,0 +1,49 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace engine::input {
+class InputManager;
+
+/**
+ * @class InputScript
+ * @brief 按帧回放的输入脚本（无头模式下代替键盘与鼠标）
+ *
+ * 脚本为 JSON 数组，每一项描述某一帧按下或释放某个动作，例如：
+ *     [ {"frame": 0,  "action": "move_right", "pressed": true},
+ *       {"frame": 30, "action": "jump",       "pressed": true},
+ *       {"frame": 31, "action": "jump",       "pressed": false} ]
+ * 动作名称与配置文件中 input_mappings 的键相同。
+ */
+class InputScript final {
+    /// @brief 脚本中的一个事件
+    struct Event {
+        std::uint64_t frame = 0;    ///< @brief 触发的帧序号（从 0 开始）
+        std::string action;         ///< @brief 动作名称
+        bool isPressed = true;      ///< @brief 按下还是释放
+    };
+
+    std::vector<Event> m_events;    ///< @brief 按帧序号排序的事件
+    size_t m_nextEvent = 0;         ///< @brief 下一个待回放的事件
+
+public:
+    InputScript() = default;
+
+    /**
+     * @brief 从 JSON 文件加载脚本
+     * @param path 脚本文件路径
+     * @return 是否加载成功
+     */
+    [[nodiscard]] bool loadFromFile(std::string_view path);
+    /**
+     * @brief 回放指定帧的所有事件（每帧在 InputManager::update 之后调用一次）
+     * @param frame 当前帧序号
+     * @param inputManager 接收事件的输入管理器
+     */
+    void apply(std::uint64_t frame, InputManager& inputManager);
+    bool isFinished() const { return m_nextEvent >= m_events.size(); }    ///< @brief 是否已回放完所有事件
+};
+
+} // namespace engine::input
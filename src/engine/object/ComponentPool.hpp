@@ -0,0 +1,107 @@
+#pragma once
+#include "../component/Component.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace engine::object {
+
+/**
+ * @brief 单一组件类型的对象池：同类型组件按块连续存放，地址在组件存活期间保持不变。
+ *
+ * 所有 GameObject 的 T 组件都从 ComponentPool<T>::get() 分配，因此按类型批量更新时访问的是相邻内存。
+ * 释放的槽位进入空闲链表供后续复用，块内存直到程序退出才归还系统（关卡切换不会反复申请内存）。
+ *
+ * @note 只在主线程创建和销毁组件（与 GameObject 的使用方式一致），不加锁。
+ */
+template <typename T>
+class ComponentPool final {
+    static constexpr size_t CHUNK_SIZE = 64;                ///< @brief 每块容纳的组件数量
+
+    /// @brief 一个组件大小的未初始化存储
+    struct Slot {
+        alignas(T) std::byte storage[sizeof(T)];
+    };
+
+    std::vector<std::unique_ptr<Slot[]>> m_chunks;          ///< @brief 已分配的块
+    std::vector<Slot*> m_freeSlots;                         ///< @brief 空闲槽位（栈顶为下一个分配的槽位）
+    size_t m_liveCount = 0;                                 ///< @brief 存活的组件数量
+
+    ComponentPool() = default;
+
+public:
+    /// @name 禁止拷贝和移动
+    /// @{
+    ComponentPool(const ComponentPool&) = delete;
+    ComponentPool& operator=(const ComponentPool&) = delete;
+    ComponentPool(ComponentPool&&) = delete;
+    ComponentPool& operator=(ComponentPool&&) = delete;
+    /// @}
+
+    /// @brief 获取 T 类型的全局对象池
+    static ComponentPool& get() {
+        static ComponentPool pool;
+        return pool;
+    }
+
+    /**
+     * @brief 在池中构造一个组件
+     * @param args 组件构造函数参数
+     * @return 组件指针（构造函数抛出异常时槽位会归还，异常继续向外传播）
+     */
+    template <typename... Args>
+    T* create(Args&&... args) {
+        if (m_freeSlots.empty()) grow();
+        Slot* slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+        try {
+            T* component = ::new (static_cast<void*>(slot->storage)) T(std::forward<Args>(args)...);
+            ++m_liveCount;
+            return component;
+        } catch (...) {
+            m_freeSlots.push_back(slot);
+            throw;
+        }
+    }
+
+    /// @brief 析构组件并归还槽位
+    void destroy(T* component) {
+        if (!component) return;
+        component->~T();
+        m_freeSlots.push_back(reinterpret_cast<Slot*>(component));
+        --m_liveCount;
+    }
+
+    /// @brief 供 ComponentDeleter 使用的类型擦除版本
+    static void destroyComponent(engine::component::Component* component) {
+        get().destroy(static_cast<T*>(component));
+    }
+
+    size_t getLiveCount() const { return m_liveCount; }                         ///< @brief 存活的组件数量
+    size_t getCapacity() const { return m_chunks.size() * CHUNK_SIZE; }         ///< @brief 已分配的槽位总数
+
+private:
+    void grow() {
+        auto& chunk = m_chunks.emplace_back(std::make_unique<Slot[]>(CHUNK_SIZE));
+        // 逆序压栈，使分配顺序与块内地址顺序一致
+        for (size_t i = CHUNK_SIZE; i > 0; --i) {
+            m_freeSlots.push_back(&chunk[i - 1]);
+        }
+    }
+};
+
+/**
+ * @brief GameObject 组件槽位使用的删除器：把组件归还给创建它的对象池
+ */
+struct ComponentDeleter {
+    void (*destroy)(engine::component::Component*) = nullptr;   ///< @brief 对应 ComponentPool<T>::destroyComponent
+
+    void operator()(engine::component::Component* component) const {
+        if (component && destroy) destroy(component);
+    }
+};
+
+} // namespace engine::object
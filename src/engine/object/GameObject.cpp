@@ -3,6 +3,8 @@
 #include "../render/Camera.hpp"
 #include "../input/InputManager.hpp"
 
+#include <algorithm>
+
 namespace engine::object {
 
 GameObject::GameObject(std::string_view name, std::string_view tag): m_name(name), m_tag(tag) {
@@ -13,32 +15,51 @@ GameObject::GameObject(std::string_view name, std::string_view tag): m_name(name
 /// @{
 void GameObject::update(float deltaTime, engine::core::Context &context) {
     // 遍历所有组件并调用它们的 update 方法
-    for (auto& pair : m_components) {
-        pair.second->update(deltaTime, context);
+    for (std::uint8_t i = 0; i < m_componentCount; ++i) {
+        m_components[m_componentOrder[i]]->update(deltaTime, context);
     }
 }
 
 void GameObject::render(engine::core::Context &context) {
     // 遍历所有组件并调用它们的 render 方法
-    for (auto& pair : m_components) {
-        pair.second->render(context);
+    for (std::uint8_t i = 0; i < m_componentCount; ++i) {
+        m_components[m_componentOrder[i]]->render(context);
     }
 }
 
 void GameObject::clean() {
     spdlog::trace("GAMEOBJECT::clean::清空 GameObject... {} {}", m_name, m_tag);
     // 遍历所有组件并调用它们的 clean 方法
-    for (auto& pair : m_components) {
-        pair.second->clean();
+    for (std::uint8_t i = 0; i < m_componentCount; ++i) {
+        m_components[m_componentOrder[i]]->clean();
+    }
+    for (auto& component : m_components) {
+        component.reset();  // unique_ptr 会自动释放内存
     }
-    m_components.clear(); // 清空 map, unique_ptr 会自动释放内存
+    m_componentCount = 0;
 }
 
 void GameObject::handleInput(engine::core::Context &context) {
     // 遍历所有组件并调用它们的 handleInput 方法
-    for (auto& pair : m_components) {
-        pair.second->handleInput(context);
+    for (std::uint8_t i = 0; i < m_componentCount; ++i) {
+        m_components[m_componentOrder[i]]->handleInput(context);
     }
 }
+
+bool GameObject::updateComponent(component::ComponentId id, float deltaTime, engine::core::Context &context) {
+    auto& component = m_components[id];
+    if (!component) return false;
+    component->update(deltaTime, context);
+    return true;
+}
 /// @}
+
+void GameObject::eraseFromOrder(component::ComponentId id) {
+    auto* begin = m_componentOrder.data();
+    auto* end = begin + m_componentCount;
+    auto* it = std::find(begin, end, id);
+    if (it == end) return;
+    std::copy(it + 1, end, it);
+    --m_componentCount;
+}
 } // namespace engine::object
\ No newline at end of file
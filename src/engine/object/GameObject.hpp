@@ -1,12 +1,16 @@
 #pragma once
 #include "../component/Component.hpp"
+#include "ComponentPool.hpp"
+#include "../utils/MemoryArena.hpp"
 
 #include <spdlog/spdlog.h>
 
+#include <array>
+#include <cstdint>
 #include <memory>
 #include <string>
-#include <unordered_map>
-#include <typeindex>
+#include <tuple>
+#include <typeinfo>
 #include <utility>
 
 namespace engine::core {
@@ -19,13 +23,23 @@ namespace engine::object {
  * @brief 游戏对象类，用于管理游戏中的实体对象
  * 该类使用组件模式管理功能，支持添加、获取、移除组件
  */
-class GameObject final {
+class GameObject final : public engine::utils::ArenaAllocated {
+public:
+    /// @brief 默认排序层：运行时创建的对象绘制在所有关卡图层之上
+    static constexpr int DEFAULT_SORT_LAYER = 1000;
+
 private:
     bool        m_needRemove = false; ///< @brief 延迟删除的标识，将来由场景类负责删除
     std::string m_name;               /// @brief 对象名称
     std::string m_tag;                /// @brief 对象标签
+    int         m_sortLayer = DEFAULT_SORT_LAYER; ///< @brief 渲染排序层（数值小的先绘制），关卡对象使用 Tiled 图层序号
     
-    std::unordered_map<std::type_index, std::unique_ptr<component::Component>> m_components; ///< @brief 组件列表
+    using ComponentPtr = std::unique_ptr<component::Component, ComponentDeleter>;
+
+    /// @brief 组件槽位：以组件编号 (T::COMPONENT_ID) 为下标，空槽为 nullptr；组件本身存放在 ComponentPool<T> 中
+    std::array<ComponentPtr, component::MAX_COMPONENTS> m_components;
+    std::array<component::ComponentId, component::MAX_COMPONENTS> m_componentOrder{}; ///< @brief 已添加组件的编号（按添加顺序，生命周期函数按此顺序调用）
+    std::uint8_t m_componentCount = 0;                                               ///< @brief 已添加的组件数量
 
 public:
     /**
@@ -48,9 +62,11 @@ public:
     void setName(std::string_view name) { m_name = name; }
     void setTag(std::string_view tag) { m_tag = tag; }
     void setNeedRemove(bool needRemove) { m_needRemove = needRemove; }
+    void setSortLayer(int sortLayer) { m_sortLayer = sortLayer; }
     std::string_view getName() const { return m_name; }
     std::string_view getTag() const { return m_tag; }
     bool isNeedRemove() const { return m_needRemove; }
+    int getSortLayer() const { return m_sortLayer; }
     /// @}
 
     /// @name 组件管理
@@ -68,19 +84,16 @@ public:
         /* static_assert(condition, message)：静态断言，在编译期检测，无任何性能影响 */
         /* std::is_base_of<Base, Derived>::value -- 判断 Base 类型是否是 Derived 类型的基类 */
         static_assert(std::is_base_of<engine::component::Component, T>::value, "GAMEOBJECT::addComponent::ERROR::T 必须继承自 Component");
-        // 获取类型标识。     
-        /* typeid(T) -- 用于获取一个表达式或类型的运行时类型信息 (RTTI), 返回 std::type_info& */
-        /* std::type_index -- 针对std::type_info对象的包装器，主要设计用来作为关联容器（如 std::map）的键。*/
-        auto typeIndex = std::type_index(typeid(T));
+        static_assert(component::HasComponentId<T>, "GAMEOBJECT::addComponent::ERROR::T 必须声明小于 MAX_COMPONENTS 的 COMPONENT_ID");
         // 如果组件已经存在，则直接返回组件指针
         if (hasComponent<T>()) {
             return getComponent<T>();
         }
-        // 如果不存在则创建组件     /* std::forward -- 用于实现完美转发。传递多个参数的时候使用...标识 */
-        auto newComponent = std::make_unique<T>(std::forward<Args>(args)...);
-        T* ptr = newComponent.get();                               // 先获取裸指针以便返回
-        newComponent->setOwner(this);                              // 设置组件的拥有者
-        m_components[typeIndex] = std::move(newComponent);         // 移动组件   （newComponent 变为空，不可再使用）
+        // 如果不存在则从对象池创建组件     /* std::forward -- 用于实现完美转发。传递多个参数的时候使用...标识 */
+        T* ptr = ComponentPool<T>::get().create(std::forward<Args>(args)...);
+        ptr->setOwner(this);                                       // 设置组件的拥有者
+        m_components[T::COMPONENT_ID] = ComponentPtr(ptr, ComponentDeleter{&ComponentPool<T>::destroyComponent});   // 放入对应槽位
+        m_componentOrder[m_componentCount++] = T::COMPONENT_ID;    // 记录添加顺序
         ptr->init();                                               // 初始化组件 （因此必须用ptr而不能用newComponent）
         spdlog::debug("GAMEOBJECT::addComponent::{} 添加组件 {}", m_name, typeid(T).name());
         return ptr;  
@@ -93,13 +106,9 @@ public:
     template <typename T>
     T *getComponent() const {
         static_assert(std::is_base_of<engine::component::Component, T>::value, "GAMEOBJECT::getComponent::ERROR::T 必须继承自 Component");
-        auto typeIndex = std::type_index(typeid(T));
-        auto it = m_components.find(typeIndex);
-        if (it != m_components.end()) {
-            // 返回unique_ptr的裸指针。(肯定是T类型, static_cast其实并无必要，但保留可以使我们意图更清晰)
-            return static_cast<T*>(it->second.get());
-        }
-        return nullptr;
+        static_assert(component::HasComponentId<T>, "GAMEOBJECT::getComponent::ERROR::T 必须声明小于 MAX_COMPONENTS 的 COMPONENT_ID");
+        // 槽位只会存放对应编号的组件，static_cast 是安全的
+        return static_cast<T*>(m_components[T::COMPONENT_ID].get());
     }
     /**
      * @brief 检查是否存在组件
@@ -109,7 +118,8 @@ public:
     template <typename T>
     bool hasComponent() const {
         static_assert(std::is_base_of<engine::component::Component, T>::value, "GAMEOBJECT::hasComponent::ERROR::T 必须继承自 Component");
-        return m_components.contains(std::type_index(typeid(T))); // contains方法为 C++20 新增
+        static_assert(component::HasComponentId<T>, "GAMEOBJECT::hasComponent::ERROR::T 必须声明小于 MAX_COMPONENTS 的 COMPONENT_ID");
+        return m_components[T::COMPONENT_ID] != nullptr;
     }
     /**
      * @brief 移除组件
@@ -118,11 +128,12 @@ public:
     template <typename T>
     void removeComponent() {
         static_assert(std::is_base_of<engine::component::Component, T>::value, "GAMEOBJECT::removeComponent::ERROR::T 必须继承自 Component");
-        auto typeIndex = std::type_index(typeid(T));
-        auto it = m_components.find(typeIndex);
-        if (it != m_components.end()) {
-            it->second->clean();
-            m_components.erase(it);
+        static_assert(component::HasComponentId<T>, "GAMEOBJECT::removeComponent::ERROR::T 必须声明小于 MAX_COMPONENTS 的 COMPONENT_ID");
+        auto& slot = m_components[T::COMPONENT_ID];
+        if (slot) {
+            slot->clean();
+            slot.reset();
+            eraseFromOrder(T::COMPONENT_ID);
         }
     }
     /// @}
@@ -133,7 +144,32 @@ public:
     void update(float deltaTime, engine::core::Context &context);    /// @brief 更新游戏对象
     void render(engine::core::Context &context);    /// @brief 渲染游戏对象
     void clean();    /// @brief 清理游戏对象
+    /**
+     * @brief 只更新指定编号的组件（供场景按组件类型批量更新）
+     * @param id 组件编号
+     * @return 该组件是否存在
+     */
+    bool updateComponent(component::ComponentId id, float deltaTime, engine::core::Context &context);
     /// @}
+
+private:
+    void eraseFromOrder(component::ComponentId id);    ///< @brief 从添加顺序中移除组件编号（保持其余组件的相对顺序）
 };
 
+/**
+ * @brief 遍历同时拥有 Ts... 所有组件、且未标记删除的游戏对象
+ * @param objects 游戏对象容器（元素为 GameObject 的智能指针或裸指针）
+ * @param fn 回调，参数为 (GameObject&, Ts&...)
+ */
+template <typename... Ts, typename Range, typename Fn>
+void forEachWith(Range& objects, Fn&& fn) {
+    for (auto& object : objects) {
+        if (!object || object->isNeedRemove()) continue;
+        const std::tuple<Ts*...> components{object->template getComponent<Ts>()...};
+        if ((std::get<Ts*>(components) && ...)) {
+            fn(*object, *std::get<Ts*>(components)...);
+        }
+    }
+}
+
 } // namespace engine::object
@@ -0,0 +1,126 @@
+#pragma once
+#include "Collider.hpp"
+
+#include <glm/vec2.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace engine::component {
+    class PhysicsComponent;
+    class TransformComponent;
+    class ColliderComponent;
+}
+
+namespace engine::object {
+    class GameObject;
+}
+
+namespace engine::physics {
+
+/**
+ * @brief 物理体的状态标志位（BodyStore::flags）
+ */
+enum BodyFlags : std::uint8_t {
+    BODY_ENABLED         = 1 << 0,     ///< @brief PhysicsComponent 已启用
+    BODY_USE_GRAVITY     = 1 << 1,     ///< @brief 受重力影响
+    BODY_HAS_COLLIDER    = 1 << 2,     ///< @brief 拥有 ColliderComponent 且尺寸有效
+    BODY_COLLIDER_ACTIVE = 1 << 3,     ///< @brief 碰撞器已激活
+    BODY_TRIGGER         = 1 << 4,     ///< @brief 碰撞器为触发器
+    BODY_SOLID           = 1 << 5,     ///< @brief 标签为 "solid" 的物体
+    BODY_ASLEEP          = 1 << 6,     ///< @brief 本次更新开始时处于休眠状态
+};
+
+/**
+ * @brief 物理体的碰撞状态标志位（BodyStore::contacts），与 PhysicsComponent 的碰撞标志一一对应
+ */
+enum ContactFlags : std::uint8_t {
+    CONTACT_BELOW      = 1 << 0,
+    CONTACT_ABOVE      = 1 << 1,
+    CONTACT_LEFT       = 1 << 2,
+    CONTACT_RIGHT      = 1 << 3,
+    CONTACT_LADDER     = 1 << 4,
+    CONTACT_TOP_LADDER = 1 << 5,
+};
+
+/**
+ * @brief 以“结构体数组”(SoA) 方式紧凑存放所有注册物理体的数据，供 PhysicsEngine 的热循环使用。
+ *
+ * - 持久数据（组件指针）在注册时填充，注销时按顺序移除（保持下标顺序与注册顺序一致）。
+ * - 每步数据（位置、速度、力、包围盒等）在每次 update 开始时从组件中一次性读取，
+ *   所有物理计算只读写这些连续数组，update 结束时再一次性写回组件。
+ */
+struct BodyStore {
+    /// @name 持久数据（注册时填充）
+    /// @{
+    std::vector<engine::component::PhysicsComponent*> components;   ///< @brief 物理组件（非拥有）
+    std::vector<engine::object::GameObject*> owners;                ///< @brief 所属 GameObject（非拥有）
+    std::vector<engine::component::TransformComponent*> transforms; ///< @brief 变换组件缓存（非拥有）
+    std::vector<engine::component::ColliderComponent*> colliders;   ///< @brief 碰撞器组件缓存（非拥有，可能为 nullptr）
+    /// @}
+
+    /// @name 休眠状态（跨帧保留）
+    /// @{
+    std::vector<std::uint16_t> restingSteps;    ///< @brief 连续静止（着地且速度低于阈值）的步数
+    std::vector<std::uint8_t> asleep;           ///< @brief 是否休眠 (0/1)
+    std::vector<glm::vec2> restPositions;       ///< @brief 进入休眠时的位置，用于发现外部移动
+    /// @}
+
+    /// @name 每步数据（每次 update 开始时刷新）
+    /// @{
+    std::vector<glm::vec2> positions;       ///< @brief Transform 位置
+    std::vector<glm::vec2> velocities;      ///< @brief 速度
+    std::vector<glm::vec2> forces;          ///< @brief 本帧累积的力
+    std::vector<glm::vec2> aabbOffsets;     ///< @brief 包围盒左上角相对于 Transform 位置的偏移
+    std::vector<glm::vec2> aabbSizes;       ///< @brief 包围盒尺寸（已乘缩放）
+    std::vector<float> masses;              ///< @brief 质量
+    std::vector<ColliderType> shapes;       ///< @brief 碰撞器形状
+    std::vector<std::uint8_t> flags;        ///< @brief BodyFlags 组合
+    std::vector<std::uint8_t> contacts;     ///< @brief ContactFlags 组合
+    /// @}
+
+    size_t size() const { return components.size(); }   ///< @brief 物理体数量
+
+    /// @brief 追加一个物理体（只填充持久数据）
+    void add(engine::component::PhysicsComponent* component, engine::object::GameObject* owner,
+             engine::component::TransformComponent* transform, engine::component::ColliderComponent* collider) {
+        components.push_back(component);
+        owners.push_back(owner);
+        transforms.push_back(transform);
+        colliders.push_back(collider);
+        restingSteps.push_back(0);
+        asleep.push_back(0);
+        restPositions.emplace_back(0.0f, 0.0f);
+    }
+
+    /// @brief 移除下标为 index 的物理体（保持其余物理体的相对顺序）
+    void remove(size_t index) {
+        components.erase(components.begin() + index);
+        owners.erase(owners.begin() + index);
+        transforms.erase(transforms.begin() + index);
+        colliders.erase(colliders.begin() + index);
+        restingSteps.erase(restingSteps.begin() + index);
+        asleep.erase(asleep.begin() + index);
+        restPositions.erase(restPositions.begin() + index);
+    }
+
+    /// @brief 将每步数据的数组大小调整为物理体数量（保留容量，热身后不再分配）
+    void resizeFrameData() {
+        const size_t n = size();
+        positions.resize(n);
+        velocities.resize(n);
+        forces.resize(n);
+        aabbOffsets.resize(n);
+        aabbSizes.resize(n);
+        masses.resize(n);
+        shapes.resize(n);
+        flags.resize(n);
+        contacts.resize(n);
+    }
+
+    bool hasFlag(size_t index, BodyFlags flag) const { return (flags[index] & flag) != 0; }     ///< @brief 检查标志位
+    void setContact(size_t index, ContactFlags contact) { contacts[index] |= contact; }         ///< @brief 设置碰撞状态位
+    bool hasContact(size_t index, ContactFlags contact) const { return (contacts[index] & contact) != 0; } ///< @brief 检查碰撞状态位
+};
+
+} // namespace engine::physics
@@ -1,4 +1,5 @@
 #pragma once
+#include "../utils/MemoryArena.hpp"
 #include <glm/vec2.hpp>
 #include <utility>
 
@@ -18,7 +19,7 @@ enum class ColliderType {
  * @brief 碰撞器的抽象基类。
  * 所有具体的碰撞器都应继承此类。
  */
-class Collider {
+class Collider : public engine::utils::ArenaAllocated {
 protected:
     glm::vec2 m_aabbSize = {0.0f, 0.0f};    ///< @brief 覆盖Collider的最小包围盒的尺寸（宽度和高度）。
 
@@ -5,39 +5,42 @@
 namespace engine::physics::collision {
 
 bool checkCollision(const engine::component::ColliderComponent& a, const engine::component::ColliderComponent& b) {
-    // 获取两个碰撞盒及对应Transform信息
+    // 获取两个碰撞盒的类型及世界坐标包围盒
     auto aCollider = a.getCollider();
     auto bCollider = b.getCollider();
-    auto aTransform = a.getTransform();
-    auto bTransform = b.getTransform();
+    return checkCollision(aCollider->getType(), a.getWorldAABB(), bCollider->getType(), b.getWorldAABB());
+}
+
+bool checkCollision(engine::physics::ColliderType aType, const engine::utils::Rect& aAABB,
+                    engine::physics::ColliderType bType, const engine::utils::Rect& bAABB) {
+    const auto& aPos = aAABB.position;
+    const auto& aSize = aAABB.size;
+    const auto& bPos = bAABB.position;
+    const auto& bSize = bAABB.size;
 
     // 先计算最小包围盒是否碰撞，如果没有碰撞，那一定是返回false (不考虑AABB的旋转)
-    auto aSize = aCollider->getAABBSize() * aTransform->getScale();
-    auto bSize = bCollider->getAABBSize() * bTransform->getScale();
-    auto aPos = aTransform->getPosition() + a.getOffset();
-    auto bPos = bTransform->getPosition() + b.getOffset();
     if (!checkAABBOverlap(aPos, aSize, bPos, bSize)) {
         return false;
     }
 
     // --- 如果最小包围盒有碰撞，再进行更细致的判断 ---
     // AABB vs AABB, 直接返回真
-    if (aCollider->getType() == engine::physics::ColliderType::AABB && bCollider->getType() == engine::physics::ColliderType::AABB) {
+    if (aType == engine::physics::ColliderType::AABB && bType == engine::physics::ColliderType::AABB) {
         return true;
-    } else if (aCollider->getType() == engine::physics::ColliderType::CIRCLE && bCollider->getType() == engine::physics::ColliderType::CIRCLE) {
+    } else if (aType == engine::physics::ColliderType::CIRCLE && bType == engine::physics::ColliderType::CIRCLE) {
         // Circle vs Circle: 判断两个圆心距离是否小于两个圆的半径之和
         auto aCenter = aPos + 0.5f * aSize;  // 圆心位置
         auto bCenter = bPos + 0.5f * bSize;
         auto aRadius = 0.5f * aSize.x;        // 圆的半径等于AABB的一半宽度
         auto bRadius = 0.5f * bSize.x;
         return checkCircleOverlap(aCenter, aRadius, bCenter, bRadius);
-    } else if (aCollider->getType() == engine::physics::ColliderType::AABB && bCollider->getType() == engine::physics::ColliderType::CIRCLE){
+    } else if (aType == engine::physics::ColliderType::AABB && bType == engine::physics::ColliderType::CIRCLE){
         // AABB vs Circle: 判断圆心到AABB的最邻近点是否在圆内
         auto bCenter = bPos + 0.5f * bSize;
         auto bRadius = 0.5f * bSize.x;
         auto nearestPoint = glm::clamp(bCenter, aPos, aPos + aSize);   // 计算圆心到AABB的最邻近点
         return checkPointInCircle(nearestPoint, bCenter, bRadius);
-    } else if (aCollider->getType() == engine::physics::ColliderType::CIRCLE && bCollider->getType() == engine::physics::ColliderType::AABB){
+    } else if (aType == engine::physics::ColliderType::CIRCLE && bType == engine::physics::ColliderType::AABB){
         // Circle vs AABB
         auto aCenter = aPos + 0.5f * aSize;
         auto aRadius = 0.5f * aSize.x;
@@ -1,4 +1,5 @@
 #pragma once
+#include "Collider.hpp"
 #include "../utils/Math.hpp"
 
 namespace engine::component {
@@ -15,6 +16,17 @@ namespace engine::physics::collision {
  */
 bool checkCollision(const engine::component::ColliderComponent& a, const engine::component::ColliderComponent& b);
 
+/**
+ * @brief 检查两个碰撞形状是否重叠（不依赖组件，供 PhysicsEngine 直接使用紧凑数据）。
+ * @param aType 第一个碰撞器的类型。
+ * @param aAABB 第一个碰撞器的世界坐标包围盒。
+ * @param bType 第二个碰撞器的类型。
+ * @param bAABB 第二个碰撞器的世界坐标包围盒。
+ * @return true 如果碰撞形状重叠，否则为 false。
+ */
+bool checkCollision(engine::physics::ColliderType aType, const engine::utils::Rect& aAABB,
+                    engine::physics::ColliderType bType, const engine::utils::Rect& bAABB);
+
 /**
  * @brief 检查两个圆形是否重叠。
  * 
@@ -0,0 +1,82 @@
+#pragma once
+#include "../utils/Math.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace engine::physics {
+
+/**
+ * @brief 按左边界排序的包围盒索引（区间排序），用于查询“不会移动”的物体。
+ *
+ * build() 之后，查询时二分出左边界落在 [查询左边界 - 最大宽度, 查询右边界] 内的包围盒，
+ * 再逐个检查右边界与 y 方向。物体集合不变时无需重建，容器在重建之间复用。
+ */
+class IntervalIndex final {
+private:
+    std::vector<std::uint32_t> m_ids;           ///< @brief 加入的物体 id
+    std::vector<engine::utils::Rect> m_rects;   ///< @brief 与 m_ids 对应的包围盒
+    std::vector<std::uint32_t> m_sorted;        ///< @brief 按左边界排序后的下标（指向 m_ids / m_rects）
+    std::vector<float> m_sortedMinX;            ///< @brief 与 m_sorted 对应的左边界（二分查找用）
+    float m_maxWidth = 0.0f;                    ///< @brief 所有包围盒的最大宽度
+
+public:
+    /// @brief 清空（保留容量）
+    void clear() {
+        m_ids.clear();
+        m_rects.clear();
+        m_sorted.clear();
+        m_sortedMinX.clear();
+        m_maxWidth = 0.0f;
+    }
+
+    /// @brief 加入一个包围盒（调用 build 后才能被查询到）
+    void add(std::uint32_t id, const engine::utils::Rect& rect) {
+        m_ids.push_back(id);
+        m_rects.push_back(rect);
+    }
+
+    /// @brief 按左边界排序
+    void build() {
+        m_sorted.resize(m_rects.size());
+        std::iota(m_sorted.begin(), m_sorted.end(), 0u);
+        std::sort(m_sorted.begin(), m_sorted.end(), [this](std::uint32_t a, std::uint32_t b) {
+            return m_rects[a].position.x < m_rects[b].position.x;
+        });
+        m_sortedMinX.resize(m_sorted.size());
+        m_maxWidth = 0.0f;
+        for (size_t i = 0; i < m_sorted.size(); ++i) {
+            const auto& rect = m_rects[m_sorted[i]];
+            m_sortedMinX[i] = rect.position.x;
+            m_maxWidth = std::max(m_maxWidth, rect.size.x);
+        }
+    }
+
+    bool empty() const { return m_ids.empty(); }   ///< @brief 是否为空
+
+    /**
+     * @brief 遍历与 rect 重叠（含边界接触）的包围盒
+     * @param rect 查询范围（世界坐标）
+     * @param fn 回调，参数为加入时的物体 id (std::uint32_t)
+     */
+    template <typename Fn>
+    void forEachOverlap(const engine::utils::Rect& rect, Fn&& fn) const {
+        const float minX = rect.position.x;
+        const float maxX = rect.position.x + rect.size.x;
+        const float minY = rect.position.y;
+        const float maxY = rect.position.y + rect.size.y;
+        auto first = std::lower_bound(m_sortedMinX.begin(), m_sortedMinX.end(), minX - m_maxWidth);
+        auto last = std::upper_bound(first, m_sortedMinX.end(), maxX);
+        for (auto it = first; it != last; ++it) {
+            const size_t index = m_sorted[static_cast<size_t>(it - m_sortedMinX.begin())];
+            const auto& other = m_rects[index];
+            if (other.position.x + other.size.x < minX) continue;
+            if (other.position.y > maxY || other.position.y + other.size.y < minY) continue;
+            fn(m_ids[index]);
+        }
+    }
+};
+
+} // namespace engine::physics
@@ -5,268 +5,740 @@
 #include "../component/TilelayerComponent.hpp"
 #include "../component/ColliderComponent.hpp"
 #include "../object/GameObject.hpp"
+#include "../utils/Profiler.hpp"
 
 #include <spdlog/spdlog.h>
 #include <glm/common.hpp>
 
-#include <set>
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
 
 namespace engine::physics {
 
+namespace {
+/// @brief 需要以事件形式通知游戏逻辑的触发器瓦片类型（梯子由物理引擎自己处理）
+constexpr std::uint32_t TILE_TRIGGER_EVENT_MASK = engine::component::TRIGGER_TILE_MASK & ~engine::component::tileTypeBit(engine::component::TileType::LADDER);
+
+/**
+ * @brief 判断物理体能否作为静态物体，可以时输出其包围盒与碰撞器形状
+ * @param cc 已缓存的碰撞器组件，为空时从 owner 查找
+ */
+bool getStaticBodyShape(const engine::component::PhysicsComponent& pc, engine::object::GameObject* owner,
+                        const engine::component::TransformComponent* tc, const engine::component::ColliderComponent* cc,
+                        engine::utils::Rect& aabb, ColliderType& shape) {
+    // 先检查开销最小的条件，受重力的物体（绝大多数动态物体）直接跳过
+    if (pc.isUseGravity() || !pc.isEnabled()) return false;
+    if (pc.m_velocity != glm::vec2(0.0f) || pc.getForce() != glm::vec2(0.0f)) return false;
+    if (!owner || !tc || owner->getTag() != "solid") return false;
+    if (!cc) cc = owner->getComponent<engine::component::ColliderComponent>();
+    if (!cc || !cc->getCollider() || !cc->isActive() || cc->isTrigger()) return false;
+    const auto size = cc->getCollider()->getAABBSize() * tc->getScale();
+    if (size.x <= 0.0f || size.y <= 0.0f) return false;
+    aabb = {tc->getPosition() + cc->getOffset(), size};
+    shape = cc->getCollider()->getType();
+    return true;
+}
+} // namespace
+
 void PhysicsEngine::registerComponent(engine::component::PhysicsComponent* component) {
-    m_components.push_back(component);
+    if (!component) return;
+    auto* owner = component->getOwner();
+    // 注册时缓存组件指针，热循环中不再进行 getComponent 查找
+    auto* cc = owner ? owner->getComponent<engine::component::ColliderComponent>() : nullptr;
+    addBody(component, owner, cc);
     spdlog::trace("PHYSICSENGINE::registerComponent::物理组件注册完成");
 }
 
 void PhysicsEngine::unregisterComponent(engine::component::PhysicsComponent* component) {
-    // 使用 remove-erase 方法安全地移除指针
-    auto it = std::remove(m_components.begin(), m_components.end(), component);
-    m_components.erase(it, m_components.end());
+    m_pinnedBodies.erase(component);
+    if (m_staticBodies.remove(component)) {
+        spdlog::trace("PHYSICSENGINE::unregisterComponent::静态物理体注销完成");
+        return;
+    }
+    // 按顺序移除（保持其余物理体的下标顺序，碰撞对的输出顺序因此不变）
+    for (size_t i = m_bodies.size(); i-- > 0;) {
+        if (m_bodies.components[i] == component) removeBodyAt(i);
+    }
     spdlog::trace("PHYSICSENGINE::unregisterComponent::物理组件注销完成");
 }
 
+void PhysicsEngine::addBody(engine::component::PhysicsComponent* component, engine::object::GameObject* owner,
+                            engine::component::ColliderComponent* collider) {
+    m_bodies.add(component, owner, component->getTransform(), collider);
+    m_isSleepIndexDirty = true;     // 物理体下标可能变化
+    m_isQueryDataDirty = true;
+}
+
+void PhysicsEngine::removeBodyAt(size_t index) {
+    if (m_bodies.asleep[index]) --m_sleepingBodyCount;
+    m_bodies.remove(index);
+    m_isSleepIndexDirty = true;     // 其后的物理体下标前移，休眠索引与粗检测网格中的下标失效
+    m_isQueryDataDirty = true;
+}
+
 void PhysicsEngine::registerCollisionLayer(engine::component::TileLayerComponent *layer) {
     layer->setPhysicsEngine(this); // 设置物理引擎指针
     m_collisionTileLayers.push_back(layer);
+    m_collisionTileGrids.push_back(layer->getCollisionGrid());
+    wakeAllBodies();    // 瓦片发生变化，休眠的物体可能不再有支撑
     spdlog::trace("PHYSICSENGINE::registerCollisionLayer::碰撞瓦片图层注册完成");
 }
 
 void PhysicsEngine::unregisterCollisionLayer(engine::component::TileLayerComponent* layer) {
     auto it = std::remove(m_collisionTileLayers.begin(), m_collisionTileLayers.end(), layer);
     m_collisionTileLayers.erase(it, m_collisionTileLayers.end());
+    m_collisionTileGrids.clear();     // 与图层列表保持一一对应
+    for (auto* remaining : m_collisionTileLayers) {
+        m_collisionTileGrids.push_back(remaining->getCollisionGrid());
+    }
+    wakeAllBodies();
     spdlog::trace("PHYSICSENGINE::unregisterCollisionLayer::碰撞瓦片图层注销完成");
 }
 
 void PhysicsEngine::update(float deltaTime) {
+    SL_PROFILE_ZONE("PhysicsEngine::update");
     // 开始前清空碰撞对
     m_collisionPairs.clear();
     m_tileTriggerEvents.clear();
-    // 遍历所有注册的物理组件
-    for (auto* pc : m_components) {
-        if (!pc || !pc->isEnabled()) { // 检查组件是否有效和启用
+    // 不会移动的 SOLID 物体转为静态物体，之后不再参与逐帧计算；开始移动的静态物体转回动态物体
+    demoteStaticBodies();
+    promoteStaticBodies();
+    m_staticBodies.rebuild();
+    // 一次性读取所有动态物理体的数据到紧凑数组中
+    gatherBodies();
+    // 积分速度与位移，处理瓦片碰撞和世界边界
+    integrateBodies(deltaTime);
+    // 处理对象间碰撞
+    checkObjectCollisions();
+    // 检测瓦片触发事件 (检测前已经处理完位移)
+    checkTileTriggers();
+    // 静止足够久的物体进入休眠
+    updateSleepStates();
+    // 将结果一次性写回组件
+    scatterBodies();
+    // 粗检测网格与紧凑数据保留到下一次更新，供空间查询使用（有物体被推开时，网格中还是推开前的位置，查询前重建）
+    m_isQueryDataDirty = false;
+    m_isBroadphaseStale = !m_pushedBodies.empty();
+}
+
+void PhysicsEngine::integrateBodies(float deltaTime) {
+    SL_PROFILE_ZONE("PhysicsEngine::integrateBodies");
+    // 遍历所有注册的物理体
+    for (size_t i = 0; i < m_bodies.size(); ++i) {
+        if (!m_bodies.hasFlag(i, BODY_ENABLED) || m_bodies.hasFlag(i, BODY_ASLEEP)) { // 检查组件是否启用，休眠的物体不参与积分
             continue;
         }
 
-        pc->resetCollisionFlags(); // 重置碰撞标志
+        m_bodies.contacts[i] = 0; // 重置碰撞标志
 
         // 应用重力 (如果组件受重力影响)：F = g * m
-        if (pc->isUseGravity()) {
-            pc->addForce(m_gravity * pc->getMass());
+        if (m_bodies.hasFlag(i, BODY_USE_GRAVITY)) {
+            m_bodies.forces[i] += m_gravity * m_bodies.masses[i];
         }
         /* 还可以添加其它力影响，比如风力、摩擦力等，目前不考虑 */
-        
+
         // 更新速度： v += a * dt，其中 a = F / m
-        pc->m_velocity += (pc->getForce() / pc->getMass()) * deltaTime;
-        pc->clearForce(); // 清除当前帧的力
+        m_bodies.velocities[i] += (m_bodies.forces[i] / m_bodies.masses[i]) * deltaTime;
+        m_bodies.forces[i] = {0.0f, 0.0f}; // 清除当前帧的力
 
         // 处理瓦片层碰撞（速度和位置的更新移入此函数）
-        resolveTileCollisions(pc, deltaTime);
+        resolveTileCollisions(i, deltaTime);
         // 应用世界边界
-        applyWorldBounds(pc);
+        applyWorldBounds(i);
     }
-    // 处理对象间碰撞
-    checkObjectCollisions();
-    // 检测瓦片触发事件 (检测前已经处理完位移)
-    checkTileTriggers();
+}
+
+void PhysicsEngine::promoteStaticBodies() {
+    for (size_t i = m_bodies.size(); i-- > 0;) {
+        auto* pc = m_bodies.components[i];
+        auto* owner = m_bodies.owners[i];
+        engine::utils::Rect aabb({0.0f, 0.0f}, {0.0f, 0.0f});
+        ColliderType shape = ColliderType::NONE;
+        if (!getStaticBodyShape(*pc, owner, m_bodies.transforms[i], m_bodies.colliders[i], aabb, shape)) continue;
+        if (m_pinnedBodies.contains(pc)) continue;
+
+        m_staticBodies.add(pc, owner, aabb, shape);
+        removeBodyAt(i);
+        spdlog::trace("PHYSICSENGINE::promoteStaticBodies::'{}' 转为静态物理体", owner->getName());
+    }
+}
+
+void PhysicsEngine::demoteStaticBodies() {
+    for (size_t i = m_staticBodies.size(); i-- > 0;) {
+        auto* pc = m_staticBodies.getComponent(i);
+        auto* owner = m_staticBodies.getOwner(i);
+        engine::utils::Rect aabb({0.0f, 0.0f}, {0.0f, 0.0f});
+        ColliderType shape = ColliderType::NONE;
+        const bool isStatic = getStaticBodyShape(*pc, owner, pc->getTransform(), nullptr, aabb, shape);
+        const auto& staticAABB = m_staticBodies.getAABB(i);
+        const bool isMoved = isStatic && (aabb.position != staticAABB.position || aabb.size != staticAABB.size);
+        if (isStatic && !isMoved && shape == m_staticBodies.getShape(i)) continue;
+        // 直接修改了位置或缩放的物体（如脚本移动的平台）之后一直保持动态，避免每步在静态与动态之间来回转换
+        if (isMoved) m_pinnedBodies.insert(pc);
+
+        m_staticBodies.removeAt(i);
+        addBody(pc, owner, owner ? owner->getComponent<engine::component::ColliderComponent>() : nullptr);
+        spdlog::trace("PHYSICSENGINE::demoteStaticBodies::'{}' 转回动态物理体", owner ? owner->getName() : "");
+    }
+}
+
+void PhysicsEngine::gatherBodies() {
+    SL_PROFILE_ZONE("PhysicsEngine::gatherBodies");
+    m_bodies.resizeFrameData();
+    for (size_t i = 0; i < m_bodies.size(); ++i) {
+        readBody(i);
+        if (!m_bodies.asleep[i]) continue;
+        // 外部赋予了速度、力（setVelocity / addForce）或移动了位置，则唤醒；否则保持休眠时的着地状态
+        if (m_bodies.velocities[i] != glm::vec2(0.0f) || m_bodies.forces[i] != glm::vec2(0.0f)
+            || m_bodies.positions[i] != m_bodies.restPositions[i] || !m_isSleepEnabled) {
+            wakeBodyAt(i);
+        } else {
+            m_bodies.flags[i] |= BODY_ASLEEP;
+            m_bodies.contacts[i] = CONTACT_BELOW;
+        }
+    }
+}
+
+void PhysicsEngine::readBody(size_t index) {
+    auto* pc = m_bodies.components[index];
+    auto* tc = m_bodies.transforms[index];
+    auto*& cc = m_bodies.colliders[index];
+    // 碰撞器可能在物理组件之后才添加，此时再补查一次
+    if (!cc && m_bodies.owners[index]) {
+        cc = m_bodies.owners[index]->getComponent<engine::component::ColliderComponent>();
+    }
+
+    std::uint8_t flags = 0;
+    if (pc->isEnabled()) flags |= BODY_ENABLED;
+    if (pc->isUseGravity()) flags |= BODY_USE_GRAVITY;
+    if (m_bodies.owners[index] && m_bodies.owners[index]->getTag() == "solid") flags |= BODY_SOLID;
+
+    m_bodies.positions[index] = tc ? tc->getPosition() : glm::vec2(0.0f);
+    m_bodies.velocities[index] = pc->m_velocity;
+    m_bodies.forces[index] = pc->getForce();
+    m_bodies.masses[index] = pc->getMass();
+    m_bodies.contacts[index] = 0;
+
+    if (tc && cc && cc->getCollider()) {
+        flags |= BODY_HAS_COLLIDER;
+        if (cc->isActive()) flags |= BODY_COLLIDER_ACTIVE;
+        if (cc->isTrigger()) flags |= BODY_TRIGGER;
+        m_bodies.aabbOffsets[index] = cc->getOffset();
+        m_bodies.aabbSizes[index] = cc->getCollider()->getAABBSize() * tc->getScale();
+        m_bodies.shapes[index] = cc->getCollider()->getType();
+    } else {
+        m_bodies.aabbOffsets[index] = {0.0f, 0.0f};
+        m_bodies.aabbSizes[index] = {0.0f, 0.0f};
+        m_bodies.shapes[index] = ColliderType::NONE;
+    }
+    m_bodies.flags[index] = flags;
+}
+
+void PhysicsEngine::scatterBodies() {
+    SL_PROFILE_ZONE("PhysicsEngine::scatterBodies");
+    for (size_t i = 0; i < m_bodies.size(); ++i) {
+        if (!m_bodies.hasFlag(i, BODY_ENABLED)) continue;   // 未启用的组件保持原状
+        if (m_bodies.hasFlag(i, BODY_ASLEEP) && m_bodies.asleep[i]) continue;   // 整步都在休眠的物体没有变化
+        auto* pc = m_bodies.components[i];
+        if (auto* tc = m_bodies.transforms[i]; tc) {
+            tc->setPosition(m_bodies.positions[i]);
+        }
+        pc->m_velocity = m_bodies.velocities[i];
+        pc->clearForce();
+        pc->setCollidedBelow(m_bodies.hasContact(i, CONTACT_BELOW));
+        pc->setCollidedAbove(m_bodies.hasContact(i, CONTACT_ABOVE));
+        pc->setCollidedLeft(m_bodies.hasContact(i, CONTACT_LEFT));
+        pc->setCollidedRight(m_bodies.hasContact(i, CONTACT_RIGHT));
+        pc->setCollidedLadder(m_bodies.hasContact(i, CONTACT_LADDER));
+        pc->setOnTopLadder(m_bodies.hasContact(i, CONTACT_TOP_LADDER));
+    }
+}
+
+engine::utils::Rect PhysicsEngine::getBodyAABB(size_t index) const {
+    return {m_bodies.positions[index] + m_bodies.aabbOffsets[index], m_bodies.aabbSizes[index]};
 }
 
 void PhysicsEngine::checkObjectCollisions() {
-    // 两层循环遍历所有包含物理组件的 GameObject
-    for (size_t i = 0; i < m_components.size(); ++i) {
-        auto* pcA = m_components[i];
-        if (!pcA || !pcA->isEnabled()) continue;
-        auto* objA = pcA->getOwner();
-        if (!objA) continue;
-        auto* ccA = objA->getComponent<engine::component::ColliderComponent>();
-        if (!ccA || !ccA->isActive()) continue;
-
-        for (size_t j = i + 1; j < m_components.size(); ++j) {
-            auto* pcB = m_components[j];
-            if (!pcB || !pcB->isEnabled()) continue;
-            auto* objB = pcB->getOwner();
-            if (!objB) continue;
-            auto* ccB = objB->getComponent<engine::component::ColliderComponent>();
-            if (!ccB || !ccB->isActive()) continue;
-            /* --- 通过保护性测试后，正式执行逻辑 --- */
-
-            if (collision::checkCollision(*ccA, *ccB)) {
-                // 如果是可移动物体与SOLID物体碰撞，则直接处理位置变化，不用记录碰撞对
-                if (objA->getTag() != "solid" && objB->getTag() == "solid") {
-                    resolveSolidObjectCollisions(objA, objB);
-                } else if (objA->getTag() == "solid" && objB->getTag() != "solid") {
-                    resolveSolidObjectCollisions(objB, objA);
-                } else {
-                    // 记录碰撞对
-                    m_collisionPairs.emplace_back(objA, objB);
+    SL_PROFILE_ZONE("PhysicsEngine::checkObjectCollisions");
+    m_pushedBodies.clear();
+    // 1. 动态物体与静态物体：只查询静态结构，直接处理位置变化
+    resolveStaticCollisions();
+
+    // 2. 把所有醒着的有效碰撞体登记到空间哈希中（休眠的物体不移动，单独用 m_sleepingIndex 查询）
+    rebuildBroadphase();
+
+    // 3. 只对共享网格的候选对做精确检测（候选对按 (i, j) 升序，与原先两层循环的顺序一致）
+    const auto& pairs = m_broadphase.computePairs();
+    for (const auto& [i, j] : pairs) {
+        if (collision::checkCollision(m_bodies.shapes[i], getBodyAABB(i), m_bodies.shapes[j], getBodyAABB(j))) {
+            handleBodyContact(i, j);
+        }
+    }
+
+    // 4. 被 SOLID 物体推开的物体不再位于登记时的位置，用新位置补充检测一次
+    retestPushedBodies(pairs);
+
+    // 5. 醒着的物体与休眠物体
+    checkSleepingContacts();
+}
+
+void PhysicsEngine::retestPushedBodies(const std::vector<std::pair<std::uint32_t, std::uint32_t>>& pairs) {
+    if (m_pushedBodies.empty()) return;
+    std::sort(m_pushedBodies.begin(), m_pushedBodies.end());
+    m_pushedBodies.erase(std::unique(m_pushedBodies.begin(), m_pushedBodies.end()), m_pushedBodies.end());
+    constexpr std::uint8_t required = BODY_ENABLED | BODY_HAS_COLLIDER | BODY_COLLIDER_ACTIVE;
+    // 只补充一轮：补充检测中再次被推开的物体留到下一步处理（其他物体在网格中仍是推开前的位置）
+    const size_t count = m_pushedBodies.size();
+    for (size_t k = 0; k < count; ++k) {
+        const auto i = m_pushedBodies[k];
+        const auto stamp = nextQueryStamp();
+        m_broadphase.forEachCandidate(getBodyAABB(i), [&](std::uint32_t j) {
+            if (j == i || m_queryStamps[j] == stamp) return;
+            m_queryStamps[j] = stamp;
+            if ((m_bodies.flags[j] & required) != required || !m_bodies.owners[j]) return;
+            const auto key = std::minmax(i, j);
+            if (std::binary_search(pairs.begin(), pairs.end(), std::pair(key.first, key.second))) return;  // 第 3 步已经检测过
+            if (collision::checkCollision(m_bodies.shapes[i], getBodyAABB(i), m_bodies.shapes[j], getBodyAABB(j))) {
+                handleBodyContact(key.first, key.second);
+            }
+        });
+    }
+}
+
+std::uint32_t PhysicsEngine::nextQueryStamp() {
+    if (m_queryStamps.size() < m_bodies.size()) {
+        m_queryStamps.resize(m_bodies.size(), 0);
+    }
+    if (++m_queryStamp == 0) {  // 编号回绕时清零，避免与旧编号混淆
+        std::fill(m_queryStamps.begin(), m_queryStamps.end(), 0);
+        m_queryStamp = 1;
+    }
+    return m_queryStamp;
+}
+
+void PhysicsEngine::rebuildBroadphase() {
+    m_broadphase.clear();
+    constexpr std::uint8_t required = BODY_ENABLED | BODY_HAS_COLLIDER | BODY_COLLIDER_ACTIVE;
+    for (size_t i = 0; i < m_bodies.size(); ++i) {
+        if ((m_bodies.flags[i] & required) != required || !m_bodies.owners[i]) continue;
+        if (m_bodies.hasFlag(i, BODY_ASLEEP)) continue;
+        m_broadphase.insert(static_cast<std::uint32_t>(i), getBodyAABB(i));
+    }
+    m_broadphase.build();
+}
+
+void PhysicsEngine::handleBodyContact(size_t a, size_t b) {
+    // 如果是可移动物体与（仍为动态的）SOLID物体碰撞，则直接处理位置变化，不用记录碰撞对
+    const bool solidA = m_bodies.hasFlag(a, BODY_SOLID);
+    const bool solidB = m_bodies.hasFlag(b, BODY_SOLID);
+    if (!solidA && solidB) {
+        resolveSolidObjectCollisions(a, getBodyAABB(b));
+        m_pushedBodies.push_back(static_cast<std::uint32_t>(a));
+    } else if (solidA && !solidB) {
+        resolveSolidObjectCollisions(b, getBodyAABB(a));
+        m_pushedBodies.push_back(static_cast<std::uint32_t>(b));
+    } else {
+        // 记录碰撞对
+        m_collisionPairs.emplace_back(m_bodies.owners[a], m_bodies.owners[b]);
+    }
+}
+
+void PhysicsEngine::checkSleepingContacts() {
+    if (m_sleepingBodyCount == 0) return;
+    constexpr std::uint8_t required = BODY_ENABLED | BODY_HAS_COLLIDER | BODY_COLLIDER_ACTIVE;
+    rebuildSleepingIndex();
+    if (m_sleepingIndex.empty()) return;
+    // 两个都在休眠的物体位置不变，重叠关系在重建索引时已经算好，照常作为碰撞对输出（与静态物体相同）
+    for (const auto& [a, b] : m_sleepingPairs) {
+        if (!m_bodies.hasFlag(a, BODY_ASLEEP) || !m_bodies.hasFlag(b, BODY_ASLEEP)) continue;
+        if ((m_bodies.flags[a] & required) != required || (m_bodies.flags[b] & required) != required) continue;
+        if (!m_bodies.owners[a] || !m_bodies.owners[b]) continue;
+        // 只有一方是 SOLID 时入睡前已经推开，不需要（也不能在不唤醒的情况下）再次处理
+        if (m_bodies.hasFlag(a, BODY_SOLID) != m_bodies.hasFlag(b, BODY_SOLID)) continue;
+        m_collisionPairs.emplace_back(m_bodies.owners[a], m_bodies.owners[b]);
+    }
+    for (size_t i = 0; i < m_bodies.size(); ++i) {
+        if ((m_bodies.flags[i] & required) != required || !m_bodies.owners[i]) continue;
+        if (m_bodies.hasFlag(i, BODY_ASLEEP)) continue;
+        m_sleepingIndex.forEachOverlap(getBodyAABB(i), [this, i](std::uint32_t s) {
+            // 索引中也可能有本次更新开始时已醒来的物体（它们在粗检测网格中），这里只处理本次更新开始时仍在休眠的
+            if (!m_bodies.hasFlag(static_cast<size_t>(s), BODY_ASLEEP)) return;
+            if ((m_bodies.flags[s] & required) != required || !m_bodies.owners[s]) return;
+            if (!collision::checkCollision(m_bodies.shapes[i], getBodyAABB(i), m_bodies.shapes[s], getBodyAABB(s))) return;
+            // 与醒着的物体接触，唤醒休眠物体（碰撞对仍按 (较小下标, 较大下标) 记录）
+            wakeBodyAt(s);
+            handleBodyContact(std::min<size_t>(i, s), std::max<size_t>(i, s));
+        });
+    }
+}
+
+void PhysicsEngine::rebuildSleepingIndex() {
+    // 休眠物体的包围盒不变，只在有物体入睡、醒来或增删时重建索引
+    if (!m_isSleepIndexDirty) return;
+    m_isSleepIndexDirty = false;
+    m_sleepingIndex.clear();
+    // 同时包含“本次更新开始时休眠”和“当前休眠”的物体：在两次更新之间查询时，与粗检测网格合起来覆盖所有物体
+    auto isIndexed = [this](size_t i) {
+        return (m_bodies.hasFlag(i, BODY_ASLEEP) || m_bodies.asleep[i]) && m_bodies.hasFlag(i, BODY_HAS_COLLIDER);
+    };
+    for (size_t i = 0; i < m_bodies.size(); ++i) {
+        if (isIndexed(i)) m_sleepingIndex.add(static_cast<std::uint32_t>(i), getBodyAABB(i));
+    }
+    m_sleepingIndex.build();
+
+    // 休眠物体之间的重叠在下次集合变化前不变，只在这里计算一次（按 (较小下标, 较大下标) 升序）
+    m_sleepingPairs.clear();
+    for (size_t i = 0; i < m_bodies.size(); ++i) {
+        if (!isIndexed(i)) continue;
+        m_sleepingIndex.forEachOverlap(getBodyAABB(i), [this, i](std::uint32_t j) {
+            if (j <= i) return;
+            if (collision::checkCollision(m_bodies.shapes[i], getBodyAABB(i), m_bodies.shapes[j], getBodyAABB(j))) {
+                m_sleepingPairs.emplace_back(static_cast<std::uint32_t>(i), j);
+            }
+        });
+    }
+    std::sort(m_sleepingPairs.begin(), m_sleepingPairs.end());
+}
+
+void PhysicsEngine::updateSleepStates() {
+    SL_PROFILE_ZONE("PhysicsEngine::updateSleepStates");
+    if (!m_isSleepEnabled) return;
+    const float thresholdSq = m_sleepVelocityThreshold * m_sleepVelocityThreshold;
+    for (size_t i = 0; i < m_bodies.size(); ++i) {
+        if (m_bodies.asleep[i]) continue;
+        const auto& velocity = m_bodies.velocities[i];
+        if (!m_bodies.hasFlag(i, BODY_ENABLED) || !m_bodies.hasContact(i, CONTACT_BELOW)
+            || velocity.x * velocity.x + velocity.y * velocity.y >= thresholdSq) {
+            m_bodies.restingSteps[i] = 0;
+            continue;
+        }
+        if (++m_bodies.restingSteps[i] < m_sleepSteps) continue;
+        // 着地且速度持续低于阈值：进入休眠，速度归零（写回组件后，下一次读到非零速度即说明被外部唤醒）
+        m_bodies.asleep[i] = 1;
+        m_bodies.velocities[i] = {0.0f, 0.0f};
+        m_bodies.restPositions[i] = m_bodies.positions[i];
+        ++m_sleepingBodyCount;
+        m_isSleepIndexDirty = true;
+    }
+}
+
+void PhysicsEngine::wakeBodyAt(size_t index) {
+    m_bodies.restingSteps[index] = 0;
+    if (!m_bodies.asleep[index]) return;
+    m_bodies.asleep[index] = 0;
+    --m_sleepingBodyCount;
+    m_isSleepIndexDirty = true;
+}
+
+void PhysicsEngine::wakeBody(engine::component::PhysicsComponent* component) {
+    for (size_t i = 0; i < m_bodies.size(); ++i) {
+        if (m_bodies.components[i] == component) {
+            wakeBodyAt(i);
+            return;
+        }
+    }
+}
+
+void PhysicsEngine::wakeBodiesInRect(const engine::utils::Rect& rect) {
+    if (m_sleepingBodyCount == 0) return;
+    for (size_t i = 0; i < m_bodies.size(); ++i) {
+        if (!m_bodies.asleep[i]) continue;
+        auto* tc = m_bodies.transforms[i];
+        auto* cc = m_bodies.colliders[i];
+        if (!tc || !cc || !cc->getCollider()) {
+            wakeBodyAt(i);
+            continue;
+        }
+        // 在物理更新之外调用，直接从组件计算包围盒
+        const engine::utils::Rect aabb(tc->getPosition() + cc->getOffset(), cc->getCollider()->getAABBSize() * tc->getScale());
+        if (collision::checkCollision(ColliderType::AABB, aabb, ColliderType::AABB, rect)) {
+            wakeBodyAt(i);
+        }
+    }
+}
+
+void PhysicsEngine::wakeAllBodies() {
+    for (size_t i = 0; i < m_bodies.size(); ++i) {
+        wakeBodyAt(i);
+    }
+}
+
+void PhysicsEngine::setSleepEnabled(bool isEnabled) {
+    m_isSleepEnabled = isEnabled;
+    if (!isEnabled) wakeAllBodies();
+}
+
+void PhysicsEngine::refreshQueryData() {
+    // 两次更新之间增删了物理体：重新读取紧凑数据（不推进模拟）
+    if (m_isQueryDataDirty) {
+        m_bodies.resizeFrameData();
+        for (size_t i = 0; i < m_bodies.size(); ++i) {
+            readBody(i);
+            // 只读取，不唤醒：查询不能改变模拟的结果，是否唤醒留给下一次 update 判断
+            if (m_bodies.asleep[i]) m_bodies.flags[i] |= BODY_ASLEEP;
+        }
+        m_isQueryDataDirty = false;
+        m_isBroadphaseStale = true;
+    }
+    // 粗检测网格在物体间碰撞推开物体之前登记，或者下标已经失效：按当前的包围盒重建
+    if (m_isBroadphaseStale) {
+        rebuildBroadphase();
+        m_isBroadphaseStale = false;
+    }
+    m_staticBodies.rebuild();
+    rebuildSleepingIndex();
+    nextQueryStamp();
+}
+
+template <typename Fn>
+void PhysicsEngine::forEachQueryCandidate(const engine::utils::Rect& rect, const QueryFilter& filter, Fn&& fn) {
+    refreshQueryData();
+    auto isAccepted = [&filter](const engine::object::GameObject* owner) {
+        return owner && owner != filter.ignore && (filter.tag.empty() || owner->getTag() == filter.tag);
+    };
+    if (filter.flags & QUERY_DYNAMIC) {
+        constexpr std::uint8_t required = BODY_ENABLED | BODY_HAS_COLLIDER | BODY_COLLIDER_ACTIVE;
+        auto visit = [&](std::uint32_t id) {
+            const auto i = static_cast<size_t>(id);
+            if (m_queryStamps[i] == m_queryStamp) return;  // 跨多个网格的物体只处理一次
+            m_queryStamps[i] = m_queryStamp;
+            if ((m_bodies.flags[i] & required) != required || !isAccepted(m_bodies.owners[i])) return;
+            if (m_bodies.hasFlag(i, BODY_TRIGGER) && !(filter.flags & QUERY_TRIGGERS)) return;
+            const auto aabb = getBodyAABB(i);
+            if (!collision::checkRectOverlap(aabb, rect)) return;
+            fn(m_bodies.owners[i], m_bodies.shapes[i], aabb);
+        };
+        m_broadphase.forEachCandidate(rect, visit);
+        m_sleepingIndex.forEachOverlap(rect, visit);
+    }
+    if (filter.flags & QUERY_STATIC) {
+        m_staticBodies.forEachOverlap(rect, [&](size_t index) {
+            if (!isAccepted(m_staticBodies.getOwner(index))) return;
+            fn(m_staticBodies.getOwner(index), m_staticBodies.getShape(index), m_staticBodies.getAABB(index));
+        });
+    }
+}
+
+size_t PhysicsEngine::overlapBox(const engine::utils::Rect& box, std::span<engine::object::GameObject*> results, const QueryFilter& filter) {
+    SL_PROFILE_ZONE("PhysicsEngine::overlapBox");
+    size_t count = 0;
+    forEachQueryCandidate(box, filter, [&](engine::object::GameObject* owner, ColliderType shape, const engine::utils::Rect& aabb) {
+        if (!collision::checkCollision(ColliderType::AABB, box, shape, aabb)) return;
+        if (count < results.size()) results[count] = owner;
+        ++count;
+    });
+    return count;
+}
+
+size_t PhysicsEngine::queryRadius(glm::vec2 center, float radius, std::span<engine::object::GameObject*> results, const QueryFilter& filter) {
+    SL_PROFILE_ZONE("PhysicsEngine::queryRadius");
+    size_t count = 0;
+    const engine::utils::Rect bounds(center - radius, glm::vec2(radius * 2.0f));
+    forEachQueryCandidate(bounds, filter, [&](engine::object::GameObject* owner, ColliderType shape, const engine::utils::Rect& aabb) {
+        if (!collision::checkCollision(ColliderType::CIRCLE, bounds, shape, aabb)) return;
+        if (count < results.size()) results[count] = owner;
+        ++count;
+    });
+    return count;
+}
+
+engine::object::GameObject* PhysicsEngine::findNearest(glm::vec2 point, float maxDistance, const QueryFilter& filter) {
+    SL_PROFILE_ZONE("PhysicsEngine::findNearest");
+    engine::object::GameObject* nearest = nullptr;
+    float nearestDistSq = maxDistance * maxDistance;
+    const engine::utils::Rect bounds(point - maxDistance, glm::vec2(maxDistance * 2.0f));
+    forEachQueryCandidate(bounds, filter, [&](engine::object::GameObject* owner, ColliderType, const engine::utils::Rect& aabb) {
+        const auto offset = aabb.position + 0.5f * aabb.size - point;
+        const float distSq = offset.x * offset.x + offset.y * offset.y;
+        if (distSq <= nearestDistSq) {
+            nearestDistSq = distSq;
+            nearest = owner;
+        }
+    });
+    return nearest;
+}
+
+bool PhysicsEngine::raycast(glm::vec2 from, glm::vec2 to, RaycastHit& hit, const QueryFilter& filter) {
+    SL_PROFILE_ZONE("PhysicsEngine::raycast");
+    const auto delta = to - from;
+    RaycastHit best;
+    bool isHit = false;
+    // 先检测瓦片，命中后缩短线段，减少需要检测的对象
+    if ((filter.flags & QUERY_TILES) && filter.tileMask != 0) {
+        isHit = raycastTiles(from, delta, best, filter.tileMask);
+    }
+    const auto end = from + delta * best.fraction;
+    const engine::utils::Rect bounds(glm::min(from, end), glm::abs(end - from));
+    forEachQueryCandidate(bounds, filter, [&](engine::object::GameObject* owner, ColliderType shape, const engine::utils::Rect& aabb) {
+        float t = 0.0f;
+        glm::vec2 normal(0.0f);
+        if (shape == ColliderType::CIRCLE) {
+            // 线段与圆：解 |from + t * delta - center|^2 = r^2 的较小根
+            const auto center = aabb.position + 0.5f * aabb.size;
+            const float radius = 0.5f * aabb.size.x;
+            const auto m = from - center;
+            const float a = glm::dot(delta, delta);
+            const float b = glm::dot(m, delta);
+            const float c = glm::dot(m, m) - radius * radius;
+            if (c > 0.0f) {
+                const float disc = b * b - a * c;
+                if (a <= 0.0f || b > 0.0f || disc < 0.0f) return;
+                t = (-b - std::sqrt(disc)) / a;
+                normal = glm::normalize(from + delta * t - center);
+            }
+        } else {
+            // 线段与 AABB：slab 法，记录最后进入的轴作为法线
+            float tMin = 0.0f;
+            float tMax = 1.0f;
+            for (int axis = 0; axis < 2; ++axis) {
+                const float lo = aabb.position[axis];
+                const float hi = aabb.position[axis] + aabb.size[axis];
+                if (delta[axis] == 0.0f) {
+                    if (from[axis] < lo || from[axis] > hi) return;
+                    continue;
+                }
+                float t1 = (lo - from[axis]) / delta[axis];
+                float t2 = (hi - from[axis]) / delta[axis];
+                float sign = -1.0f;
+                if (t1 > t2) {
+                    std::swap(t1, t2);
+                    sign = 1.0f;
+                }
+                if (t1 > tMin) {
+                    tMin = t1;
+                    normal = glm::vec2(0.0f);
+                    normal[axis] = sign;
+                }
+                tMax = glm::min(tMax, t2);
+                if (tMin > tMax) return;
+            }
+            t = tMin;
+        }
+        if (t > best.fraction || (isHit && t == best.fraction)) return;
+        best.object = owner;
+        best.tileType = engine::component::TileType::EMPTY;
+        best.fraction = t;
+        best.normal = normal;
+        isHit = true;
+    });
+    if (!isHit) return false;
+    best.point = from + delta * best.fraction;
+    hit = best;
+    return true;
+}
+
+bool PhysicsEngine::raycastTiles(glm::vec2 from, glm::vec2 delta, RaycastHit& hit, std::uint32_t tileMask) const {
+    bool isHit = false;
+    for (auto* layer : m_collisionTileLayers) {
+        if (!layer) continue;
+        const glm::vec2 tileSize = layer->getTileSize();
+        // 网格遍历 (DDA)：依次经过线段穿过的每个格子，直到命中或超出当前最近的命中点
+        glm::ivec2 cell(static_cast<int>(std::floor(from.x / tileSize.x)), static_cast<int>(std::floor(from.y / tileSize.y)));
+        const glm::ivec2 stepDir(delta.x > 0.0f ? 1 : (delta.x < 0.0f ? -1 : 0), delta.y > 0.0f ? 1 : (delta.y < 0.0f ? -1 : 0));
+        glm::vec2 tMax(std::numeric_limits<float>::infinity());
+        glm::vec2 tDelta(std::numeric_limits<float>::infinity());
+        for (int axis = 0; axis < 2; ++axis) {
+            if (stepDir[axis] == 0) continue;
+            const float boundary = (static_cast<float>(cell[axis]) + (stepDir[axis] > 0 ? 1.0f : 0.0f)) * tileSize[axis];
+            tMax[axis] = (boundary - from[axis]) / delta[axis];
+            tDelta[axis] = tileSize[axis] / std::abs(delta[axis]);
+        }
+        float t = 0.0f;
+        glm::vec2 normal(0.0f);
+        while (t <= hit.fraction) {
+            const auto type = layer->getCollisionTypeAt(cell);
+            if (engine::component::tileTypeBit(type) & tileMask) {
+                if (!isHit || t < hit.fraction) {
+                    hit.object = nullptr;
+                    hit.tileType = type;
+                    hit.fraction = t;
+                    hit.normal = normal;
+                    isHit = true;
                 }
+                break;
             }
+            // 进入下一个格子
+            const int axis = tMax.x < tMax.y ? 0 : 1;
+            t = tMax[axis];
+            if (t > 1.0f) break;
+            cell[axis] += stepDir[axis];
+            tMax[axis] += tDelta[axis];
+            normal = glm::vec2(0.0f);
+            normal[axis] = static_cast<float>(-stepDir[axis]);
         }
     }
+    return isHit;
 }
 
-void PhysicsEngine::resolveTileCollisions(engine::component::PhysicsComponent* pc, float deltaTime) {
+void PhysicsEngine::resolveTileCollisions(size_t index, float deltaTime) {
     // 检查组件是否有效
-    auto* obj = pc->getOwner();
-    if (!obj) return;
-    auto* tc = obj->getComponent<engine::component::TransformComponent>();
-    auto* cc = obj->getComponent<engine::component::ColliderComponent>();
-    if (!tc || !cc || cc->isTrigger()) return;
-    auto worldAABB = cc->getWorldAABB();   // 使用最小包围盒进行碰撞检测（简化）
+    if (!m_bodies.owners[index]) return;
+    if (!m_bodies.hasFlag(index, BODY_HAS_COLLIDER) || m_bodies.hasFlag(index, BODY_TRIGGER)) return;
+    auto& velocity = m_bodies.velocities[index];
+    auto worldAABB = getBodyAABB(index);   // 使用最小包围盒进行碰撞检测（简化）
     auto objPos = worldAABB.position;
     auto objSize = worldAABB.size;
     if (worldAABB.size.x <= 0.0f || worldAABB.size.y <= 0.0f) return;
     // -- 检查结束, 正式开始处理 --
     
-    constexpr float tolerance = 1.0f;       // 检查右边缘和下边缘时，需要减1像素，否则会检查到下一行/列的瓦片
-    auto ds = pc->m_velocity * deltaTime;  // 计算物体在deltaTime内的位移
-    auto newObjPos = objPos + ds;        // 计算物体在deltaTime后的新位置
+    auto ds = velocity * deltaTime;  // 计算物体在deltaTime内的位移
 
-    if (!cc->isActive()) {  // 如果碰撞器未激活，直接让物体正常移动，然后返回。
-        tc->translate(ds);
-        pc->m_velocity = glm::clamp(pc->m_velocity, -m_maxSpeed, m_maxSpeed);
+    if (!m_bodies.hasFlag(index, BODY_COLLIDER_ACTIVE)) {  // 如果碰撞器未激活，直接让物体正常移动，然后返回。
+        m_bodies.positions[index] += ds;
+        velocity = glm::clamp(velocity, -m_maxSpeed, m_maxSpeed);
         return;
     }
 
-    // 遍历所有注册的碰撞瓦片层
-    for (auto* layer : m_collisionTileLayers) {
-        if (!layer) continue;
-        auto tileSize = layer->getTileSize();
-        // 轴分离碰撞检测：先检查X方向是否有碰撞 (y方向使用初始值objPos.y)
-        if (ds.x > 0.0f) {
-            // 检查右侧碰撞，需要分别测试右上和右下角
-            auto rightTopX = newObjPos.x + objSize.x;
-            auto tileX = static_cast<int>(floor(rightTopX / tileSize.x));   // 获取x方向瓦片坐标
-            // y方向坐标有两个，右上和右下
-            auto tileY = static_cast<int>(floor(objPos.y / tileSize.y));
-            auto tileTypeTop = layer->getTileTypeAt({tileX, tileY});        // 右上角瓦片类型
-            auto tileYBottom = static_cast<int>(floor((objPos.y + objSize.y - tolerance) / tileSize.y));
-            auto tileTypeBottom = layer->getTileTypeAt({tileX, tileYBottom});     // 右下角瓦片类型
-
-            if (tileTypeTop == engine::component::TileType::SOLID || tileTypeBottom == engine::component::TileType::SOLID) {
-                // 撞墙了！速度归零，x方向移动到贴着墙的位置
-                newObjPos.x = tileX * layer->getTileSize().x - objSize.x;
-                pc->m_velocity.x = 0.0f;
-                pc->setCollidedRight(true); // 设置碰撞标志
-            } else {
-                // 检测右下角斜坡瓦片
-                auto widthRight = newObjPos.x + objSize.x - tileX * tileSize.x;
-                auto heightRight = getTileHeightAtWidth(widthRight, tileTypeBottom, tileSize);
-                if (heightRight > 0.0f) {
-                    // 如果有碰撞（角点的世界y坐标 > 斜坡地面的世界y坐标）, 就让物体贴着斜坡表面
-                    if (newObjPos.y > (tileYBottom + 1) * layer->getTileSize().y - objSize.y - heightRight) {
-                        newObjPos.y = (tileYBottom + 1) * layer->getTileSize().y - objSize.y - heightRight;
-                        pc->setCollidedBelow(true);    // 设置碰撞标志
-                    }
-                }
-            }
-        } else if (ds.x < 0.0f) {
-            // 检查左侧碰撞，需要分别测试左上和左下角
-            auto leftTopX = newObjPos.x;
-            auto tileX = static_cast<int>(floor(leftTopX / tileSize.x));    // 获取x方向瓦片坐标
-            // y方向坐标有两个，左上和左下
-            auto tileY = static_cast<int>(floor(objPos.y / tileSize.y));
-            auto tileTypeTop = layer->getTileTypeAt({tileX, tileY});        // 左上角瓦片类型
-            auto tileYBottom = static_cast<int>(floor((objPos.y + objSize.y - tolerance) / tileSize.y));
-            auto tileTypeBottom = layer->getTileTypeAt({tileX, tileYBottom});     // 左下角瓦片类型
-
-            if (tileTypeTop == engine::component::TileType::SOLID || tileTypeBottom == engine::component::TileType::SOLID) {
-                // 撞墙了！速度归零，x方向移动到贴着墙的位置
-                newObjPos.x = (static_cast<float>(tileX) + 1.0f) * layer->getTileSize().x;
-                pc->m_velocity.x = 0.0f;
-                pc->setCollidedLeft(true); // 设置碰撞标志
-            } else {
-                // 检测左下角斜坡瓦片
-                auto widthLeft = newObjPos.x - tileX * tileSize.x;
-                auto heightLeft = getTileHeightAtWidth(widthLeft, tileTypeBottom, tileSize);
-                if (heightLeft > 0.0f) {
-                    if (newObjPos.y > (tileYBottom + 1) * layer->getTileSize().y - objSize.y - heightLeft) {
-                        newObjPos.y = (tileYBottom + 1) * layer->getTileSize().y - objSize.y - heightLeft;
-                        pc->setCollidedBelow(true);    // 设置碰撞标志
-                    }
+    // 连续检测时把位移切成每段不超过一个瓦片的小段（见 sweepTileMove），否则只做一次离散检测
+    const int steps = m_isSweptTileCollisionEnabled ? getTileSweepSteps(m_collisionTileGrids, ds) : 1;
+    TileMoveState state{velocity, m_bodies.contacts[index], m_bodies.hasFlag(index, BODY_USE_GRAVITY)};
+    const auto newObjPos = sweepTileMove(m_collisionTileGrids, objPos, objSize, ds, steps, state);
+    velocity = state.velocity;
+    m_bodies.contacts[index] = state.contacts;
+
+    // 更新物体位置，并限制最大速度
+    m_bodies.positions[index] += newObjPos - objPos;   // 使用位移量更新位置，避免直接设置位置，因为碰撞盒可能有偏移量
+    velocity = glm::clamp(velocity, -m_maxSpeed, m_maxSpeed);
+}
+
+void PhysicsEngine::resolveStaticCollisions() {
+    if (m_staticBodies.size() == 0) return;
+    // SOLID 物体之间不互相推挤，只记录碰撞对（与转为静态前相同）
+    for (const auto& [a, b] : m_staticBodies.getOverlapPairs()) {
+        m_collisionPairs.emplace_back(m_staticBodies.getOwner(a), m_staticBodies.getOwner(b));
+    }
+    constexpr std::uint8_t required = BODY_ENABLED | BODY_HAS_COLLIDER | BODY_COLLIDER_ACTIVE;
+    for (size_t i = 0; i < m_bodies.size(); ++i) {
+        if ((m_bodies.flags[i] & required) != required || !m_bodies.owners[i]) continue;
+        if (m_bodies.hasFlag(i, BODY_ASLEEP)) continue;    // 休眠的物体已经停在原处
+        if (m_bodies.hasFlag(i, BODY_SOLID)) {
+            m_staticBodies.forEachOverlap(getBodyAABB(i), [this, i](size_t s) {
+                if (collision::checkCollision(m_bodies.shapes[i], getBodyAABB(i), m_staticBodies.getShape(s), m_staticBodies.getAABB(s))) {
+                    m_collisionPairs.emplace_back(m_bodies.owners[i], m_staticBodies.getOwner(s));
                 }
-            }
+            });
+            continue;
         }
-        // 轴分离碰撞检测：再检查Y方向是否有碰撞 (x方向使用初始值objPos.x)
-        if (ds.y > 0.0f) {
-            // 检查底部碰撞，需要分别测试左下和右下角
-            auto bottomLeftY = newObjPos.y + objSize.y;
-            auto tileY = static_cast<int>(floor(bottomLeftY / tileSize.y));
-
-            auto tileX = static_cast<int>(floor(objPos.x / tileSize.x));
-            auto tileTypeLeft = layer->getTileTypeAt({tileX, tileY});           // 左下角瓦片类型   
-            auto tileXRight = static_cast<int>(floor((objPos.x + objSize.x - tolerance) / tileSize.x));
-            auto tileTypeRight = layer->getTileTypeAt({tileXRight, tileY});     // 右下角瓦片类型
-
-            if (tileTypeLeft == engine::component::TileType::SOLID || tileTypeRight == engine::component::TileType::SOLID ||
-                tileTypeLeft == engine::component::TileType::UNISOLID || tileTypeRight == engine::component::TileType::UNISOLID) {
-                // 到达地面！速度归零，y方向移动到贴着地面的位置
-                newObjPos.y = tileY * layer->getTileSize().y - objSize.y;
-                pc->m_velocity.y = 0.0f;
-                pc->setCollidedBelow(true);    // 设置碰撞标志
-            // 如果两个角点都位于梯子上，则判断是不是处在梯子顶层
-            } else if (tileTypeLeft == engine::component::TileType::LADDER && tileTypeRight == engine::component::TileType::LADDER) {
-                auto tileTypeUpL = layer->getTileTypeAt({tileX, tileY - 1});       // 检测左角点上方瓦片类型
-                auto tileTypeUpR = layer->getTileTypeAt({tileXRight, tileY - 1}); // 检测右角点上方瓦片类型
-                // 如果上方不是梯子，证明处在梯子顶层
-                if (tileTypeUpR != engine::component::TileType::LADDER && tileTypeUpL != engine::component::TileType::LADDER) {
-                    // 通过是否使用重力来区分是否处于攀爬状态。
-                    if (pc->isUseGravity()) {   // 非攀爬状态
-                        pc->setOnTopLadder(true);       // 设置在梯子顶层标志
-                        pc->setCollidedBelow(true);     // 设置下方碰撞标志
-                        // 让物体贴着梯子顶层位置(与SOLID情况相同)
-                        newObjPos.y = tileY * layer->getTileSize().y - objSize.y;
-                        pc->m_velocity.y = 0.0f;
-                    } else {}    // 攀爬状态，不做任何处理
-                }
-            } else {
-                // 检测斜坡瓦片（下方两个角点都要检测）
-                auto widthLeft = objPos.x - tileX * tileSize.x;
-                auto widthRight = objPos.x + objSize.x - tileXRight * tileSize.x;
-                auto heightLeft = getTileHeightAtWidth(widthLeft, tileTypeLeft, tileSize);
-                auto heightRight = getTileHeightAtWidth(widthRight, tileTypeRight, tileSize);
-                auto height = glm::max(heightLeft, heightRight);  // 找到两个角点的最高点进行检测
-                if (height > 0.0f) {    // 说明至少有一个角点处于斜坡瓦片
-                    if (newObjPos.y > (tileY + 1) * layer->getTileSize().y - objSize.y - height) {
-                        newObjPos.y = (tileY + 1) * layer->getTileSize().y - objSize.y - height;
-                        pc->m_velocity.y = 0.0f;     // 只有向下运动时才需要让 y 速度归零
-                        pc->setCollidedBelow(true);    // 设置碰撞标志
-                    }
-                }
-            }
-        } else if (ds.y < 0.0f) {
-            // 检查顶部碰撞，需要分别测试左上和右上角
-            auto topLeftY = newObjPos.y;
-            auto tileY = static_cast<int>(floor(topLeftY / tileSize.y));
-
-            auto tileX = static_cast<int>(floor(objPos.x / tileSize.x));
-            auto tileTypeLeft = layer->getTileTypeAt({tileX, tileY});        // 左上角瓦片类型
-            auto tileXRight = static_cast<int>(floor((objPos.x + objSize.x - tolerance) / tileSize.x));
-            auto tileTypeRight = layer->getTileTypeAt({tileXRight, tileY});     // 右上角瓦片类型
-
-            if (tileTypeLeft == engine::component::TileType::SOLID || tileTypeRight == engine::component::TileType::SOLID) {
-                // 撞到天花板！速度归零，y方向移动到贴着天花板的位置
-                newObjPos.y = (static_cast<float>(tileY) + 1.0f) * layer->getTileSize().y;
-                pc->m_velocity.y = 0.0f;
-                pc->setCollidedAbove(true);    // 设置碰撞标志
+        m_staticBodies.forEachOverlap(getBodyAABB(i), [this, i](size_t s) {
+            // 前一个静态物体可能已经把物体推开，每次都用最新的包围盒检测
+            const auto& solidAABB = m_staticBodies.getAABB(s);
+            if (collision::checkCollision(m_bodies.shapes[i], getBodyAABB(i), m_staticBodies.getShape(s), solidAABB)) {
+                resolveSolidObjectCollisions(i, solidAABB);
             }
-        }
+        });
     }
-    // 更新物体位置，并限制最大速度
-    tc->translate(newObjPos - objPos);   // 使用translate方法，避免直接设置位置，因为碰撞盒可能有偏移量
-    pc->m_velocity = glm::clamp(pc->m_velocity, -m_maxSpeed, m_maxSpeed);
 }
 
-void PhysicsEngine::resolveSolidObjectCollisions(engine::object::GameObject* moveObj, engine::object::GameObject* solidObj) {
+void PhysicsEngine::resolveSolidObjectCollisions(size_t moveIndex, const engine::utils::Rect& solidAABB) {
     // 进入此函数前，已经检查了各个组件的有效性，因此直接进行计算
-    auto* moveTC = moveObj->getComponent<engine::component::TransformComponent>();
-    auto* movePC = moveObj->getComponent<engine::component::PhysicsComponent>();
-    auto* moveCC = moveObj->getComponent<engine::component::ColliderComponent>();
-    auto* solidCC = solidObj->getComponent<engine::component::ColliderComponent>();
+    auto& movePos = m_bodies.positions[moveIndex];
+    auto& moveVel = m_bodies.velocities[moveIndex];
 
     // 这里只能获取期望位置，无法获取当前帧初始位置，因此无法进行轴分离碰撞检测
     /* 未来可以进行重构，让这里可以获取初始位置。但是我们展示另外一种处理方法 */
-    auto moveAABB = moveCC->getWorldAABB();
-    auto solidAABB = solidCC->getWorldAABB();
+    auto moveAABB = getBodyAABB(moveIndex);
 
     // --- 使用最小平移向量解决碰撞问题 ---
     auto moveCenter = moveAABB.position + moveAABB.size / 2.0f;
@@ -278,106 +750,84 @@ void PhysicsEngine::resolveSolidObjectCollisions(engine::object::GameObject* mov
     if (overlap.x < overlap.y) {    // 如果重叠部分在x方向上更小，则认为碰撞发生在x方向上（推出x方向平移向量最小）
         if (moveCenter.x < solidCenter.x) {
             // 移动物体在左边，让它贴着右边SOLID物体（相当于向左移出重叠部分），y方向正常移动
-            moveTC->translate(glm::vec2(-overlap.x, 0.0f));
+            movePos += glm::vec2(-overlap.x, 0.0f);
             // 如果速度为正(向右移动)，则归零 （if判断不可少，否则可能出现错误吸附）
-            if (movePC->m_velocity.x > 0.0f) {
-                movePC->m_velocity.x = 0.0f;
-                movePC->setCollidedRight(true);
+            if (moveVel.x > 0.0f) {
+                moveVel.x = 0.0f;
+                m_bodies.setContact(moveIndex, CONTACT_RIGHT);
             }
         } else {
             // 移动物体在右边，让它贴着左边SOLID物体（相当于向右移出重叠部分），y方向正常移动
-            moveTC->translate(glm::vec2(overlap.x, 0.0f));
-            if (movePC->m_velocity.x < 0.0f) {
-                movePC->m_velocity.x = 0.0f;
-                movePC->setCollidedLeft(true);
+            movePos += glm::vec2(overlap.x, 0.0f);
+            if (moveVel.x < 0.0f) {
+                moveVel.x = 0.0f;
+                m_bodies.setContact(moveIndex, CONTACT_LEFT);
             }
         }
     } else {                        // 重叠部分在y方向上更小，则认为碰撞发生在y方向上（推出y方向平移向量最小）
         if (moveCenter.y < solidCenter.y) {
             // 移动物体在上面，让它贴着下面SOLID物体（相当于向上移出重叠部分），x方向正常移动
-            moveTC->translate(glm::vec2(0.0f, -overlap.y));
-            if (movePC->m_velocity.y > 0.0f) {
-                movePC->m_velocity.y = 0.0f;
-                movePC->setCollidedBelow(true);
+            movePos += glm::vec2(0.0f, -overlap.y);
+            if (moveVel.y > 0.0f) {
+                moveVel.y = 0.0f;
+                m_bodies.setContact(moveIndex, CONTACT_BELOW);
             }
         } else {
             // 移动物体在下面，让它贴着上面SOLID物体（相当于向下移出重叠部分），x方向正常移动
-            moveTC->translate(glm::vec2(0.0f, overlap.y));
-            if (movePC->m_velocity.y < 0.0f) {
-                movePC->m_velocity.y = 0.0f;
-                movePC->setCollidedAbove(true);
+            movePos += glm::vec2(0.0f, overlap.y);
+            if (moveVel.y < 0.0f) {
+                moveVel.y = 0.0f;
+                m_bodies.setContact(moveIndex, CONTACT_ABOVE);
             }
         }
     }
 }
 
-void PhysicsEngine::applyWorldBounds(engine::component::PhysicsComponent *pc) {
-    if (!pc || !m_worldBounds) return;
+void PhysicsEngine::applyWorldBounds(size_t index) {
+    if (!m_worldBounds || !m_bodies.hasFlag(index, BODY_HAS_COLLIDER)) return;
 
     // 只限定左、上、右边界，不限定下边界，以碰撞盒作为判断依据
-    auto* obj = pc->getOwner();
-    auto* cc = obj->getComponent<engine::component::ColliderComponent>();
-    auto* tc = obj->getComponent<engine::component::TransformComponent>();
-    auto worldAABB = cc->getWorldAABB();
+    auto& velocity = m_bodies.velocities[index];
+    auto worldAABB = getBodyAABB(index);
     auto objPos = worldAABB.position;
     auto objSize = worldAABB.size;
 
     // 检查左边界
     if (objPos.x < m_worldBounds->position.x) {
-        pc->m_velocity.x = 0.0f;
+        velocity.x = 0.0f;
         objPos.x = m_worldBounds->position.x;
-        pc->setCollidedLeft(true);
+        m_bodies.setContact(index, CONTACT_LEFT);
     }
     // 检查上边界
     if (objPos.y < m_worldBounds->position.y) {
-        pc->m_velocity.y = 0.0f;
+        velocity.y = 0.0f;
         objPos.y = m_worldBounds->position.y;
-        pc->setCollidedAbove(true);
+        m_bodies.setContact(index, CONTACT_ABOVE);
     }
     // 检查右边界
     if (objPos.x + objSize.x > m_worldBounds->position.x + m_worldBounds->size.x) {
-        pc->m_velocity.x = 0.0f;
+        velocity.x = 0.0f;
         objPos.x = m_worldBounds->position.x + m_worldBounds->size.x - objSize.x;
-        pc->setCollidedRight(true);
-    }
-    // 更新物体位置(使用translate方法，新位置 - 旧位置)
-    tc->translate(objPos - worldAABB.position);
-}
-
-float PhysicsEngine::getTileHeightAtWidth(float width, engine::component::TileType type, glm::vec2 tileSize) {
-    auto relX = glm::clamp(width / tileSize.x, 0.0f, 1.0f);
-    switch (type) {
-        case engine::component::TileType::SLOPE_0_1:        // 左0  右1
-            return relX * tileSize.y;
-        case engine::component::TileType::SLOPE_0_2:        // 左0  右1/2
-            return relX * tileSize.y * 0.5f;
-        case engine::component::TileType::SLOPE_2_1:        // 左1/2右1
-            return relX * tileSize.y * 0.5f + tileSize.y * 0.5f;
-        case engine::component::TileType::SLOPE_1_0:        // 左1  右0
-            return (1.0f - relX) * tileSize.y;
-        case engine::component::TileType::SLOPE_2_0:        // 左1/2右0
-            return (1.0f - relX) * tileSize.y * 0.5f;
-        case engine::component::TileType::SLOPE_1_2:        // 左1  右1/2
-            return (1.0f - relX) * tileSize.y * 0.5f + tileSize.y * 0.5f;
-        default:
-            return 0.0f;   // 默认返回0，表示没有斜坡
+        m_bodies.setContact(index, CONTACT_RIGHT);
     }
+    // 更新物体位置(新位置 - 旧位置)
+    m_bodies.positions[index] += objPos - worldAABB.position;
 }
+
 void PhysicsEngine::checkTileTriggers() {
-    for (auto* pc : m_components) {
-        if (!pc || !pc->isEnabled()) continue;  // 检查组件是否有效和启用
-        auto* obj = pc->getOwner();
+    SL_PROFILE_ZONE("PhysicsEngine::checkTileTriggers");
+    constexpr std::uint8_t required = BODY_ENABLED | BODY_HAS_COLLIDER | BODY_COLLIDER_ACTIVE;
+    for (size_t i = 0; i < m_bodies.size(); ++i) {
+        if ((m_bodies.flags[i] & required) != required) continue;  // 检查组件是否启用、碰撞器是否有效
+        if (m_bodies.hasFlag(i, BODY_TRIGGER)) continue;    // 如果游戏对象本就是触发器，则不需要检查瓦片触发事件
+        auto* obj = m_bodies.owners[i];
         if (!obj) continue;
-        auto* cc = obj->getComponent<engine::component::ColliderComponent>();
-        if (!cc || !cc->isActive() || cc->isTrigger()) continue;    // 如果游戏对象本就是触发器，则不需要检查瓦片触发事件
 
         // 获取物体的世界AABB
-        auto worldAABB = cc->getWorldAABB();
+        auto worldAABB = getBodyAABB(i);
 
-        // 使用 set 来跟踪循环遍历中已经触发过的瓦片类型，防止重复添加（例如，玩家同时踩到两个尖刺，只需要受到一次伤害）
-        std::set<engine::component::TileType> triggersSet;
-
-        // 遍历所有注册的碰撞瓦片层分别进行检测
+        // 本物体在所有图层中接触到的触发器瓦片类型（位掩码：多个图层、多个同类瓦片只记一次，例如玩家同时踩到两个尖刺，只需要受到一次伤害）
+        std::uint32_t triggerTypes = 0;
         for (auto* layer : m_collisionTileLayers) {
             if (!layer) continue;
             auto tileSize = layer->getTileSize();
@@ -387,25 +837,17 @@ void PhysicsEngine::checkTileTriggers() {
             auto endX = static_cast<int>(ceil((worldAABB.position.x + worldAABB.size.x - tolerance) / tileSize.x));
             auto startY = static_cast<int>(floor(worldAABB.position.y / tileSize.y));
             auto endY = static_cast<int>(ceil((worldAABB.position.y + worldAABB.size.y - tolerance) / tileSize.y));
+            triggerTypes |= layer->getTriggerTypesIn({startX, startY}, {endX, endY});
+        }
+        if (triggerTypes == 0) continue;
 
-            // 遍历瓦片坐标范围进行检测
-            for (int x = startX; x < endX; ++x) {
-                for (int y = startY; y < endY; ++y) {
-                    auto tileType = layer->getTileTypeAt({x, y});
-                    // 未来可以添加更多触发器类型的瓦片，目前只有 HAZARD 类型
-                    if (tileType == engine::component::TileType::HAZARD) {
-                        triggersSet.insert(tileType);     // 记录触发事件，set 保证每个瓦片类型只记录一次
-                    }
-                    // 梯子类型不必记录到事件容器，物理引擎自己处理
-                    else if (tileType == engine::component::TileType::LADDER) { 
-                        pc->setCollidedLadder(true);
-                    }
-                }
-            }
-            // 遍历触发事件集合，添加到 m_tileTriggerEvents 中
-            for (const auto& type : triggersSet) {
-                m_tileTriggerEvents.emplace_back(obj, type);
-            }
+        // 梯子类型不必记录到事件容器，物理引擎自己处理
+        if (triggerTypes & engine::component::tileTypeBit(engine::component::TileType::LADDER)) {
+            m_bodies.setContact(i, CONTACT_LADDER);
+        }
+        // 其余触发器类型按类型序号从小到大各记录一次（目前只有 HAZARD 类型）
+        for (std::uint32_t events = triggerTypes & TILE_TRIGGER_EVENT_MASK; events != 0; events &= events - 1) {
+            m_tileTriggerEvents.emplace_back(obj, static_cast<engine::component::TileType>(std::countr_zero(events)));
         }
     }
 }
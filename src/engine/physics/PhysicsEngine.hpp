@@ -1,14 +1,24 @@
 #pragma once
+#include "SpatialHash.hpp"
+#include "BodyStore.hpp"
+#include "StaticBodyStore.hpp"
+#include "IntervalIndex.hpp"
+#include "PhysicsQuery.hpp"
+#include "TileSweep.hpp"
 #include "../utils/Math.hpp"
 #include <vector>
 #include <utility>  // for std::pair
 #include <optional>
+#include <cstdint>
+#include <span>
+#include <unordered_set>
 #include <glm/vec2.hpp>
 
 namespace engine::component {
     class PhysicsComponent;
+    class ColliderComponent;
     class TileLayerComponent;
-    enum class TileType;
+    enum class TileType : std::uint8_t;
 }
 
 namespace engine::object {
@@ -22,14 +32,40 @@ namespace engine::physics {
  */
 class PhysicsEngine {
 private:
-    std::vector<engine::component::PhysicsComponent*> m_components; ///< @brief 注册的物理组件容器，非拥有指针
+    BodyStore m_bodies;                         ///< @brief 注册的动态物理体（SoA紧凑存储，组件为非拥有指针）
+    StaticBodyStore m_staticBodies;             ///< @brief 静态物理体：不受重力的 SOLID 物体，从 m_bodies 中转移过来，只被动态物体查询
+    std::unordered_set<const engine::component::PhysicsComponent*> m_pinnedBodies;   ///< @brief 作为静态物体时被直接移动过的物理体，不再转为静态
     std::vector<engine::component::TileLayerComponent*> m_collisionTileLayers; ///< @brief 注册的碰撞瓦片图层容器
+    std::vector<TileGridView> m_collisionTileGrids;   ///< @brief 各碰撞瓦片图层的碰撞类型网格（与 m_collisionTileLayers 一一对应）
     std::vector<std::pair<engine::object::GameObject*, engine::object::GameObject*>> m_collisionPairs;    /// @brief 存储本帧发生的 GameObject 碰撞对 （每次 update 开始时清空）
     std::vector<std::pair<engine::object::GameObject*, engine::component::TileType>> m_tileTriggerEvents;    /// @brief 存储本帧发生的瓦片触发事件 (GameObject*, 触发的瓦片类型, 每次 update 开始时清空)
 
     glm::vec2 m_gravity = {0.0f, 980.0f};        ///< @brief 默认重力值 (像素/秒^2, 相当于100像素对应现实1m)
     float m_maxSpeed = 700.0f;                  ///< @brief 最大速度 (像素/秒)
     std::optional<engine::utils::Rect> m_worldBounds;     ///< @brief 世界边界，用于限制物体移动范围
+    bool m_isSweptTileCollisionEnabled = true;  ///< @brief 是否对瓦片层做连续碰撞检测（防止高速或大步长时穿过薄墙）
+
+    SpatialHash m_broadphase;                   ///< @brief 物体间碰撞的粗检测网格（每次 update 重建，只包含醒着的物体）
+    std::vector<std::uint32_t> m_pushedBodies;  ///< @brief 本步物体间碰撞中被 SOLID 物体推开的物体下标
+
+    /// @name 休眠
+    /// @{
+    bool m_isSleepEnabled = true;               ///< @brief 是否启用休眠
+    float m_sleepVelocityThreshold = 1.0f;      ///< @brief 速度低于此值（像素/秒）视为静止
+    int m_sleepSteps = 30;                      ///< @brief 着地且静止持续多少步后进入休眠
+    size_t m_sleepingBodyCount = 0;             ///< @brief 休眠的物理体数量
+    IntervalIndex m_sleepingIndex;              ///< @brief 休眠物体的包围盒索引（休眠物体不移动，只在集合变化时重建）
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> m_sleepingPairs;   ///< @brief 互相重叠的休眠物体对（下标，与索引一起重建，两者都休眠时每步照常输出）
+    bool m_isSleepIndexDirty = true;            ///< @brief 休眠物体集合或下标是否变化
+    /// @}
+
+    /// @name 空间查询
+    /// @{
+    bool m_isQueryDataDirty = true;             ///< @brief 物理体增删后，紧凑数据与粗检测网格的下标失效，查询前需要重新读取
+    bool m_isBroadphaseStale = false;           ///< @brief 粗检测网格中的包围盒或下标已经过时（物体被推开、物理体增删），查询前需要重建
+    std::vector<std::uint32_t> m_queryStamps;   ///< @brief 每个动态物理体最近一次被查询到的编号（去重用，也用于补充检测）
+    std::uint32_t m_queryStamp = 0;             ///< @brief 当前查询编号
+    /// @}
 
 public:
     PhysicsEngine() = default;
@@ -54,29 +90,127 @@ public:
     const glm::vec2& getGravity() const { return m_gravity; }            ///< @brief 获取当前的全局重力加速度
     void setMaxSpeed(float maxSpeed) { m_maxSpeed = maxSpeed; }       ///< @brief 设置最大速度
     float getMaxSpeed() const { return m_maxSpeed; }                    ///< @brief 获取当前的最大速度
+    void setSweptTileCollisionEnabled(bool isEnabled) { m_isSweptTileCollisionEnabled = isEnabled; }  ///< @brief 设置是否对瓦片层做连续碰撞检测
+    bool isSweptTileCollisionEnabled() const { return m_isSweptTileCollisionEnabled; }                ///< @brief 获取是否对瓦片层做连续碰撞检测
     void setWorldBounds(engine::utils::Rect worldBounds) { m_worldBounds = std::move(worldBounds); } ///< @brief 设置世界边界
     const std::optional<engine::utils::Rect>& getWorldBounds() const { return m_worldBounds; }       ///< @brief 获取世界边界
+    void setBroadphaseCellSize(float cellSize) { m_broadphase.setCellSize(cellSize); }  ///< @brief 设置粗检测网格尺寸（像素）
+    float getBroadphaseCellSize() const { return m_broadphase.getCellSize(); }           ///< @brief 获取粗检测网格尺寸
     /// @brief 获取本帧检测到的所有 GameObject 碰撞对。(此列表在每次 update 开始时清空)
     const std::vector<std::pair<engine::object::GameObject*, engine::object::GameObject*>>& getCollisionPairs() const { return m_collisionPairs; };
     /// @brief 获取本帧检测到的所有瓦片触发事件。(此列表在每次 update 开始时清空)
     const std::vector<std::pair<engine::object::GameObject*, engine::component::TileType>>& getTileTriggerEvents() const { return m_tileTriggerEvents; };
+    size_t getDynamicBodyCount() const { return m_bodies.size(); }          ///< @brief 获取动态物理体数量
+    size_t getStaticBodyCount() const { return m_staticBodies.size(); }     ///< @brief 获取静态物理体数量
+    size_t getAwakeBodyCount() const { return m_bodies.size() - m_sleepingBodyCount; }  ///< @brief 获取醒着的动态物理体数量
+    size_t getSleepingBodyCount() const { return m_sleepingBodyCount; }     ///< @brief 获取休眠的动态物理体数量
+
+    /// @name 休眠
+    /// @{
+    /**
+     * 着地 (hasCollidedBelow) 且速度持续低于阈值的物体进入休眠：不再积分、处理瓦片碰撞，也不登记到粗检测网格。
+     * 以下情况会唤醒：组件被赋予非零速度或力 (setVelocity / addForce / 直接修改 m_velocity)、位置被外部修改、
+     * 与醒着的物体接触、瓦片图层变化（注册/注销碰撞图层，或调用 wakeBodiesInRect）。
+     */
+    void setSleepEnabled(bool isEnabled);                                                   ///< @brief 设置是否启用休眠（关闭时唤醒所有物体）
+    bool isSleepEnabled() const { return m_isSleepEnabled; }                                ///< @brief 获取是否启用休眠
+    void setSleepVelocityThreshold(float threshold) { m_sleepVelocityThreshold = threshold; }  ///< @brief 设置视为静止的速度阈值（像素/秒）
+    void setSleepSteps(int steps) { m_sleepSteps = steps; }                                 ///< @brief 设置进入休眠前需要静止的步数
+    void wakeBody(engine::component::PhysicsComponent* component);                          ///< @brief 唤醒指定物理组件
+    void wakeBodiesInRect(const engine::utils::Rect& rect);                                 ///< @brief 唤醒包围盒与 rect 重叠的休眠物体（例如修改了该区域的瓦片）
+    void wakeAllBodies();                                                                   ///< @brief 唤醒所有休眠物体
+    /// @}
+
+    /// @name 空间查询
+    /// 基于粗检测网格（动态物体）、区间索引（休眠与静态物体）和瓦片网格，不遍历全部对象。
+    /// 结果对应上一次 update 结束时的位置（包括物体间碰撞的推开）；两次更新之间增删了物理体时，查询前按组件当前的数据重新读取。
+    /// 查询只读取数据，不会唤醒休眠物体或改变模拟的结果。
+    /// 结果写入调用者提供的缓冲区，热身后不分配内存。
+    /// @{
+    /**
+     * @brief 查询碰撞器与矩形重叠的对象
+     * @param box 查询矩形（世界坐标）
+     * @param results 输出缓冲区，最多写入 results.size() 个对象
+     * @param filter 过滤条件（QUERY_TILES 对此查询无效）
+     * @return 满足条件的对象总数（可能大于 results.size()，此时只写入前 results.size() 个）
+     */
+    size_t overlapBox(const engine::utils::Rect& box, std::span<engine::object::GameObject*> results, const QueryFilter& filter = {});
+    /**
+     * @brief 查询碰撞器与圆重叠的对象
+     * @param center 圆心（世界坐标）
+     * @param radius 半径
+     * @param results 输出缓冲区，最多写入 results.size() 个对象
+     * @param filter 过滤条件（QUERY_TILES 对此查询无效）
+     * @return 满足条件的对象总数（可能大于 results.size()）
+     */
+    size_t queryRadius(glm::vec2 center, float radius, std::span<engine::object::GameObject*> results, const QueryFilter& filter = {});
+    /**
+     * @brief 线段检测：找到从 from 到 to 第一个碰到的对象或瓦片
+     * @param from 起点（世界坐标）
+     * @param to 终点（世界坐标）
+     * @param hit 输出命中结果（未命中时不修改）
+     * @param filter 过滤条件（瓦片按 filter.tileMask 判断，斜坡瓦片按整个格子处理）
+     * @return 是否命中
+     */
+    bool raycast(glm::vec2 from, glm::vec2 to, RaycastHit& hit, const QueryFilter& filter = {});
+    /**
+     * @brief 查找碰撞器中心距离 point 最近（不超过 maxDistance）的对象，通常配合 filter.tag 使用
+     * @return 最近的对象，没有则返回 nullptr
+     */
+    engine::object::GameObject* findNearest(glm::vec2 point, float maxDistance, const QueryFilter& filter = {});
+    /// @}
 
 private:
+    /**
+     * @brief 把满足条件的物理体从 m_bodies 转移到 m_staticBodies
+     *
+     * 条件：组件启用、不受重力、速度与受力为零、标签为 "solid"、拥有有效且激活的非触发器碰撞器。
+     * 标签和碰撞器通常在物理组件注册之后才设置，因此在每次更新开始时检查，而不是在注册时。
+     * 作为静态物体时被直接移动过的物理体（m_pinnedBodies）不再转为静态。
+     */
+    void promoteStaticBodies();
+    /**
+     * @brief 把不再满足条件的静态物体转回 m_bodies（在 promoteStaticBodies 之前调用）
+     *
+     * 例如被赋予了速度或力、启用了重力、组件被禁用、碰撞器或标签被修改，或者位置、缩放被直接修改。
+     * 只检查组件上的几个字段，不读取完整的物理数据。
+     */
+    void demoteStaticBodies();
+    /// @brief 向 m_bodies 追加物理体，并标记休眠索引与查询数据需要重建
+    void addBody(engine::component::PhysicsComponent* component, engine::object::GameObject* owner,
+                 engine::component::ColliderComponent* collider);
+    /// @brief 从 m_bodies 移除物理体（所有移除都经过这里）：维护休眠计数，并标记休眠索引与查询数据需要重建
+    void removeBodyAt(size_t index);
+    void gatherBodies();                ///< @brief 从组件中读取本次更新所需的数据到 m_bodies，并唤醒被外部改变的休眠物体
+    void readBody(size_t index);        ///< @brief 从组件中读取一个物理体的数据（不改变休眠状态，空间查询也使用）
+    void integrateBodies(float deltaTime);  ///< @brief 对每个物理体应用重力、更新速度，并处理瓦片碰撞与世界边界
+    void scatterBodies();               ///< @brief 将 m_bodies 中的计算结果写回组件
+    engine::utils::Rect getBodyAABB(size_t index) const;   ///< @brief 获取物理体当前的世界坐标包围盒
     void checkObjectCollisions();       ///< @brief 检测并处理对象之间的碰撞，并记录需要游戏逻辑处理的碰撞对。
-    /// @brief 检测并处理游戏对象和瓦片层之间的碰撞。
-    void resolveTileCollisions(engine::component::PhysicsComponent* pc, float deltaTime);
+    /// @brief 检测并处理物理体和瓦片层之间的碰撞。
+    void resolveTileCollisions(size_t index, float deltaTime);
     /// @brief 处理可移动物体与SOLID物体的碰撞。
-    void resolveSolidObjectCollisions(engine::object::GameObject* moveObj, engine::object::GameObject* solidObj);
-    void applyWorldBounds(engine::component::PhysicsComponent* pc);     ///< @brief 应用世界边界，限制物体移动范围
-
+    void resolveSolidObjectCollisions(size_t moveIndex, const engine::utils::Rect& solidAABB);
+    void resolveStaticCollisions();     ///< @brief 处理所有动态物体与静态物体的碰撞
+    /// @brief 被推开的物体可能与登记时不相邻的物体重叠：用推开后的包围盒再查询一次网格，检测第一轮没有检测过的物体对
+    void retestPushedBodies(const std::vector<std::pair<std::uint32_t, std::uint32_t>>& pairs);
+    std::uint32_t nextQueryStamp();     ///< @brief 开始新一轮去重，返回本轮编号（m_queryStamps 不足时扩容）
+    void handleBodyContact(size_t a, size_t b);  ///< @brief 处理两个已确认重叠的动态物体（a < b）：推开 SOLID 物体或记录碰撞对
+    void checkSleepingContacts();       ///< @brief 输出休眠物体之间的碰撞对，检测醒着的物体与休眠物体的接触（记录碰撞对并唤醒休眠物体）
+    void updateSleepStates();           ///< @brief 更新静止计数，让静止足够久的物体进入休眠
+    void wakeBodyAt(size_t index);      ///< @brief 唤醒下标为 index 的物理体
+    void rebuildBroadphase();           ///< @brief 把醒着的有效碰撞体重新登记到粗检测网格中
+    void rebuildSleepingIndex();        ///< @brief 如果休眠物体集合有变化，重建 m_sleepingIndex 与 m_sleepingPairs
+    void refreshQueryData();            ///< @brief 空间查询前确保紧凑数据、粗检测网格和索引与当前注册的物理体一致
     /**
-     * @brief 根据瓦片类型和指定宽度x坐标，计算瓦片上对应y坐标。
-     * @param width 从瓦片左侧起算的宽度。
-     * @param type 瓦片类型。
-     * @param tileSize 瓦片尺寸。
-     * @return 瓦片上对应高度（从瓦片下侧起算）。
+     * @brief 遍历包围盒与 rect 重叠、且满足过滤条件的对象（粗检测，每个对象最多回调一次）
+     * @param fn 回调，参数为 (GameObject*, ColliderType, const Rect& 世界坐标包围盒)
      */
-    float getTileHeightAtWidth(float width, engine::component::TileType type, glm::vec2 tileSize);
+    template <typename Fn>
+    void forEachQueryCandidate(const engine::utils::Rect& rect, const QueryFilter& filter, Fn&& fn);
+    /// @brief 对所有碰撞瓦片层做线段检测，命中比 hit.fraction 更近的瓦片时更新 hit
+    bool raycastTiles(glm::vec2 from, glm::vec2 delta, RaycastHit& hit, std::uint32_t tileMask) const;
+    void applyWorldBounds(size_t index);     ///< @brief 应用世界边界，限制物体移动范围
 
     /**
      * @brief 检测所有游戏对象与瓦片层的触发器类型瓦片碰撞，并记录触发事件。(位移处理完毕后再调用)
@@ -0,0 +1,48 @@
+#pragma once
+#include "../component/TilelayerComponent.hpp"
+
+#include <glm/vec2.hpp>
+
+#include <cstdint>
+#include <string_view>
+
+namespace engine::object {
+    class GameObject;
+}
+
+namespace engine::physics {
+
+/**
+ * @brief 空间查询的查询对象标志位（QueryFilter::flags）
+ */
+enum QueryFlags : std::uint8_t {
+    QUERY_DYNAMIC  = 1 << 0,    ///< @brief 动态物体（包括休眠的物体）
+    QUERY_STATIC   = 1 << 1,    ///< @brief 静态物体（不会移动的 SOLID 物体）
+    QUERY_TRIGGERS = 1 << 2,    ///< @brief 包括碰撞器为触发器的物体
+    QUERY_TILES    = 1 << 3,    ///< @brief 射线检测时包括瓦片层
+    QUERY_ALL      = QUERY_DYNAMIC | QUERY_STATIC | QUERY_TRIGGERS | QUERY_TILES,
+};
+
+/**
+ * @brief 空间查询的过滤条件
+ */
+struct QueryFilter {
+    std::uint8_t flags = QUERY_ALL;                 ///< @brief QueryFlags 组合
+    std::string_view tag;                           ///< @brief 只返回此标签的对象（为空时不按标签过滤）
+    /// @brief 射线检测时视为阻挡的瓦片类型（tileTypeBit 组合），默认只有实心瓦片
+    std::uint32_t tileMask = engine::component::tileTypeBit(engine::component::TileType::SOLID);
+    const engine::object::GameObject* ignore = nullptr;    ///< @brief 忽略的对象（通常是发起查询的对象自身）
+};
+
+/**
+ * @brief 射线检测的结果
+ */
+struct RaycastHit {
+    engine::object::GameObject* object = nullptr;   ///< @brief 命中的对象（命中瓦片时为 nullptr）
+    engine::component::TileType tileType = engine::component::TileType::EMPTY;  ///< @brief 命中的瓦片类型（命中对象时为 EMPTY）
+    glm::vec2 point = {0.0f, 0.0f};                 ///< @brief 命中点（世界坐标）
+    glm::vec2 normal = {0.0f, 0.0f};                ///< @brief 命中面的法线（起点已在物体或瓦片内部时为零向量）
+    float fraction = 1.0f;                          ///< @brief 命中点在线段上的比例 [0, 1]
+};
+
+} // namespace engine::physics
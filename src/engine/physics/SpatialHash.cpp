@@ -0,0 +1,100 @@
+#include "SpatialHash.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace engine::physics {
+
+SpatialHash::SpatialHash(float cellSize) {
+    setCellSize(cellSize);
+}
+
+void SpatialHash::clear() {
+    m_entries.clear();
+    m_ids.clear();
+    m_oversized.clear();
+    m_pairKeys.clear();
+    m_pairs.clear();
+    m_isSorted = true;
+}
+
+void SpatialHash::insert(std::uint32_t id, const engine::utils::Rect& aabb) {
+    m_ids.push_back(id);
+    m_isSorted = false;
+    // 计算AABB覆盖的网格范围（右边缘和下边缘是开区间，与 checkAABBOverlap 的判断保持一致）
+    const int startX = static_cast<int>(std::floor(aabb.position.x * m_invCellSize));
+    const int startY = static_cast<int>(std::floor(aabb.position.y * m_invCellSize));
+    const int endX = static_cast<int>(std::floor((aabb.position.x + aabb.size.x) * m_invCellSize));
+    const int endY = static_cast<int>(std::floor((aabb.position.y + aabb.size.y) * m_invCellSize));
+
+    const long long cellCount = static_cast<long long>(endX - startX + 1) * (endY - startY + 1);
+    if (cellCount > MAX_CELLS_PER_BODY) {
+        m_oversized.push_back(id);
+        return;
+    }
+    for (int y = startY; y <= endY; ++y) {
+        for (int x = startX; x <= endX; ++x) {
+            m_entries.push_back({makeKey(x, y), id});
+        }
+    }
+}
+
+const std::vector<std::pair<std::uint32_t, std::uint32_t>>& SpatialHash::computePairs() {
+    m_pairKeys.clear();
+    m_pairs.clear();
+
+    // 1. 按网格键排序，同一网格内的物体会排在一起
+    build();
+
+    // 2. 同一网格内的物体两两组成候选对
+    for (size_t runBegin = 0; runBegin < m_entries.size();) {
+        size_t runEnd = runBegin + 1;
+        while (runEnd < m_entries.size() && m_entries[runEnd].key == m_entries[runBegin].key) {
+            ++runEnd;
+        }
+        for (size_t i = runBegin; i < runEnd; ++i) {
+            for (size_t j = i + 1; j < runEnd; ++j) {
+                m_pairKeys.push_back(makePairKey(m_entries[i].id, m_entries[j].id));
+            }
+        }
+        runBegin = runEnd;
+    }
+
+    // 3. 超大物体与所有物体组成候选对
+    for (auto big : m_oversized) {
+        for (auto id : m_ids) {
+            if (id != big) m_pairKeys.push_back(makePairKey(big, id));
+        }
+    }
+
+    // 4. 排序去重（同一对物体可能共享多个网格），顺序即 (a, b) 的字典序
+    std::sort(m_pairKeys.begin(), m_pairKeys.end());
+    m_pairKeys.erase(std::unique(m_pairKeys.begin(), m_pairKeys.end()), m_pairKeys.end());
+
+    m_pairs.reserve(m_pairKeys.size());
+    for (auto key : m_pairKeys) {
+        m_pairs.emplace_back(static_cast<std::uint32_t>(key >> 32), static_cast<std::uint32_t>(key & 0xFFFFFFFFu));
+    }
+    return m_pairs;
+}
+
+void SpatialHash::build() {
+    if (m_isSorted) return;
+    std::sort(m_entries.begin(), m_entries.end(), [](const CellEntry& a, const CellEntry& b) {
+        return a.key < b.key;
+    });
+    m_isSorted = true;
+}
+
+void SpatialHash::setCellSize(float cellSize) {
+    if (cellSize <= 0.0f) {
+        spdlog::warn("SPATIALHASH::setCellSize::网格尺寸必须为正数: {}, 保持原值 {}", cellSize, m_cellSize);
+        return;
+    }
+    m_cellSize = cellSize;
+    m_invCellSize = 1.0f / cellSize;
+}
+
+} // namespace engine::physics
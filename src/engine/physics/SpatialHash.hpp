@@ -0,0 +1,114 @@
+#pragma once
+#include "../utils/Math.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include <utility>
+
+namespace engine::physics {
+
+/**
+ * @brief 均匀网格空间哈希，用作物体间碰撞检测的粗检测阶段 (broadphase)。
+ *
+ * 每次物理更新时重建：先用 insert() 把所有碰撞体的 AABB 按网格单元登记，
+ * 再调用 computePairs() 得到所有“至少共享一个网格单元”的候选对。
+ * 候选对按 (较小id, 较大id) 升序排列，与原先两层循环的遍历顺序一致。
+ * build() 之后（computePairs 会自动调用）还可以用 forEachCandidate() 查询任意矩形范围内的物体。
+ *
+ * @note 内部只使用排序后的连续数组（不使用 unordered_map），容器在帧间复用，热身后不再分配内存。
+ */
+class SpatialHash final {
+private:
+    /// @brief 网格单元登记项：单元键 + 物体id
+    struct CellEntry {
+        std::uint64_t key;
+        std::uint32_t id;
+    };
+
+    /// @brief 单个物体最多登记的网格单元数，超过则视为“超大物体”，与所有物体配对（避免巨型触发器把登记表撑爆）
+    static constexpr int MAX_CELLS_PER_BODY = 256;
+
+    float m_cellSize = 64.0f;                                   ///< @brief 网格单元边长（像素）
+    float m_invCellSize = 1.0f / 64.0f;                         ///< @brief 网格单元边长的倒数，避免每次除法
+    std::vector<CellEntry> m_entries;                           ///< @brief 所有网格登记项（computePairs 时排序）
+    std::vector<std::uint32_t> m_ids;                           ///< @brief 本轮登记过的所有物体id
+    std::vector<std::uint32_t> m_oversized;                     ///< @brief 覆盖网格过多的超大物体id
+    std::vector<std::uint64_t> m_pairKeys;                      ///< @brief 编码后的候选对 (a << 32 | b)，用于排序去重
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> m_pairs; ///< @brief 最终输出的候选对
+    bool m_isSorted = true;                                     ///< @brief m_entries 是否已按网格键排序
+
+public:
+    /**
+     * @brief 构造函数
+     * @param cellSize 网格单元边长（像素），一般取常见物体尺寸的 2~4 倍
+     */
+    explicit SpatialHash(float cellSize = 64.0f);
+
+    /// @brief 清空本轮登记的数据（保留容量）
+    void clear();
+
+    /**
+     * @brief 登记一个物体
+     * @param id 物体id（由调用者决定，通常为物体在注册容器中的下标）
+     * @param aabb 物体的世界坐标包围盒
+     */
+    void insert(std::uint32_t id, const engine::utils::Rect& aabb);
+
+    /// @brief 按网格键对登记项排序（已排序时直接返回），之后 forEachCandidate 才能按网格查找
+    void build();
+
+    /**
+     * @brief 计算候选碰撞对
+     * @return 候选对列表 (first < second)，按字典序升序排列，不含重复项
+     */
+    const std::vector<std::pair<std::uint32_t, std::uint32_t>>& computePairs();
+
+    /**
+     * @brief 遍历与 rect 共享网格单元的物体（粗检测，同一物体可能被回调多次，需要调用者去重）
+     * @param rect 查询范围（世界坐标）
+     * @param fn 回调，参数为登记时的物体id (std::uint32_t)
+     * @note 未 build() 或范围覆盖的网格过多时，退化为遍历本轮登记的所有物体。
+     */
+    template <typename Fn>
+    void forEachCandidate(const engine::utils::Rect& rect, Fn&& fn) const {
+        const int startX = static_cast<int>(std::floor(rect.position.x * m_invCellSize));
+        const int startY = static_cast<int>(std::floor(rect.position.y * m_invCellSize));
+        const int endX = static_cast<int>(std::floor((rect.position.x + rect.size.x) * m_invCellSize));
+        const int endY = static_cast<int>(std::floor((rect.position.y + rect.size.y) * m_invCellSize));
+        const long long cellCount = static_cast<long long>(endX - startX + 1) * (endY - startY + 1);
+        if (!m_isSorted || cellCount > MAX_CELLS_PER_BODY) {
+            for (auto id : m_ids) fn(id);
+            return;
+        }
+        for (int y = startY; y <= endY; ++y) {
+            for (int x = startX; x <= endX; ++x) {
+                const auto key = makeKey(x, y);
+                auto it = std::lower_bound(m_entries.begin(), m_entries.end(), key, [](const CellEntry& entry, std::uint64_t k) {
+                    return entry.key < k;
+                });
+                for (; it != m_entries.end() && it->key == key; ++it) {
+                    fn(it->id);
+                }
+            }
+        }
+        for (auto id : m_oversized) fn(id);
+    }
+
+    void setCellSize(float cellSize);                       ///< @brief 设置网格单元边长（只在下一次 clear() 后生效）
+    float getCellSize() const { return m_cellSize; }        ///< @brief 获取网格单元边长
+
+private:
+    /// @brief 把网格坐标编码为64位键
+    static std::uint64_t makeKey(int cellX, int cellY) {
+        return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(cellX)) << 32) | static_cast<std::uint32_t>(cellY);
+    }
+    /// @brief 把 (a, b) 编码为64位键，保证 a < b
+    static std::uint64_t makePairKey(std::uint32_t a, std::uint32_t b) {
+        if (a > b) std::swap(a, b);
+        return (static_cast<std::uint64_t>(a) << 32) | b;
+    }
+};
+
+} // namespace engine::physics
@@ -0,0 +1,54 @@
+#include "StaticBodyStore.hpp"
+#include "Collision.hpp"
+
+#include <algorithm>
+
+namespace engine::physics {
+
+void StaticBodyStore::add(engine::component::PhysicsComponent* component, engine::object::GameObject* owner,
+                          const engine::utils::Rect& aabb, ColliderType shape) {
+    m_components.push_back(component);
+    m_owners.push_back(owner);
+    m_aabbs.push_back(aabb);
+    m_shapes.push_back(shape);
+    m_isDirty = true;
+}
+
+bool StaticBodyStore::remove(engine::component::PhysicsComponent* component) {
+    auto it = std::find(m_components.begin(), m_components.end(), component);
+    if (it == m_components.end()) return false;
+    removeAt(static_cast<size_t>(it - m_components.begin()));
+    return true;
+}
+
+void StaticBodyStore::removeAt(size_t index) {
+    m_components.erase(m_components.begin() + index);
+    m_owners.erase(m_owners.begin() + index);
+    m_aabbs.erase(m_aabbs.begin() + index);
+    m_shapes.erase(m_shapes.begin() + index);
+    m_isDirty = true;
+}
+
+void StaticBodyStore::rebuild() {
+    if (!m_isDirty) return;
+    m_isDirty = false;
+    m_index.clear();
+    for (size_t i = 0; i < m_aabbs.size(); ++i) {
+        m_index.add(static_cast<std::uint32_t>(i), m_aabbs[i]);
+    }
+    m_index.build();
+
+    // 静态物体不移动，重叠关系在下次增删前不变
+    m_overlapPairs.clear();
+    for (size_t i = 0; i < m_aabbs.size(); ++i) {
+        m_index.forEachOverlap(m_aabbs[i], [this, i](std::uint32_t j) {
+            if (j <= i) return;
+            if (collision::checkCollision(m_shapes[i], m_aabbs[i], m_shapes[j], m_aabbs[j])) {
+                m_overlapPairs.emplace_back(static_cast<std::uint32_t>(i), j);
+            }
+        });
+    }
+    std::sort(m_overlapPairs.begin(), m_overlapPairs.end());
+}
+
+} // namespace engine::physics
@@ -0,0 +1,68 @@
+#pragma once
+#include "Collider.hpp"
+#include "IntervalIndex.hpp"
+#include "../utils/Math.hpp"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace engine::component {
+    class PhysicsComponent;
+}
+
+namespace engine::object {
+    class GameObject;
+}
+
+namespace engine::physics {
+
+/**
+ * @brief 静态物理体（不会移动的 SOLID 物体）的存储与查询结构。
+ *
+ * 静态物体不参与积分、瓦片碰撞、世界边界与触发检测，只被动态物体查询。
+ * 包围盒在加入时记录一次，之后放入 IntervalIndex（按左边界排序），只在增删后重建。
+ * 静态物体之间的重叠也只在重建时计算一次，每步照常作为碰撞对输出（与转为静态前相同）。
+ */
+class StaticBodyStore final {
+private:
+    std::vector<engine::component::PhysicsComponent*> m_components;  ///< @brief 物理组件（非拥有，用于注销）
+    std::vector<engine::object::GameObject*> m_owners;              ///< @brief 所属 GameObject（非拥有）
+    std::vector<engine::utils::Rect> m_aabbs;                       ///< @brief 世界坐标包围盒
+    std::vector<ColliderType> m_shapes;                             ///< @brief 碰撞器形状
+
+    IntervalIndex m_index;                  ///< @brief 包围盒索引
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> m_overlapPairs;   ///< @brief 互相重叠的静态物体对（下标）
+    bool m_isDirty = false;                 ///< @brief 是否需要重新排序
+
+public:
+    /// @brief 加入一个静态物体
+    void add(engine::component::PhysicsComponent* component, engine::object::GameObject* owner,
+             const engine::utils::Rect& aabb, ColliderType shape);
+    /// @brief 移除组件对应的静态物体，返回是否找到
+    bool remove(engine::component::PhysicsComponent* component);
+    /// @brief 按下标移除静态物体（其后的下标减一）
+    void removeAt(size_t index);
+    /// @brief 如有增删，重新排序并计算互相重叠的静态物体对（每次物理更新开始时调用）
+    void rebuild();
+
+    size_t size() const { return m_components.size(); }                                        ///< @brief 静态物体数量
+    const engine::utils::Rect& getAABB(size_t index) const { return m_aabbs[index]; }           ///< @brief 获取包围盒
+    ColliderType getShape(size_t index) const { return m_shapes[index]; }                       ///< @brief 获取碰撞器形状
+    engine::object::GameObject* getOwner(size_t index) const { return m_owners[index]; }        ///< @brief 获取所属 GameObject
+    engine::component::PhysicsComponent* getComponent(size_t index) const { return m_components[index]; }   ///< @brief 获取物理组件
+    /// @brief 互相重叠的静态物体对（下标，需先调用 rebuild）
+    const std::vector<std::pair<std::uint32_t, std::uint32_t>>& getOverlapPairs() const { return m_overlapPairs; }
+
+    /**
+     * @brief 遍历包围盒与 rect 重叠的静态物体（需先调用 rebuild）
+     * @param rect 查询范围（世界坐标）
+     * @param fn 回调，参数为静态物体下标 (size_t)
+     */
+    template <typename Fn>
+    void forEachOverlap(const engine::utils::Rect& rect, Fn&& fn) const {
+        m_index.forEachOverlap(rect, [&fn](std::uint32_t index) { fn(static_cast<size_t>(index)); });
+    }
+};
+
+} // namespace engine::physics
@@ -0,0 +1,192 @@
+#include "TileSweep.hpp"
+#include "BodyStore.hpp"
+
+#include <glm/common.hpp>
+
+#include <cmath>
+
+namespace engine::physics {
+
+using engine::component::TileType;
+
+float getTileHeightAtWidth(float width, TileType type, glm::vec2 tileSize) {
+    auto relX = glm::clamp(width / tileSize.x, 0.0f, 1.0f);
+    switch (type) {
+        case TileType::SLOPE_0_1:        // 左0  右1
+            return relX * tileSize.y;
+        case TileType::SLOPE_0_2:        // 左0  右1/2
+            return relX * tileSize.y * 0.5f;
+        case TileType::SLOPE_2_1:        // 左1/2右1
+            return relX * tileSize.y * 0.5f + tileSize.y * 0.5f;
+        case TileType::SLOPE_1_0:        // 左1  右0
+            return (1.0f - relX) * tileSize.y;
+        case TileType::SLOPE_2_0:        // 左1/2右0
+            return (1.0f - relX) * tileSize.y * 0.5f;
+        case TileType::SLOPE_1_2:        // 左1  右1/2
+            return (1.0f - relX) * tileSize.y * 0.5f + tileSize.y * 0.5f;
+        default:
+            return 0.0f;   // 默认返回0，表示没有斜坡
+    }
+}
+
+glm::vec2 resolveTileMove(std::span<const TileGridView> layers, glm::vec2 objPos, glm::vec2 objSize, glm::vec2 ds,
+                          TileMoveState& state) {
+    auto& velocity = state.velocity;
+    constexpr float tolerance = 1.0f;       // 检查右边缘和下边缘时，需要减1像素，否则会检查到下一行/列的瓦片
+    auto newObjPos = objPos + ds;        // 计算物体移动后的新位置
+
+    // 遍历所有碰撞瓦片层
+    for (const auto& layer : layers) {
+        if (!layer.cells) continue;
+        auto tileSize = layer.tileSize;
+        // 轴分离碰撞检测：先检查X方向是否有碰撞 (y方向使用初始值objPos.y)
+        if (ds.x > 0.0f) {
+            // 检查右侧碰撞，需要分别测试右上和右下角
+            auto rightTopX = newObjPos.x + objSize.x;
+            auto tileX = static_cast<int>(floor(rightTopX / tileSize.x));   // 获取x方向瓦片坐标
+            // y方向坐标有两个，右上和右下
+            auto tileY = static_cast<int>(floor(objPos.y / tileSize.y));
+            auto tileTypeTop = layer.getCollisionTypeAt({tileX, tileY});        // 右上角瓦片类型
+            auto tileYBottom = static_cast<int>(floor((objPos.y + objSize.y - tolerance) / tileSize.y));
+            auto tileTypeBottom = layer.getCollisionTypeAt({tileX, tileYBottom});     // 右下角瓦片类型
+
+            if (tileTypeTop == TileType::SOLID || tileTypeBottom == TileType::SOLID) {
+                // 撞墙了！速度归零，x方向移动到贴着墙的位置
+                newObjPos.x = tileX * tileSize.x - objSize.x;
+                velocity.x = 0.0f;
+                state.contacts |= CONTACT_RIGHT; // 设置碰撞标志
+            } else {
+                // 检测右下角斜坡瓦片
+                auto widthRight = newObjPos.x + objSize.x - tileX * tileSize.x;
+                auto heightRight = getTileHeightAtWidth(widthRight, tileTypeBottom, tileSize);
+                if (heightRight > 0.0f) {
+                    // 如果有碰撞（角点的世界y坐标 > 斜坡地面的世界y坐标）, 就让物体贴着斜坡表面
+                    if (newObjPos.y > (tileYBottom + 1) * tileSize.y - objSize.y - heightRight) {
+                        newObjPos.y = (tileYBottom + 1) * tileSize.y - objSize.y - heightRight;
+                        state.contacts |= CONTACT_BELOW;    // 设置碰撞标志
+                    }
+                }
+            }
+        } else if (ds.x < 0.0f) {
+            // 检查左侧碰撞，需要分别测试左上和左下角
+            auto leftTopX = newObjPos.x;
+            auto tileX = static_cast<int>(floor(leftTopX / tileSize.x));    // 获取x方向瓦片坐标
+            // y方向坐标有两个，左上和左下
+            auto tileY = static_cast<int>(floor(objPos.y / tileSize.y));
+            auto tileTypeTop = layer.getCollisionTypeAt({tileX, tileY});        // 左上角瓦片类型
+            auto tileYBottom = static_cast<int>(floor((objPos.y + objSize.y - tolerance) / tileSize.y));
+            auto tileTypeBottom = layer.getCollisionTypeAt({tileX, tileYBottom});     // 左下角瓦片类型
+
+            if (tileTypeTop == TileType::SOLID || tileTypeBottom == TileType::SOLID) {
+                // 撞墙了！速度归零，x方向移动到贴着墙的位置
+                newObjPos.x = (static_cast<float>(tileX) + 1.0f) * tileSize.x;
+                velocity.x = 0.0f;
+                state.contacts |= CONTACT_LEFT; // 设置碰撞标志
+            } else {
+                // 检测左下角斜坡瓦片
+                auto widthLeft = newObjPos.x - tileX * tileSize.x;
+                auto heightLeft = getTileHeightAtWidth(widthLeft, tileTypeBottom, tileSize);
+                if (heightLeft > 0.0f) {
+                    if (newObjPos.y > (tileYBottom + 1) * tileSize.y - objSize.y - heightLeft) {
+                        newObjPos.y = (tileYBottom + 1) * tileSize.y - objSize.y - heightLeft;
+                        state.contacts |= CONTACT_BELOW;    // 设置碰撞标志
+                    }
+                }
+            }
+        }
+        // 轴分离碰撞检测：再检查Y方向是否有碰撞 (x方向使用X方向处理后的newObjPos.x，
+        // 使用初始值时斜向移动的角点会跳过拐角处的瓦片，斜坡高度也会滞后一步)
+        if (ds.y > 0.0f) {
+            // 检查底部碰撞，需要分别测试左下和右下角
+            auto bottomLeftY = newObjPos.y + objSize.y;
+            auto tileY = static_cast<int>(floor(bottomLeftY / tileSize.y));
+
+            auto tileX = static_cast<int>(floor(newObjPos.x / tileSize.x));
+            auto tileTypeLeft = layer.getCollisionTypeAt({tileX, tileY});           // 左下角瓦片类型
+            auto tileXRight = static_cast<int>(floor((newObjPos.x + objSize.x - tolerance) / tileSize.x));
+            auto tileTypeRight = layer.getCollisionTypeAt({tileXRight, tileY});     // 右下角瓦片类型
+
+            if (tileTypeLeft == TileType::SOLID || tileTypeRight == TileType::SOLID ||
+                tileTypeLeft == TileType::UNISOLID || tileTypeRight == TileType::UNISOLID) {
+                // 到达地面！速度归零，y方向移动到贴着地面的位置
+                newObjPos.y = tileY * tileSize.y - objSize.y;
+                velocity.y = 0.0f;
+                state.contacts |= CONTACT_BELOW;    // 设置碰撞标志
+            // 如果两个角点都位于梯子上，则判断是不是处在梯子顶层
+            } else if (tileTypeLeft == TileType::LADDER && tileTypeRight == TileType::LADDER) {
+                auto tileTypeUpL = layer.getCollisionTypeAt({tileX, tileY - 1});       // 检测左角点上方瓦片类型
+                auto tileTypeUpR = layer.getCollisionTypeAt({tileXRight, tileY - 1}); // 检测右角点上方瓦片类型
+                // 如果上方不是梯子，证明处在梯子顶层
+                if (tileTypeUpR != TileType::LADDER && tileTypeUpL != TileType::LADDER) {
+                    // 通过是否使用重力来区分是否处于攀爬状态。
+                    if (state.useGravity) {   // 非攀爬状态
+                        state.contacts |= CONTACT_TOP_LADDER;      // 设置在梯子顶层标志
+                        state.contacts |= CONTACT_BELOW;           // 设置下方碰撞标志
+                        // 让物体贴着梯子顶层位置(与SOLID情况相同)
+                        newObjPos.y = tileY * tileSize.y - objSize.y;
+                        velocity.y = 0.0f;
+                    } else {}    // 攀爬状态，不做任何处理
+                }
+            } else {
+                // 检测斜坡瓦片（下方两个角点都要检测）
+                auto widthLeft = newObjPos.x - tileX * tileSize.x;
+                auto widthRight = newObjPos.x + objSize.x - tileXRight * tileSize.x;
+                auto heightLeft = getTileHeightAtWidth(widthLeft, tileTypeLeft, tileSize);
+                auto heightRight = getTileHeightAtWidth(widthRight, tileTypeRight, tileSize);
+                auto height = glm::max(heightLeft, heightRight);  // 找到两个角点的最高点进行检测
+                if (height > 0.0f) {    // 说明至少有一个角点处于斜坡瓦片
+                    if (newObjPos.y > (tileY + 1) * tileSize.y - objSize.y - height) {
+                        newObjPos.y = (tileY + 1) * tileSize.y - objSize.y - height;
+                        velocity.y = 0.0f;     // 只有向下运动时才需要让 y 速度归零
+                        state.contacts |= CONTACT_BELOW;    // 设置碰撞标志
+                    }
+                }
+            }
+        } else if (ds.y < 0.0f) {
+            // 检查顶部碰撞，需要分别测试左上和右上角
+            auto topLeftY = newObjPos.y;
+            auto tileY = static_cast<int>(floor(topLeftY / tileSize.y));
+
+            auto tileX = static_cast<int>(floor(newObjPos.x / tileSize.x));
+            auto tileTypeLeft = layer.getCollisionTypeAt({tileX, tileY});        // 左上角瓦片类型
+            auto tileXRight = static_cast<int>(floor((newObjPos.x + objSize.x - tolerance) / tileSize.x));
+            auto tileTypeRight = layer.getCollisionTypeAt({tileXRight, tileY});     // 右上角瓦片类型
+
+            if (tileTypeLeft == TileType::SOLID || tileTypeRight == TileType::SOLID) {
+                // 撞到天花板！速度归零，y方向移动到贴着天花板的位置
+                newObjPos.y = (static_cast<float>(tileY) + 1.0f) * tileSize.y;
+                velocity.y = 0.0f;
+                state.contacts |= CONTACT_ABOVE;    // 设置碰撞标志
+            }
+        }
+    }
+    return newObjPos;
+}
+
+int getTileSweepSteps(std::span<const TileGridView> layers, glm::vec2 ds) {
+    int steps = 1;
+    for (const auto& layer : layers) {
+        if (!layer.cells || layer.tileSize.x <= 0.0f || layer.tileSize.y <= 0.0f) continue;
+        const float cells = glm::max(glm::abs(ds.x) / layer.tileSize.x, glm::abs(ds.y) / layer.tileSize.y);
+        steps = glm::max(steps, static_cast<int>(glm::ceil(cells)));
+    }
+    return steps;
+}
+
+glm::vec2 sweepTileMove(std::span<const TileGridView> layers, glm::vec2 objPos, glm::vec2 objSize, glm::vec2 ds,
+                        int steps, TileMoveState& state) {
+    // 连续检测：把位移切成每段不超过一个瓦片的小段逐段检测，保证前沿经过的每一行/列瓦片都被检查到，
+    // 在第一次碰撞处停下（碰撞后该方向速度归零，之后的小段不再沿该方向移动）。单段时与离散检测完全相同。
+    steps = glm::max(steps, 1);
+    const auto stepDs = ds / static_cast<float>(steps);
+    auto newObjPos = objPos;
+    for (int step = 0; step < steps; ++step) {
+        // 已经撞到的方向不再继续移动
+        const glm::vec2 segment = {state.velocity.x != 0.0f ? stepDs.x : 0.0f, state.velocity.y != 0.0f ? stepDs.y : 0.0f};
+        if (segment == glm::vec2(0.0f)) break;
+        newObjPos = resolveTileMove(layers, newObjPos, objSize, segment, state);
+    }
+    return newObjPos;
+}
+
+} // namespace engine::physics
@@ -0,0 +1,90 @@
+/**
+ * @file TileSweep.hpp
+ * @brief 物理体与瓦片层的碰撞解算（轴分离的角点检测 + 按瓦片分段的连续检测）
+ *
+ * 只依赖碰撞类型网格的只读视图，不依赖组件和渲染，PhysicsEngine 与单元测试共用。
+ */
+#pragma once
+#include "../component/TileType.hpp"
+
+#include <glm/vec2.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace engine::physics {
+
+/**
+ * @brief 瓦片层碰撞类型网格的只读视图
+ *
+ * 网格每格 1 字节，四周各多出一圈 EMPTY 边框，尺寸为 (mapSize.x + 2) * (mapSize.y + 2)。
+ */
+struct TileGridView {
+    const std::uint8_t* cells = nullptr;    ///< @brief 带边框的碰撞类型网格（非拥有）
+    int stride = 2;                         ///< @brief 每行的字节数 (mapSize.x + 2)
+    glm::ivec2 mapSize = {0, 0};            ///< @brief 地图尺寸（瓦片数）
+    glm::vec2 tileSize = {0.0f, 0.0f};      ///< @brief 单个瓦片尺寸（像素）
+
+    /**
+     * @brief 根据瓦片坐标获取碰撞类型
+     * @param pos 瓦片坐标，可以越界（越界时返回 TileType::EMPTY）
+     * @note 坐标被夹取到带边框的网格内，无需越界分支，每次查询只读取一个字节
+     */
+    engine::component::TileType getCollisionTypeAt(glm::ivec2 pos) const {
+        const int x = std::clamp(pos.x, -1, mapSize.x) + 1;
+        const int y = std::clamp(pos.y, -1, mapSize.y) + 1;
+        return static_cast<engine::component::TileType>(cells[static_cast<size_t>(y) * stride + x]);
+    }
+};
+
+/**
+ * @brief 瓦片碰撞解算中物理体的可变状态
+ */
+struct TileMoveState {
+    glm::vec2 velocity = {0.0f, 0.0f};  ///< @brief 速度（撞到瓦片的方向归零）
+    std::uint8_t contacts = 0;          ///< @brief 碰撞标志 (ContactFlags 的组合，只增加不清除)
+    bool useGravity = true;             ///< @brief 是否受重力（不受重力视为攀爬状态，可以穿过梯子顶层）
+};
+
+/**
+ * @brief 根据瓦片类型和指定宽度x坐标，计算瓦片上对应y坐标。
+ * @param width 从瓦片左侧起算的宽度。
+ * @param type 瓦片类型。
+ * @param tileSize 瓦片尺寸。
+ * @return 瓦片上对应高度（从瓦片下侧起算），不是斜坡时为 0。
+ */
+float getTileHeightAtWidth(float width, engine::component::TileType type, glm::vec2 tileSize);
+
+/**
+ * @brief 将包围盒移动一段位移，按轴分离检测角点所在的瓦片（实心、单向平台、梯子顶层、斜坡）。
+ *
+ * 先处理 X 方向（角点使用移动前的 y），再处理 Y 方向（角点使用 X 方向处理后的 x，避免斜向移动时嵌入拐角）。
+ * @param layers 碰撞瓦片层
+ * @param objPos 移动前包围盒的位置
+ * @param objSize 包围盒尺寸
+ * @param ds 位移（每个方向不超过一个瓦片时，前沿经过的每一行/列都会被检查到）
+ * @param state 物理体的速度与碰撞标志
+ * @return 处理碰撞后包围盒的位置
+ */
+glm::vec2 resolveTileMove(std::span<const TileGridView> layers, glm::vec2 objPos, glm::vec2 objSize, glm::vec2 ds,
+                          TileMoveState& state);
+
+/**
+ * @brief 连续检测需要的分段数：使每段位移在每个方向上都不超过任何图层的一个瓦片
+ * @return 分段数（至少为 1）
+ */
+int getTileSweepSteps(std::span<const TileGridView> layers, glm::vec2 ds);
+
+/**
+ * @brief 把一次位移切成 steps 段，逐段调用 resolveTileMove，在第一次碰撞处停下
+ *
+ * 碰撞后该方向速度归零，之后的小段不再沿该方向移动。steps 为 1 时即离散检测。
+ * @param steps 分段数，通常为 getTileSweepSteps 的结果
+ * @return 处理碰撞后包围盒的位置
+ */
+glm::vec2 sweepTileMove(std::span<const TileGridView> layers, glm::vec2 objPos, glm::vec2 objSize, glm::vec2 ds,
+                        int steps, TileMoveState& state);
+
+} // namespace engine::physics
@@ -1,4 +1,5 @@
 #pragma once
+#include "../utils/MemoryArena.hpp"
 #include <SDL3/SDL_rect.h>
 #include <vector>
 #include <string>
@@ -21,7 +22,7 @@ struct AnimationFrame {
  *
  * 存储动画的帧、总时长、名称和循环行为。
  */
-class Animation final {
+class Animation final : public engine::utils::ArenaAllocated {
 private:
     std::string m_name;                      ///< @brief 动画的名称 (例如, "walk", "idle")。
     std::vector<AnimationFrame> m_frames;    ///< @brief 动画帧列表
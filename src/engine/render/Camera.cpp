@@ -5,7 +5,7 @@
 namespace engine::render {
 
 Camera::Camera(const glm::vec2 &viewportSize, const glm::vec2 &position, const std::optional<engine::utils::Rect> &limitBounds)
-    : m_viewportSize(viewportSize), m_position(position), m_limitBounds(limitBounds) {
+    : m_viewportSize(viewportSize), m_position(position), m_limitBounds(limitBounds), m_prevPosition(position), m_renderPosition(position) {
     spdlog::trace("CAMERA::Camera初始化成功, 位置: {}, {}", m_position.x, m_position.y);
 }
 
@@ -36,11 +36,25 @@ void Camera::move(const glm::vec2 &offset) {
     clampPosition();
 }
 
+void Camera::storePreviousPosition(std::uint64_t tick) {
+    m_prevPosition = m_position;
+    m_prevTick = tick;
+}
+
+void Camera::setInterpolation(float alpha, std::uint64_t tick) {
+    if (m_prevTick != tick) {
+        m_renderPosition = m_position;
+        return;
+    }
+    m_renderPosition = glm::mix(m_prevPosition, m_position, alpha);
+    m_renderPosition = glm::vec2(glm::round(m_renderPosition.x), glm::round(m_renderPosition.y));  // 与 update 相同，取整避免画面割裂
+}
+
 
 /// @name 转换方法
 /// @{
 glm::vec2 Camera::worldToScreen(const glm::vec2 &worldPos) const {
-    return worldPos - m_position;
+    return worldPos - m_renderPosition;
 }
 
 glm::vec2 Camera::worldToScreenWithParallax(const glm::vec2 &worldPos, const glm::vec2 &scrollFactor) const {
@@ -48,7 +62,7 @@ glm::vec2 Camera::worldToScreenWithParallax(const glm::vec2 &worldPos, const glm
 }
 
 glm::vec2 Camera::screenToWorld(const glm::vec2 &screenPos) const {
-    return screenPos + m_position;
+    return screenPos + m_renderPosition;
 }
 /// @}
 
@@ -58,6 +72,9 @@ glm::vec2 Camera::screenToWorld(const glm::vec2 &screenPos) const {
 void Camera::setPosition(const glm::vec2 &position) {
     m_position = position;
     clampPosition();
+    // 直接设置位置视为瞬移，不做插值
+    m_prevPosition = m_position;
+    m_renderPosition = m_position;
 }
 
 void Camera::setLimitBounds(std::optional<engine::utils::Rect> limitBounds) {
@@ -6,6 +6,7 @@
 #pragma once
 #include "../utils/Math.hpp"
 #include <optional>
+#include <cstdint>
 
 namespace engine::component {
     class TransformComponent;
@@ -30,6 +31,10 @@ private:
     float m_smoothSpeed = 3.0f;                               ///< @brief 相机移动的平滑速度
     component::TransformComponent* m_target = nullptr;   ///< @brief 跟随目标变换组件，空值表示不跟随
 
+    glm::vec2 m_prevPosition;           ///< @brief 上一次逻辑更新开始时的相机位置
+    glm::vec2 m_renderPosition;         ///< @brief 用于渲染（坐标转换）的插值位置
+    std::uint64_t m_prevTick = 0;       ///< @brief m_prevPosition 记录于哪一次逻辑更新
+
 public:
     /**
      * @brief 构造函数
@@ -51,11 +56,26 @@ public:
      */
     void move(const glm::vec2& offset);
 
+    /// @name 渲染插值
+    /// @{
+    /**
+     * @brief 记录逻辑更新开始前的相机位置（由 Scene 在每次逻辑更新开始时调用）
+     * @param tick 本次逻辑更新的序号
+     */
+    void storePreviousPosition(std::uint64_t tick);
+    /**
+     * @brief 设置渲染插值参数，在每帧渲染前调用
+     * @param alpha 插值系数，0 为上一次逻辑更新前的位置，1 为当前位置
+     * @param tick 最近一次逻辑更新的序号。如果相机没有参与该次更新，直接使用当前位置
+     */
+    void setInterpolation(float alpha, std::uint64_t tick);
+    /// @}
+
 
     /// @name 转换方法
     /// @{
     /**
-     * @brief 将世界坐标转换为屏幕坐标
+     * @brief 将世界坐标转换为屏幕坐标（使用插值后的渲染位置）
      * @param worldPos 世界坐标位置
      * @return 转换后的屏幕坐标
      */
@@ -1,10 +1,13 @@
 #include "Renderer.hpp"
 #include "Camera.hpp"
 #include "../resource/ResourceManager.hpp"
+#include "../utils/Profiler.hpp"
 
 #include <SDL3/SDL.h>
 #include <spdlog/spdlog.h>
 
+#include <algorithm>
+#include <cmath>
 #include <stdexcept>
 
 namespace engine::render {
@@ -26,7 +29,7 @@ Renderer::Renderer(SDL_Renderer *renderer, resource::ResourceManager *resourceMa
 /// @name 绘制部分
 /// @{
 void Renderer::drawSprite(const Camera &camera, const Sprite &sprite, const glm::vec2 &position, const glm::vec2 &scale, double angle) {
-    auto texture = m_resourceManager->getTexture(sprite.getTextureID());
+    auto texture = resolveTexture(sprite);
     if (!texture) {
         spdlog::error("RENDERER::drawSprite::ERROR::获取纹理失败: 纹理ID为{}", sprite.getTextureID());
         return;
@@ -47,13 +50,14 @@ void Renderer::drawSprite(const Camera &camera, const Sprite &sprite, const glm:
     // 视口裁剪
     if (!isRectInViewport(camera, destRect)) return;
 
-    if (!SDL_RenderTextureRotated(m_renderer, texture, &srcRect.value(), &destRect, angle, NULL, sprite.isFlipped() ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE)) {
-        spdlog::error("RENDERER::drawSprite::ERROR::渲染精灵失败: 纹理ID为{} : {}", sprite.getTextureID(), SDL_GetError());
-    }
+    // 加入批处理队列，在 flush() 时统一绘制
+    m_spriteQueue.push_back({m_sortLayer, texture, m_sequence++, srcRect.value(), destRect,
+                             static_cast<float>(angle), sprite.isFlipped()});
 }
 
 void Renderer::drawParallax(const Camera &camera, const Sprite &sprite, const glm::vec2 &position, const glm::vec2 &scrollFactor, const glm::bvec2 &repeat, const glm::vec2 &scale) {
-    auto texture = m_resourceManager->getTexture(sprite.getTextureID());
+    flush();
+    auto texture = resolveTexture(sprite);
     if (!texture) {
         spdlog::error("RENDERER::drawParallax::ERROR::获取纹理失败: 纹理ID为{}", sprite.getTextureID());
         return;
@@ -90,7 +94,8 @@ void Renderer::drawParallax(const Camera &camera, const Sprite &sprite, const gl
     for (float y = start.y; y < stop.y; y += scaledTextureHeight) {
         for (float x = start.x; x < stop.x; x += scaledTextureWidth) {
             SDL_FRect dstRect = {x, y, scaledTextureWidth, scaledTextureHeight};
-            if (!SDL_RenderTexture(m_renderer, texture, nullptr, &dstRect)) {
+            recordDrawCall(texture);
+            if (!SDL_RenderTexture(m_renderer, texture, &srcRect.value(), &dstRect)) {
                 spdlog::error("RENDERER::drawParallax::ERROR::渲染精灵失败: 纹理ID为{} : {}", sprite.getTextureID(), SDL_GetError());
                 return;
             }
@@ -99,7 +104,8 @@ void Renderer::drawParallax(const Camera &camera, const Sprite &sprite, const gl
 }
 
 void Renderer::drawUISprite(const Sprite &sprite, const glm::vec2 &position, const std::optional<glm::vec2> &size) {
-    auto texture = m_resourceManager->getTexture(sprite.getTextureID());
+    flush();
+    auto texture = resolveTexture(sprite);
     if (!texture) {
         spdlog::error("RENDERER::drawUISprite::ERROR::获取纹理失败: 纹理ID为{}", sprite.getTextureID());
         return;
@@ -119,24 +125,166 @@ void Renderer::drawUISprite(const Sprite &sprite, const glm::vec2 &position, con
         destRect.h = srcRect.value().h;
     }
 
+    recordDrawCall(texture);
     if (!SDL_RenderTextureRotated(m_renderer, texture, &srcRect.value(), &destRect, 0.0, NULL, sprite.isFlipped() ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE)) {
         spdlog::error("RENDERER::drawUISprite::ERROR::渲染 UI Sprite 失败: 纹理ID为{} : {}", sprite.getTextureID(), SDL_GetError());
     }
 }
 void Renderer::drawUIFilledRect(const engine::utils::Rect &rect, const engine::utils::FColor &color) {
+    flush();
     setDrawColorFloat(color.r, color.g, color.b, color.a);
     SDL_FRect SDLRect = {rect.position.x, rect.position.y, rect.size.x, rect.size.y};
+    recordDrawCall(nullptr);
     if (!SDL_RenderFillRect(m_renderer, &SDLRect)) {
         spdlog::error("RENDERER::drawUIFilledRect::ERROR::绘制填充矩形失败：{}", SDL_GetError());
     }
     setDrawColor(0, 0, 0, 1.0f);
 }
+
+void Renderer::drawTexture(const Camera &camera, SDL_Texture *texture, const glm::vec2 &position, const glm::vec2 &size) {
+    if (!texture) return;
+    glm::vec2 positionScreen = camera.worldToScreen(position);
+    SDL_FRect destRect = {positionScreen.x, positionScreen.y, size.x, size.y};
+    // 视口裁剪
+    if (!isRectInViewport(camera, destRect)) return;
+    flush();
+    recordDrawCall(texture);
+    if (!SDL_RenderTexture(m_renderer, texture, nullptr, &destRect)) {
+        spdlog::error("RENDERER::drawTexture::ERROR::渲染纹理失败: {}", SDL_GetError());
+    }
+}
+
+void Renderer::flush() {
+    if (m_spriteQueue.empty()) return;
+    SL_PROFILE_ZONE("Renderer::flush");
+
+    // 1. 按 (排序层, 提交序号) 排序：同一层内严格保持提交顺序（Tiled 中的对象顺序），重叠的精灵不会因纹理地址而改变前后关系
+    std::sort(m_spriteQueue.begin(), m_spriteQueue.end(), [](const SpriteDrawCommand& a, const SpriteDrawCommand& b) {
+        if (a.layer != b.layer) return a.layer < b.layer;
+        return a.sequence < b.sequence;
+    });
+
+    // 2. 提交顺序中相邻的同一纹理精灵合并为一次 SDL_RenderGeometry（使用图集时大部分精灵共用纹理）
+    const SDL_FColor white = {1.0f, 1.0f, 1.0f, 1.0f};
+    for (size_t runBegin = 0; runBegin < m_spriteQueue.size();) {
+        SDL_Texture* texture = m_spriteQueue[runBegin].texture;
+        size_t runEnd = runBegin + 1;
+        while (runEnd < m_spriteQueue.size() && m_spriteQueue[runEnd].texture == texture) {
+            ++runEnd;
+        }
+
+        float textureWidth = 0.0f, textureHeight = 0.0f;
+        if (!SDL_GetTextureSize(texture, &textureWidth, &textureHeight) || textureWidth <= 0.0f || textureHeight <= 0.0f) {
+            spdlog::error("RENDERER::flush::ERROR::获取纹理尺寸失败: {}", SDL_GetError());
+            runBegin = runEnd;
+            continue;
+        }
+
+        m_batchVertices.clear();
+        m_batchIndices.clear();
+        for (size_t i = runBegin; i < runEnd; ++i) {
+            const auto& cmd = m_spriteQueue[i];
+            // 纹理坐标（水平翻转时交换左右）
+            float u0 = cmd.srcRect.x / textureWidth;
+            float u1 = (cmd.srcRect.x + cmd.srcRect.w) / textureWidth;
+            const float v0 = cmd.srcRect.y / textureHeight;
+            const float v1 = (cmd.srcRect.y + cmd.srcRect.h) / textureHeight;
+            if (cmd.isFlipped) std::swap(u0, u1);
+
+            // 以目标矩形中心为原点的四个角（左上、右上、右下、左下），旋转方向与 SDL_RenderTextureRotated 一致
+            const float halfW = cmd.destRect.w * 0.5f;
+            const float halfH = cmd.destRect.h * 0.5f;
+            const float centerX = cmd.destRect.x + halfW;
+            const float centerY = cmd.destRect.y + halfH;
+            float cosA = 1.0f, sinA = 0.0f;
+            if (cmd.angle != 0.0f) {
+                const float radians = cmd.angle * (SDL_PI_F / 180.0f);
+                cosA = std::cos(radians);
+                sinA = std::sin(radians);
+            }
+            const float cornersX[4] = {-halfW, halfW, halfW, -halfW};
+            const float cornersY[4] = {-halfH, -halfH, halfH, halfH};
+            const float cornersU[4] = {u0, u1, u1, u0};
+            const float cornersV[4] = {v0, v0, v1, v1};
+
+            const int base = static_cast<int>(m_batchVertices.size());
+            for (int c = 0; c < 4; ++c) {
+                SDL_Vertex vertex;
+                vertex.position.x = centerX + cornersX[c] * cosA - cornersY[c] * sinA;
+                vertex.position.y = centerY + cornersX[c] * sinA + cornersY[c] * cosA;
+                vertex.color = white;
+                vertex.tex_coord.x = cornersU[c];
+                vertex.tex_coord.y = cornersV[c];
+                m_batchVertices.push_back(vertex);
+            }
+            for (int index : {0, 1, 2, 0, 2, 3}) {
+                m_batchIndices.push_back(base + index);
+            }
+        }
+
+        recordDrawCall(texture);
+        m_frameStats.batchedSprites += static_cast<int>(runEnd - runBegin);
+        if (!SDL_RenderGeometry(m_renderer, texture, m_batchVertices.data(), static_cast<int>(m_batchVertices.size()),
+                                m_batchIndices.data(), static_cast<int>(m_batchIndices.size()))) {
+            spdlog::error("RENDERER::flush::ERROR::批量渲染精灵失败: {}", SDL_GetError());
+        }
+        runBegin = runEnd;
+    }
+
+    m_spriteQueue.clear();
+    m_sequence = 0;
+}
+/// @}
+
+/// @name 渲染目标（离屏渲染）
+/// @{
+SDL_Texture *Renderer::createRenderTarget(int width, int height) {
+    SDL_Texture* texture = SDL_CreateTexture(m_renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
+    if (!texture) {
+        spdlog::error("RENDERER::createRenderTarget::ERROR::创建渲染目标纹理失败 ({}x{}): {}", width, height, SDL_GetError());
+        return nullptr;
+    }
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_NEAREST);
+    return texture;
+}
+
+void Renderer::destroyRenderTarget(SDL_Texture *texture) {
+    if (texture) SDL_DestroyTexture(texture);
+}
+
+bool Renderer::beginRenderToTexture(SDL_Texture *target, bool clear) {
+    flush();    // 队列中的精灵属于当前渲染目标
+    if (!SDL_SetRenderTarget(m_renderer, target)) {
+        spdlog::error("RENDERER::beginRenderToTexture::ERROR::切换渲染目标失败: {}", SDL_GetError());
+        return false;
+    }
+    if (clear) {
+        setDrawColor(0, 0, 0, 0);
+        SDL_RenderClear(m_renderer);
+        setDrawColor(0, 0, 0, 255);
+    }
+    return true;
+}
+
+void Renderer::endRenderToTexture() {
+    flush();
+    if (!SDL_SetRenderTarget(m_renderer, nullptr)) {
+        spdlog::error("RENDERER::endRenderToTexture::ERROR::恢复渲染目标失败: {}", SDL_GetError());
+    }
+}
 /// @}
 
 /// @name 渲染部分
 /// @{
 void Renderer::present() {
+    SL_PROFILE_ZONE("Renderer::present");
+    flush();
     SDL_RenderPresent(m_renderer);
+    // 一帧结束，保存并重置统计数据
+    m_lastFrameStats = m_frameStats;
+    m_frameStats = {};
+    m_lastTexture = nullptr;
 }
 
 void Renderer::clearScreen() {
@@ -165,27 +313,36 @@ SDL_Renderer *Renderer::getSDLRenderer() const {
 }
 /// @}
 
-std::optional<SDL_FRect> Renderer::getSpriteSrcRect(const Sprite &sprite) {
-    SDL_Texture *texture = m_resourceManager->getTexture(sprite.getTextureID());
-    if (!texture) {
-        spdlog::error("RENDERER::getSpriteSrcRect::ERROR::获取纹理失败: 纹理ID为{}", sprite.getTextureID());
-        return std::nullopt;
+SDL_Texture *Renderer::resolveTexture(const Sprite &sprite) {
+    // 快速路径：缓存的句柄仍然有效，直接下标访问
+    if (SDL_Texture* texture = m_resourceManager->getTexture(sprite.getTextureHandle())) {
+        return texture;
     }
+    // 首次绘制（或纹理被重新加载）时按纹理ID查找一次，并缓存句柄
+    auto handle = m_resourceManager->getTextureHandle(sprite.getTextureID());
+    sprite.setTextureHandle(handle);
+    return m_resourceManager->getTexture(handle);
+}
 
+std::optional<SDL_FRect> Renderer::getSpriteSrcRect(const Sprite &sprite) {
+    // 图片在纹理中的区域：单独的纹理为整张纹理，图集中的图片为其在图集页中的子区域
+    const SDL_FRect& region = m_resourceManager->getTextureRegion(sprite.getTextureHandle());
     auto srcRect = sprite.getSourceRect();
     if (srcRect.has_value()) {
         if (srcRect.value().w <= 0 || srcRect.value().h <= 0) {
             spdlog::error("RENDERER::getSpriteSrcRect::ERROR::精灵原矩形错误: 纹理ID为{}", sprite.getTextureID());
             return std::nullopt;
         }
+        // 精灵的源矩形相对于原始图片，平移到图集页坐标
+        srcRect->x += region.x;
+        srcRect->y += region.y;
         return srcRect;
     } else {
-        SDL_FRect result = {0, 0, 0, 0};
-        if(!SDL_GetTextureSize(texture, &result.w, &result.h)) {
+        if (region.w <= 0 || region.h <= 0) {
             spdlog::error("RENDERER::getSpriteSrcRect::ERROR::获取精灵原矩形失败: 纹理ID为{}", sprite.getTextureID());
             return std::nullopt;
         }
-        return result;
+        return region;
     }
 }
 
@@ -195,4 +352,12 @@ bool Renderer::isRectInViewport(const Camera &camera, const SDL_FRect &rect) {
            rect.y + rect.h >= 0 && rect.y <= viewportSize.y;
 }
 
+void Renderer::recordDrawCall(SDL_Texture *texture) {
+    ++m_frameStats.drawCalls;
+    if (texture != m_lastTexture) {
+        ++m_frameStats.textureSwitches;
+        m_lastTexture = texture;
+    }
+}
+
 } // namespace engine::render
\ No newline at end of file
@@ -2,12 +2,16 @@
 #include "Sprite.hpp"
 #include "../utils/Math.hpp"
 
+#include <SDL3/SDL_render.h>
 #include <glm/glm.hpp>
 
+#include <cstdint>
 #include <optional>
 #include <string>
+#include <vector>
 
 struct SDL_Renderer;
+struct SDL_Texture;
 struct SDL_FRect;
 
 namespace engine::resource {
@@ -18,18 +22,55 @@ namespace engine::render {
 class Sprite;
 class Camera;
 
+/**
+ * @brief 每帧的渲染统计数据
+ */
+struct RenderStats {
+    int drawCalls = 0;          ///< @brief 提交给 SDL 的绘制调用次数（一次批处理计为一次）
+    int textureSwitches = 0;    ///< @brief 相邻两次绘制调用使用不同纹理的次数
+    int batchedSprites = 0;     ///< @brief 经由批处理队列绘制的精灵数量
+};
+
 /**
  * @class Renderer
  * @brief 渲染器类，负责处理所有与渲染相关的操作
  * 
  * 这个类封装了SDL渲染器的功能，提供了精灵绘制、视差滚动、UI元素渲染等功能。
  * 它与游戏资源管理器和相机系统紧密集成，以实现高效的渲染流程。
+ *
+ * 世界空间的精灵 (drawSprite) 不会立即绘制，而是带着 (排序层, 提交序号) 进入队列，
+ * 在 flush() 时按此顺序排序（同一层内保持提交顺序），并把相邻的同一纹理精灵合并为一次 SDL_RenderGeometry 调用
+ * （翻转与旋转直接写入顶点）。其它立即绘制的接口以及切换渲染目标、呈现画面前都会先 flush()，
+ * 因此不同绘制接口之间的先后顺序保持不变。
  */
 class Renderer final {
 private:
+    /// @brief 排队等待批处理的精灵绘制命令
+    struct SpriteDrawCommand {
+        int layer;                  ///< @brief 排序层
+        SDL_Texture* texture;       ///< @brief 纹理
+        std::uint32_t sequence;     ///< @brief 提交序号（同层时保持提交顺序）
+        SDL_FRect srcRect;          ///< @brief 源矩形（像素）
+        SDL_FRect destRect;         ///< @brief 目标矩形（屏幕坐标）
+        float angle;                ///< @brief 绕目标矩形中心的旋转角度（度，顺时针）
+        bool isFlipped;             ///< @brief 是否水平翻转
+    };
+
     SDL_Renderer* m_renderer = nullptr;           ///< SDL渲染器指针
     resource::ResourceManager* m_resourceManager = nullptr; ///< 资源管理器指针
 
+    /// @name 精灵批处理
+    /// @{
+    std::vector<SpriteDrawCommand> m_spriteQueue;   ///< @brief 等待 flush 的精灵
+    std::vector<SDL_Vertex> m_batchVertices;        ///< @brief 顶点缓冲（帧间复用）
+    std::vector<int> m_batchIndices;                ///< @brief 索引缓冲（帧间复用）
+    int m_sortLayer = 0;                            ///< @brief 当前排序层，之后提交的精灵都使用该层
+    std::uint32_t m_sequence = 0;                   ///< @brief 下一个提交序号
+    SDL_Texture* m_lastTexture = nullptr;           ///< @brief 上一次绘制调用使用的纹理，用于统计纹理切换
+    RenderStats m_frameStats;                       ///< @brief 当前帧的统计数据
+    RenderStats m_lastFrameStats;                   ///< @brief 上一个完整帧的统计数据
+    /// @}
+
 public:
     /**
      * @brief 构造函数
@@ -51,7 +92,7 @@ public:
      * @param scale    精灵的缩放比例，默认为(1.0f, 1.0f)
      * @param angle    精灵的旋转角度（度），默认为0.0
      * 
-     * 此方法会将精灵根据相机位置进行视口变换后绘制到屏幕上
+     * 此方法会将精灵根据相机位置进行视口变换后加入批处理队列，在下一次 flush() 时绘制到屏幕上
      */
     void drawSprite(const Camera& camera, const Sprite& sprite, const glm::vec2& position,
         const glm::vec2& scale = glm::vec2(1.0f), double angle = 0.0);
@@ -87,6 +128,46 @@ public:
      * @param color 填充颜色
      */
     void drawUIFilledRect(const engine::utils::Rect& rect, const engine::utils::FColor& color);
+
+    /**
+     * @brief 在游戏世界中绘制整张纹理（例如预烘焙的瓦片区块）
+     * @param camera   相机对象，用于计算视口变换
+     * @param texture  要绘制的纹理
+     * @param position 纹理左上角在游戏世界中的位置
+     * @param size     纹理在游戏世界中的尺寸
+     */
+    void drawTexture(const Camera& camera, SDL_Texture* texture, const glm::vec2& position, const glm::vec2& size);
+
+    /**
+     * @brief 绘制批处理队列中的所有精灵并清空队列
+     *
+     * 队列按 (排序层, 提交序号) 排序，提交顺序中相邻的同一纹理精灵合并为一次绘制调用。
+     * 立即绘制的接口会自动调用本方法，通常只在直接使用 SDL 绘制（如 TextRenderer）之前需要手动调用。
+     */
+    void flush();
+    /// @}
+
+
+    /// @name 渲染目标（离屏渲染）
+    /// @{
+    /**
+     * @brief 创建可作为渲染目标的透明纹理（像素风格，使用最近邻采样）
+     * @param width 宽度（像素）
+     * @param height 高度（像素）
+     * @return SDL_Texture* 创建的纹理，失败返回 nullptr。使用完毕后需调用 destroyRenderTarget 释放
+     */
+    SDL_Texture* createRenderTarget(int width, int height);
+    /// @brief 释放由 createRenderTarget 创建的纹理
+    void destroyRenderTarget(SDL_Texture* texture);
+    /**
+     * @brief 开始向纹理绘制，之后的 drawUISprite 等屏幕空间绘制都会画到该纹理上（坐标相对纹理左上角）
+     * @param target 渲染目标纹理（由 createRenderTarget 创建）
+     * @param clear 是否先清空为全透明
+     * @return 是否成功切换渲染目标
+     */
+    bool beginRenderToTexture(SDL_Texture* target, bool clear = true);
+    /// @brief 结束向纹理绘制，恢复为向窗口绘制
+    void endRenderToTexture();
     /// @}
 
 
@@ -137,6 +218,10 @@ public:
      * 返回与此渲染器关联的SDL渲染器指针，可用于需要直接操作SDL渲染器的特殊情况
      */
     SDL_Renderer* getSDLRenderer() const;
+
+    void setSortLayer(int layer) { m_sortLayer = layer; }       ///< @brief 设置之后提交的精灵所属的排序层（数值小的先绘制）
+    int getSortLayer() const { return m_sortLayer; }            ///< @brief 获取当前排序层
+    const RenderStats& getFrameStats() const { return m_lastFrameStats; }   ///< @brief 获取上一个完整帧的渲染统计
     /// @}
 
     
@@ -150,11 +235,18 @@ public:
     
 private:
     /**
-     * @brief 获取精灵的源矩形
+     * @brief 获取精灵的纹理（优先使用精灵缓存的纹理句柄，失效时按纹理ID重新解析并缓存）
      * @param sprite 精灵对象
+     * @return SDL_Texture* 纹理指针，失败返回 nullptr
+     */
+    SDL_Texture* resolveTexture(const Sprite& sprite);
+
+    /**
+     * @brief 获取精灵的源矩形
+     * @param sprite 精灵对象（需已通过 resolveTexture 解析纹理句柄）
      * @return std::optional<SDL_FRect> 精灵的源矩形，如果没有有效矩形则返回空
      * 
-     * 根据精灵的当前帧和动画状态，返回相应的源矩形区域
+     * 根据精灵的当前帧和动画状态，返回相应的源矩形区域（纹理坐标，已包含图集偏移）
      */
     std::optional<SDL_FRect> getSpriteSrcRect(const Sprite& sprite);
     
@@ -167,6 +259,9 @@ private:
      * 用于优化渲染，只绘制可见区域的精灵
      */
     bool isRectInViewport(const Camera& camera, const SDL_FRect& rect);
+
+    /// @brief 记录一次绘制调用（统计绘制次数与纹理切换次数）
+    void recordDrawCall(SDL_Texture* texture);
 };
 
 } // namespace engine::render
\ No newline at end of file
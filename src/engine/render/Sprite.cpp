@@ -28,7 +28,9 @@ void Sprite::setSourceRect(const std::optional<SDL_FRect>& sourceRect) {
 }
 
 void Sprite::setTextureID(const std::string_view textureID) {
+    if (m_textureID == textureID) return;
     m_textureID = textureID;
+    m_textureHandle = {};   // 纹理改变，句柄需要重新解析
 }
 /// @}
 
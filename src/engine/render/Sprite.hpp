@@ -4,6 +4,8 @@
  */
 
 #pragma once
+#include "../resource/TextureHandle.hpp"
+
 #include <SDL3/SDL_rect.h>
 
 #include <optional>
@@ -24,6 +26,8 @@ private:
     std::string m_textureID = "";         ///< 纹理ID标识符
     std::optional<SDL_FRect> m_sourceRect; ///< 源矩形区域，可选
     bool m_isFlipped = false;             ///< 是否水平翻转
+    /// 缓存的纹理句柄（由渲染器在首次绘制时解析，纹理ID改变时失效；不影响精灵的逻辑状态，因此为 mutable）
+    mutable engine::resource::TextureHandle m_textureHandle;
 
 public:
     /**
@@ -60,6 +64,18 @@ public:
      */
     bool isFlipped() const;
 
+    /**
+     * @brief 获取缓存的纹理句柄
+     * @return engine::resource::TextureHandle 纹理句柄，尚未解析时为无效句柄
+     */
+    engine::resource::TextureHandle getTextureHandle() const { return m_textureHandle; }
+
+    /**
+     * @brief 缓存解析好的纹理句柄（供渲染器使用）
+     * @param handle 纹理句柄
+     */
+    void setTextureHandle(engine::resource::TextureHandle handle) const { m_textureHandle = handle; }
+
     /**
      * @brief 设置纹理ID
      * @param textureID 新的纹理ID
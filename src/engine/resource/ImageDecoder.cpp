@@ -0,0 +1,52 @@
+#include "ImageDecoder.hpp"
+
+#include <SDL3/SDL_surface.h>
+#include <SDL3_image/SDL_image.h>
+#include <spdlog/spdlog.h>
+
+namespace engine::resource {
+
+void ImageDecoder::SurfaceDeleter::operator()(SDL_Surface* surface) const {
+    SDL_DestroySurface(surface);
+}
+
+ImageDecoder::ImageDecoder(engine::core::JobSystem& jobSystem) : m_jobSystem(jobSystem) {}
+
+ImageDecoder::~ImageDecoder() {
+    m_isStopping = true;
+    m_jobSystem.wait(m_counter);
+}
+
+void ImageDecoder::request(std::string path) {
+    {
+        std::lock_guard lock(m_mutex);
+        ++m_inFlight;
+    }
+    m_jobSystem.schedule([this, path = std::move(path)]() mutable { decode(std::move(path)); }, &m_counter);
+}
+
+bool ImageDecoder::poll(Result& result) {
+    std::lock_guard lock(m_mutex);
+    if (m_results.empty()) return false;
+    result = std::move(m_results.front());
+    m_results.pop_front();
+    --m_inFlight;
+    return true;
+}
+
+size_t ImageDecoder::getInFlightCount() const {
+    std::lock_guard lock(m_mutex);
+    return m_inFlight;
+}
+
+void ImageDecoder::decode(std::string path) {
+    if (m_isStopping) return;
+    SurfacePtr surface(IMG_Load(path.c_str()));
+    if (!surface) {
+        spdlog::error("RESOURCEMANAGER::IMAGEDECODER::解码图片失败: {} : {}", path, SDL_GetError());
+    }
+    std::lock_guard lock(m_mutex);
+    m_results.push_back({std::move(path), std::move(surface)});
+}
+
+} // namespace engine::resource
@@ -0,0 +1,66 @@
+#pragma once
+#include "../core/JobSystem.hpp"
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+
+struct SDL_Surface;
+
+namespace engine::resource {
+
+/**
+ * @class ImageDecoder
+ * @brief 后台图片解码器，解码任务提交到任务系统 (JobSystem) 的工作线程
+ * @note 工作线程只调用 IMG_Load 把图片解码为 SDL_Surface（不涉及渲染器），
+ *       解码结果由主线程通过 poll 取出后再上传为纹理
+ */
+class ImageDecoder final {
+public:
+    /// @brief SDL_Surface 删除器
+    struct SurfaceDeleter {
+        void operator()(SDL_Surface* surface) const;
+    };
+    using SurfacePtr = std::unique_ptr<SDL_Surface, SurfaceDeleter>;
+
+    /// @brief 解码结果
+    struct Result {
+        std::string path;       ///< @brief 图片路径
+        SurfacePtr surface;     ///< @brief 解码得到的图片，失败时为空
+    };
+
+private:
+    engine::core::JobSystem& m_jobSystem;       ///< @brief 执行解码任务的任务系统
+    engine::core::JobCounter m_counter;         ///< @brief 尚未执行完的解码任务
+    mutable std::mutex m_mutex;                 ///< @brief 保护以下数据
+    std::deque<Result> m_results;               ///< @brief 解码完成、等待主线程取出的结果
+    size_t m_inFlight = 0;                      ///< @brief 已提交但尚未被取出的请求数
+    std::atomic<bool> m_isStopping = false;     ///< @brief 是否正在退出（尚未开始的解码任务直接跳过）
+
+public:
+    /**
+     * @brief 构造函数
+     * @param jobSystem 执行解码任务的任务系统
+     */
+    explicit ImageDecoder(engine::core::JobSystem& jobSystem);
+    ~ImageDecoder();    ///< @brief 跳过尚未开始的解码，等待正在进行的解码完成
+
+    /// @name 禁止拷贝和移动
+    /// @{
+    ImageDecoder(const ImageDecoder&) = delete;
+    ImageDecoder& operator=(const ImageDecoder&) = delete;
+    ImageDecoder(ImageDecoder&&) = delete;
+    ImageDecoder& operator=(ImageDecoder&&) = delete;
+    /// @}
+
+    void request(std::string path);     ///< @brief 提交解码请求（立即返回）
+    bool poll(Result& result);          ///< @brief 取出一个解码结果（不阻塞），没有结果时返回 false
+    size_t getInFlightCount() const;    ///< @brief 已提交但尚未被取出的请求数
+
+private:
+    void decode(std::string path);      ///< @brief 解码任务（在工作线程执行）
+};
+
+} // namespace engine::resource
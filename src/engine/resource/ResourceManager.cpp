@@ -5,9 +5,9 @@
 #include <spdlog/spdlog.h>
 
 namespace engine::resource {
-ResourceManager::ResourceManager(SDL_Renderer *renderer) {
+ResourceManager::ResourceManager(SDL_Renderer *renderer, engine::core::JobSystem& jobSystem) {
     spdlog::trace("RESOURCESMANAGER::初始化中...");
-    m_textureManager = std::make_unique<TextureManager>(renderer);
+    m_textureManager = std::make_unique<TextureManager>(renderer, jobSystem);
     m_fontManager = std::make_unique<FontManager>();
 
     spdlog::trace("RESOURCESMANAGER::初始化成功");
@@ -22,13 +22,24 @@ void ResourceManager::clear() {
     spdlog::trace("RESOURCESMANAGER::资源清理成功");
 }
 
+void ResourceManager::update() {
+    m_textureManager->processDecodedTextures();
+}
+
 /// @name --- Texture ---
 /// @{
 SDL_Texture* ResourceManager::loadTexture(const std::string_view path) { return m_textureManager->loadTexture(path); }
 SDL_Texture* ResourceManager::getTexture(const std::string_view path) { return m_textureManager->getTexture(path); }
+TextureHandle ResourceManager::getTextureHandle(const std::string_view path) { return m_textureManager->getTextureHandle(path); }
+SDL_Texture* ResourceManager::getTexture(TextureHandle handle) const { return m_textureManager->getTexture(handle); }
+const SDL_FRect& ResourceManager::getTextureRegion(TextureHandle handle) const { return m_textureManager->getTextureRegion(handle); }
 glm::vec2 ResourceManager::getTextureSize(const std::string_view path) { return m_textureManager->getTextureSize(path); }
 void ResourceManager::unloadTexture(const std::string_view path) { m_textureManager->unloadTexture(path); }
 void ResourceManager::clearTextures() { m_textureManager->clearTextures(); }
+bool ResourceManager::loadTextureAtlas(const std::string_view manifestPath) { return m_textureManager->loadAtlasManifest(manifestPath); }
+SDL_Texture* ResourceManager::loadTextureFromSurface(const std::string_view path, SDL_Surface* surface) { return m_textureManager->loadTextureFromSurface(path, surface); }
+TextureHandle ResourceManager::requestTexture(const std::string_view path) { return m_textureManager->requestTexture(path); }
+bool ResourceManager::hasPendingTextures() const { return m_textureManager->hasPendingTextures(); }
 /// @}
 
 /// @name --- Font ---
@@ -1,4 +1,6 @@
 #pragma once
+#include "TextureHandle.hpp"
+
 #include <memory>
 #include <string>
 #include <string_view>
@@ -8,10 +10,16 @@
 // SDL 前向声明
 struct SDL_Renderer;
 struct SDL_Texture;
+struct SDL_Surface;
+struct SDL_FRect;
 struct Mix_Chunk;
 struct Mix_Music;
 struct TTF_Font;
 
+namespace engine::core {
+class JobSystem;
+} // namespace engine::core
+
 namespace engine::resource {
 // 资源管理器 前向声明
 class TextureManager;
@@ -33,13 +41,15 @@ public:
     /**
      * @brief 资源管理器构造函数
      * @param renderer SDL 渲染器，传递给 TextureManager，不能为空
-     * @note 用了 explicit 关键字，禁止隐式转换
+     * @param jobSystem 任务系统，用于后台解码纹理
      */
-    explicit ResourceManager(SDL_Renderer *renderer);
+    ResourceManager(SDL_Renderer *renderer, engine::core::JobSystem& jobSystem);
     ~ResourceManager();
 
     /// @brief 清理所有资源
     void clear();
+    /// @brief 每帧调用一次：上传后台解码完成的纹理（数量有上限，避免单帧卡顿）
+    void update();
 
     /// @name 除移动拷贝构造函数
     /// @{
@@ -53,9 +63,16 @@ public:
     /// @{
     SDL_Texture* loadTexture(const std::string_view path);
     SDL_Texture* getTexture(const std::string_view path);
+    TextureHandle getTextureHandle(const std::string_view path);    ///< @brief 按路径获取纹理句柄（仅在加载/首次使用时调用）
+    SDL_Texture* getTexture(TextureHandle handle) const;            ///< @brief 按句柄获取纹理（绘制路径使用，无字符串查找）
+    const SDL_FRect& getTextureRegion(TextureHandle handle) const;  ///< @brief 按句柄获取图片在纹理中的区域（图集中的图片为子区域）
     glm::vec2 getTextureSize(const std::string_view path);
     void unloadTexture(const std::string_view path);
     void clearTextures();
+    bool loadTextureAtlas(const std::string_view manifestPath);     ///< @brief 加载纹理图集清单（由 AtlasPacker 生成）
+    SDL_Texture* loadTextureFromSurface(const std::string_view path, SDL_Surface* surface); ///< @brief 用已解码的图片创建纹理（解码可在后台线程完成）
+    TextureHandle requestTexture(const std::string_view path);      ///< @brief 请求在后台解码纹理，立即返回句柄（完成前为占位纹理）
+    bool hasPendingTextures() const;                                ///< @brief 是否还有纹理在后台解码
     /// @}
 
     
@@ -0,0 +1,24 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+
+namespace engine::resource {
+
+/**
+ * @struct TextureHandle
+ * @brief 纹理句柄：纹理在 TextureManager 槽位数组中的下标 + 槽位代数
+ *
+ * 通过句柄获取纹理只需一次数组下标访问，不再构造字符串和计算哈希。
+ * 纹理被卸载后槽位代数会递增，旧句柄随之失效（获取结果为 nullptr），不会误指向新纹理。
+ */
+struct TextureHandle {
+    static constexpr std::uint32_t INVALID_INDEX = std::numeric_limits<std::uint32_t>::max();
+
+    std::uint32_t index = INVALID_INDEX;    ///< @brief 槽位下标
+    std::uint32_t generation = 0;           ///< @brief 槽位代数
+
+    bool isValid() const { return index != INVALID_INDEX; }     ///< @brief 是否指向某个槽位（不保证纹理仍然存在）
+    bool operator==(const TextureHandle&) const = default;
+};
+
+} // namespace engine::resource
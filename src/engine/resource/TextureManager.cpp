@@ -1,9 +1,14 @@
 #include "TextureManager.hpp"
+#include "ImageDecoder.hpp"
 
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
 #include <stdexcept>
 
 #include <SDL3/SDL_render.h>
 #include <SDL3_image/SDL_image.h>
+#include <nlohmann/json.hpp>
 #include <spdlog/spdlog.h>
 
 namespace engine::resource {
@@ -12,15 +17,24 @@ void TextureManager::SDLTextureDeleter::operator()(SDL_Texture* texture) const {
     SDL_DestroyTexture(texture);
 }
 
-TextureManager::TextureManager(SDL_Renderer *renderer) : m_renderer(renderer) {
+TextureManager::TextureManager(SDL_Renderer *renderer, engine::core::JobSystem& jobSystem) : m_renderer(renderer) {
     if (!m_renderer) {
         throw std::runtime_error("RESOURCEMANAGER::TEXTUREMANAGER::SDL_Renderer未初始化, 请检查是否正确初始化SDL");
     }
-    // 初始化SDL_Image
+    // 占位纹理：1x1 的透明像素（新建的表面像素全为0）
+    if (SDL_Surface* surface = SDL_CreateSurface(1, 1, SDL_PIXELFORMAT_RGBA32)) {
+        m_placeholder.reset(SDL_CreateTextureFromSurface(m_renderer, surface));
+        SDL_DestroySurface(surface);
+    }
+    if (!m_placeholder) {
+        throw std::runtime_error("RESOURCEMANAGER::TEXTUREMANAGER::创建占位纹理失败");
+    }
+    m_decoder = std::make_unique<ImageDecoder>(jobSystem);
     spdlog::trace("RESOURCEMANAGER::TEXTUREMANAGER::TextureManager初始化成功");
 }
 
 TextureManager::~TextureManager() {
+    m_decoder.reset();      // 先等待进行中的解码任务结束
     spdlog::trace("RESOURCEMANAGER::TEXTUREMANAGER::TextureManager退出成功");
 }
 
@@ -31,49 +45,152 @@ SDL_Texture *TextureManager::loadTexture(const std::string_view path) {
     auto it = m_textures.find(std::string(path));
     if (it != m_textures.end()) {
         spdlog::warn("RESOURCEMANAGER::TEXTUREMANAGER::已存在同名纹理, 将使用原纹理");
-        return it->second.get();
+        return m_slots[it->second].texture;
     }
-    SDL_Texture *rawTexture = IMG_LoadTexture(m_renderer, std::string(path).c_str());
-    // 载入纹理时，设置纹理缩放模式为最邻近插值(必不可少，否则TileLayer渲染中会出现边缘空隙/模糊)
-    if (!SDL_SetTextureScaleMode(rawTexture, SDL_SCALEMODE_NEAREST)) {
-        spdlog::warn("RESOURCEMANAGER::TEXTUREMANAGER::无法设置纹理缩放模式为最邻近插值");
+    // 被打包进图集的图片直接使用图集页纹理
+    if (!m_atlasEntries.empty()) {
+        if (SDL_Texture* atlasTexture = loadFromAtlas(path)) return atlasTexture;
     }
+    SDL_Texture *rawTexture = loadTextureFile(std::string(path));
     if (!rawTexture) {
         spdlog::error("RESOURCEMANAGER::TEXTUREMANAGER::loadTexture::加载纹理失败: {} : {}", path, SDL_GetError());
         return nullptr;
     }
-    m_textures.emplace(path, std::unique_ptr<SDL_Texture, SDLTextureDeleter>(rawTexture));
+    addOwnedTexture(path, rawTexture);
     spdlog::debug("RESOURCEMANAGER::TEXTUREMANAGER::loadTexture::加载纹理成功: {}", path);
 
     return rawTexture;
 }
 
+SDL_Texture *TextureManager::loadTextureFromSurface(const std::string_view path, SDL_Surface* surface) {
+    auto it = m_textures.find(std::string(path));
+    if (it != m_textures.end()) {
+        auto& slot = m_slots[it->second];
+        if (slot.isPending && surface && slot.owned == nullptr && !m_atlasEntries.contains(normalizeAtlasKey(path))) {
+            // 后台解码尚未完成，直接使用这份解码结果
+            finishPendingSlot(it->second, createTextureFromSurface(surface), true);
+        }
+        return slot.texture;                    // 已加载（例如上一关卡已使用），预解码的图片直接丢弃
+    }
+    if (!m_atlasEntries.empty()) {
+        if (SDL_Texture* atlasTexture = loadFromAtlas(path)) return atlasTexture;
+    }
+    if (!surface) {
+        return loadTexture(path);
+    }
+    SDL_Texture *rawTexture = createTextureFromSurface(surface);
+    if (!rawTexture) {
+        spdlog::error("RESOURCEMANAGER::TEXTUREMANAGER::loadTextureFromSurface::创建纹理失败: {} : {}", path, SDL_GetError());
+        return nullptr;
+    }
+    addOwnedTexture(path, rawTexture);
+    spdlog::debug("RESOURCEMANAGER::TEXTUREMANAGER::loadTextureFromSurface::上传纹理成功: {}", path);
+    return rawTexture;
+}
+
 SDL_Texture *TextureManager::getTexture(const std::string_view path) {
     auto it = m_textures.find(std::string(path));
     if (it != m_textures.end()) {
-        return it->second.get();
+        return m_slots[it->second].texture;
+    }
+    spdlog::warn("RESOURCEMANAGER::TEXTUREMANAGER::getTexture::未找到纹理, 尝试加载: {}", path);
+    return getTexture(requestTexture(path));
+}
+
+TextureHandle TextureManager::getTextureHandle(const std::string_view path) {
+    return requestTexture(path);    // 已加载时直接返回，否则在后台解码（绘制途中不会因解码而阻塞）
+}
+
+TextureHandle TextureManager::requestTexture(const std::string_view path) {
+    auto it = m_textures.find(std::string(path));
+    if (it != m_textures.end()) {
+        return {it->second, m_slots[it->second].generation};
+    }
+    // 被打包进图集的图片：图集页已加载时直接使用，否则等待图集页解码
+    if (!m_atlasEntries.empty()) {
+        if (auto entryIt = m_atlasEntries.find(normalizeAtlasKey(path)); entryIt != m_atlasEntries.end()) {
+            const auto& entry = entryIt->second;
+            const auto index = allocateSlot();
+            auto& slot = m_slots[index];
+            slot.region = entry.rect;
+            if (m_atlasPages[entry.page]) {
+                slot.texture = m_atlasPages[entry.page].get();
+            } else {
+                slot.texture = m_placeholder.get();
+                slot.isPending = true;
+                m_atlasPageWaiters[entry.page].push_back({index, slot.generation});
+                if (!m_atlasPageRequested[entry.page]) {
+                    m_atlasPageRequested[entry.page] = true;
+                    m_decoder->request(m_atlasPagePaths[entry.page]);
+                }
+            }
+            m_textures.emplace(path, index);
+            return {index, slot.generation};
+        }
+    }
+    // 单独的图片：先从文件头读取尺寸，解码交给后台线程
+    int width = 0;
+    int height = 0;
+    if (!readImageSize(std::string(path), width, height)) {
+        // 不是 PNG（或文件不存在），无法提前得知尺寸，退化为同步加载
+        if (!loadTexture(path)) return {};
+        it = m_textures.find(std::string(path));
+        return {it->second, m_slots[it->second].generation};
+    }
+    const auto index = allocateSlot();
+    auto& slot = m_slots[index];
+    slot.texture = m_placeholder.get();
+    slot.region = {0.0f, 0.0f, static_cast<float>(width), static_cast<float>(height)};
+    slot.isPending = true;
+    m_textures.emplace(path, index);
+    m_decoder->request(std::string(path));
+    spdlog::debug("RESOURCEMANAGER::TEXTUREMANAGER::requestTexture::提交后台解码: {} ({}x{})", path, width, height);
+    return {index, slot.generation};
+}
+
+void TextureManager::processDecodedTextures(int maxUploads) {
+    ImageDecoder::Result result;
+    int uploads = 0;
+    while (uploads < maxUploads && m_decoder->poll(result)) {
+        // 图集页
+        auto pageIt = std::find(m_atlasPagePaths.begin(), m_atlasPagePaths.end(), result.path);
+        if (pageIt != m_atlasPagePaths.end()) {
+            const auto page = static_cast<std::uint32_t>(pageIt - m_atlasPagePaths.begin());
+            if (m_atlasPageRequested[page]) {
+                finishAtlasPage(page, result.surface.get());
+                ++uploads;
+            }
+            continue;
+        }
+        // 单独的图片（请求后可能已被卸载，或已被同步加载）
+        auto it = m_textures.find(result.path);
+        if (it == m_textures.end() || !m_slots[it->second].isPending) {
+            continue;
+        }
+        finishPendingSlot(it->second, result.surface ? createTextureFromSurface(result.surface.get()) : nullptr, true);
+        ++uploads;
     }
-    spdlog::warn("RESOURCEMANAGER::TEXTUREMANAGER::getTextureSize::未找到纹理, 尝试加载: {}", path);
-    return loadTexture(path);
+}
+
+bool TextureManager::hasPendingTextures() const {
+    return m_decoder->getInFlightCount() > 0;
 }
 
 glm::vec2 TextureManager::getTextureSize(const std::string_view path) {
-    SDL_Texture *texture = getTexture(path);
-    if (!texture) {
+    auto handle = getTextureHandle(path);
+    if (!getTexture(handle)) {
         spdlog::error("RESOURCEMANAGER::TEXTUREMANAGER::getTextureSize::未找到纹理 \"{}\"", path);
         return glm::vec2(0, 0);
     }
-    glm::vec2 size;
-    if (!SDL_GetTextureSize(texture, &size.x, &size.y)) {
-        spdlog::error("RESOURCEMANAGER::TEXTUREMANAGER::getTextureSize::获取纹理大小失败: {}", SDL_GetError());
-        return glm::vec2(0, 0);
-    }
-    return size;
+    // 返回图片本身的尺寸（图集中的图片为其区域尺寸，而非整页尺寸）
+    const auto& region = getTextureRegion(handle);
+    return glm::vec2(region.w, region.h);
 }
 
 void TextureManager::unloadTexture(const std::string_view path) {
     auto it = m_textures.find(std::string(path));
     if (it != m_textures.end()) {
+        releaseSlot(it->second);
         m_textures.erase(it);
         spdlog::debug("RESOURCEMANAGER::TEXTUREMANAGER::unloadTexture::卸载纹理 \"{}\" 成功", path);
     } else {
@@ -83,12 +200,204 @@ void TextureManager::unloadTexture(const std::string_view path) {
 
 void TextureManager::clearTextures() {
     if (!m_textures.empty()) {
-        m_textures.clear();
         spdlog::debug("RESOURCEMANAGER::TEXTUREMANAGER::clearTextures::正在清理 {} 个缓存的纹理...", m_textures.size());
+        for (const auto& [path, index] : m_textures) {
+            releaseSlot(index);
+        }
+        m_textures.clear();
+        for (auto& page : m_atlasPages) {
+            page.reset();
+        }
+        m_atlasPageRequested.assign(m_atlasPages.size(), false);   // 仍在解码的图集页结果到达后直接丢弃
+        for (auto& waiters : m_atlasPageWaiters) {
+            waiters.clear();
+        }
     } else {
         spdlog::warn("RESOURCEMANAGER::TEXTUREMANAGER::clearTextures::纹理列表为空, 无需清理");
     }
 }
 /// @}
 
+bool TextureManager::loadAtlasManifest(const std::string_view manifestPath) {
+    if (std::any_of(m_atlasPages.begin(), m_atlasPages.end(), [](const auto& page) { return page != nullptr; })) {
+        spdlog::warn("RESOURCEMANAGER::TEXTUREMANAGER::loadAtlasManifest::已有图集页在使用中, 忽略新的图集清单: {}", manifestPath);
+        return false;
+    }
+    const std::filesystem::path path(manifestPath);
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        spdlog::info("RESOURCEMANAGER::TEXTUREMANAGER::loadAtlasManifest::未找到纹理图集清单 {}, 所有图片将单独加载", manifestPath);
+        return false;
+    }
+    nlohmann::json json;
+    try {
+        file >> json;
+    } catch (const nlohmann::json::parse_error& e) {
+        spdlog::error("RESOURCEMANAGER::TEXTUREMANAGER::loadAtlasManifest::解析图集清单失败: {} : {}", manifestPath, e.what());
+        return false;
+    }
+    if (!json.contains("pages") || !json["pages"].is_array() || !json.contains("entries") || !json["entries"].is_object()) {
+        spdlog::error("RESOURCEMANAGER::TEXTUREMANAGER::loadAtlasManifest::图集清单缺少 'pages' 或 'entries': {}", manifestPath);
+        return false;
+    }
+
+    // 图集页路径相对于清单文件所在目录
+    std::vector<std::string> pagePaths;
+    for (const auto& page : json["pages"]) {
+        pagePaths.push_back((path.parent_path() / page.get<std::string>()).generic_string());
+    }
+    std::unordered_map<std::string, AtlasEntry> entries;
+    for (const auto& [imagePath, entryJson] : json["entries"].items()) {
+        const int page = entryJson.value("page", -1);
+        if (page < 0 || page >= static_cast<int>(pagePaths.size())) {
+            spdlog::warn("RESOURCEMANAGER::TEXTUREMANAGER::loadAtlasManifest::图片 {} 的图集页序号无效: {}", imagePath, page);
+            continue;
+        }
+        SDL_FRect rect = {entryJson.value("x", 0.0f), entryJson.value("y", 0.0f), entryJson.value("w", 0.0f), entryJson.value("h", 0.0f)};
+        entries.emplace(normalizeAtlasKey(imagePath), AtlasEntry{static_cast<std::uint32_t>(page), rect});
+    }
+
+    m_atlasPagePaths = std::move(pagePaths);
+    m_atlasPages.clear();
+    m_atlasPages.resize(m_atlasPagePaths.size());
+    m_atlasPageRequested.assign(m_atlasPagePaths.size(), false);
+    m_atlasPageWaiters.assign(m_atlasPagePaths.size(), {});
+    m_atlasEntries = std::move(entries);
+    spdlog::info("RESOURCEMANAGER::TEXTUREMANAGER::loadAtlasManifest::加载纹理图集清单: {} 张图片, {} 页", m_atlasEntries.size(), m_atlasPagePaths.size());
+    return true;
+}
+
+std::uint32_t TextureManager::allocateSlot() {
+    std::uint32_t index;
+    if (!m_freeSlots.empty()) {
+        index = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    } else {
+        index = static_cast<std::uint32_t>(m_slots.size());
+        m_slots.emplace_back();
+    }
+    return index;
+}
+
+void TextureManager::releaseSlot(std::uint32_t index) {
+    auto& slot = m_slots[index];
+    slot.owned.reset();
+    slot.isPending = false;
+    slot.texture = nullptr;
+    ++slot.generation;
+    m_freeSlots.push_back(index);
+}
+
+SDL_Texture *TextureManager::loadFromAtlas(const std::string_view path) {
+    auto entryIt = m_atlasEntries.find(normalizeAtlasKey(path));
+    if (entryIt == m_atlasEntries.end()) return nullptr;
+    const auto& entry = entryIt->second;
+
+    auto& page = m_atlasPages[entry.page];
+    if (!page) {
+        page.reset(loadTextureFile(m_atlasPagePaths[entry.page]));
+        if (!page) {
+            spdlog::error("RESOURCEMANAGER::TEXTUREMANAGER::loadFromAtlas::加载图集页失败: {} : {}", m_atlasPagePaths[entry.page], SDL_GetError());
+            return nullptr;     // 回退为单独加载原始图片
+        }
+        spdlog::debug("RESOURCEMANAGER::TEXTUREMANAGER::loadFromAtlas::加载图集页: {}", m_atlasPagePaths[entry.page]);
+    }
+
+    const auto index = allocateSlot();
+    auto& slot = m_slots[index];
+    slot.texture = page.get();
+    slot.region = entry.rect;
+    m_textures.emplace(path, index);
+    spdlog::debug("RESOURCEMANAGER::TEXTUREMANAGER::loadFromAtlas::纹理 {} 使用图集页 {}", path, entry.page);
+    return slot.texture;
+}
+
+SDL_Texture *TextureManager::loadTextureFile(const std::string &path) {
+    SDL_Texture *texture = IMG_LoadTexture(m_renderer, path.c_str());
+    if (!texture) return nullptr;
+    // 载入纹理时，设置纹理缩放模式为最邻近插值(必不可少，否则TileLayer渲染中会出现边缘空隙/模糊)
+    if (!SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_NEAREST)) {
+        spdlog::warn("RESOURCEMANAGER::TEXTUREMANAGER::无法设置纹理缩放模式为最邻近插值");
+    }
+    return texture;
+}
+
+SDL_Texture *TextureManager::createTextureFromSurface(SDL_Surface* surface) {
+    SDL_Texture *texture = SDL_CreateTextureFromSurface(m_renderer, surface);
+    if (!texture) return nullptr;
+    if (!SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_NEAREST)) {
+        spdlog::warn("RESOURCEMANAGER::TEXTUREMANAGER::无法设置纹理缩放模式为最邻近插值");
+    }
+    return texture;
+}
+
+void TextureManager::finishPendingSlot(std::uint32_t index, SDL_Texture* texture, bool isOwned) {
+    auto& slot = m_slots[index];
+    slot.isPending = false;
+    if (!texture) {
+        // 不能继续使用占位纹理：否则绘制时会一直画出透明纹理而不再报错。置空后与同步加载失败时相同，由绘制处跳过并报错
+        spdlog::error("RESOURCEMANAGER::TEXTUREMANAGER::finishPendingSlot::纹理加载失败: {}", SDL_GetError());
+        slot.texture = nullptr;
+        return;
+    }
+    if (isOwned) {
+        slot.owned.reset(texture);
+        slot.region = {0.0f, 0.0f, 0.0f, 0.0f};
+        SDL_GetTextureSize(texture, &slot.region.w, &slot.region.h);
+    }
+    slot.texture = texture;
+}
+
+void TextureManager::finishAtlasPage(std::uint32_t page, SDL_Surface* surface) {
+    m_atlasPageRequested[page] = false;
+    if (!m_atlasPages[page] && surface) {      // 期间可能已被同步加载
+        m_atlasPages[page].reset(createTextureFromSurface(surface));
+    }
+    SDL_Texture* texture = m_atlasPages[page].get();
+    for (const auto& waiter : m_atlasPageWaiters[page]) {
+        // 槽位可能已被卸载并复用，代数不一致的跳过
+        if (m_slots[waiter.index].generation == waiter.generation && m_slots[waiter.index].isPending) {
+            finishPendingSlot(waiter.index, texture, false);
+        }
+    }
+    m_atlasPageWaiters[page].clear();
+    spdlog::debug("RESOURCEMANAGER::TEXTUREMANAGER::finishAtlasPage::上传图集页: {}", m_atlasPagePaths[page]);
+}
+
+bool TextureManager::readImageSize(const std::string& path, int& width, int& height) {
+    // PNG 文件: 8 字节签名, 然后是 IHDR 块 (4 字节长度 + "IHDR" + 宽 + 高, 均为大端序)
+    static constexpr unsigned char PNG_SIGNATURE[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    std::ifstream file(path, std::ios::binary);
+    unsigned char header[24];
+    if (!file.read(reinterpret_cast<char*>(header), sizeof(header))) return false;
+    if (!std::equal(std::begin(PNG_SIGNATURE), std::end(PNG_SIGNATURE), header)) return false;
+    if (header[12] != 'I' || header[13] != 'H' || header[14] != 'D' || header[15] != 'R') return false;
+    auto readBigEndian = [&](int offset) {
+        return (header[offset] << 24) | (header[offset + 1] << 16) | (header[offset + 2] << 8) | header[offset + 3];
+    };
+    width = readBigEndian(16);
+    height = readBigEndian(20);
+    return width > 0 && height > 0;
+}
+
+void TextureManager::addOwnedTexture(const std::string_view path, SDL_Texture* texture) {
+    const auto index = allocateSlot();
+    auto& slot = m_slots[index];
+    slot.owned.reset(texture);
+    slot.texture = texture;
+    slot.region = {0.0f, 0.0f, 0.0f, 0.0f};
+    SDL_GetTextureSize(texture, &slot.region.w, &slot.region.h);
+    m_textures.emplace(path, index);
+}
+
+std::string TextureManager::normalizeAtlasKey(const std::string_view path) {
+    std::filesystem::path result(path);
+    if (result.is_absolute()) {
+        std::error_code ec;
+        auto relative = std::filesystem::relative(result, ec);
+        if (!ec && !relative.empty()) result = std::move(relative);
+    }
+    return result.lexically_normal().generic_string();
+}
+
 } // namespace engine::resource
\ No newline at end of file
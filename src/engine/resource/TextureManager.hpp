@@ -1,21 +1,37 @@
 #pragma once
+#include "TextureHandle.hpp"
+
 #include <unordered_map>
 #include <string>
 #include <string_view>
 #include <memory>
+#include <vector>
 
+#include <SDL3/SDL_rect.h>
 #include <glm/glm.hpp>
 
 struct SDL_Texture;
+struct SDL_Surface;
 struct SDL_Renderer;
 
+namespace engine::core {
+class JobSystem;
+} // namespace engine::core
+
 namespace engine::resource {
+class ImageDecoder;
 
 /**
  * @class TextureManager
  * @brief 纹理管理器，用于加载和管理纹理资源
  * @note 纹理管理器是单例模式，通过 ResourceManager 获取，不可直接访问
  * @note 纹理管理器使用智能指针管理纹理的生命周期
+ * @note 纹理存放在连续的槽位数组中，路径只在加载时用于查找槽位；绘制时通过 TextureHandle 直接下标访问
+ * @note 加载图集清单 (loadAtlasManifest) 后，被打包进图集的图片不再单独创建纹理：
+ *       其槽位指向图集页纹理，并记录该图片在页中的区域 (getTextureRegion)
+ * @note 通过 requestTexture 请求的纹理在任务系统的工作线程解码 (ImageDecoder)，句柄立即返回：
+ *       图片尺寸在请求时从文件头读取，解码完成前槽位指向透明的占位纹理，
+ *       主线程每帧在 processDecodedTextures 中上传有限数量的解码结果；解码失败时槽位的纹理置空（与同步加载失败相同）
  */
 class TextureManager final {
     friend class ResourceManager; // 友元类，允许 ResourceManager 访问私有成员
@@ -28,16 +44,49 @@ private:
     struct SDLTextureDeleter {
         void operator()(SDL_Texture* texture) const; // 定义删除器函数
     };
-    std::unordered_map<std::string, std::unique_ptr<SDL_Texture, SDLTextureDeleter>> m_textures = {};
+    /// @brief 纹理槽位
+    struct TextureSlot {
+        std::unique_ptr<SDL_Texture, SDLTextureDeleter> owned;      ///< @brief 槽位独占的纹理（图集中的图片为空）
+        SDL_Texture* texture = nullptr;                             ///< @brief 绘制使用的纹理（独占纹理或图集页纹理）
+        SDL_FRect region = {0.0f, 0.0f, 0.0f, 0.0f};                ///< @brief 图片在纹理中的区域（像素）
+        std::uint32_t generation = 0;                               ///< @brief 槽位代数，纹理卸载时递增
+        bool isPending = false;                                     ///< @brief 图片正在后台解码（texture 暂时为占位纹理）
+    };
+    /// @brief 图集清单中的一项：原始图片位于哪一页的哪个区域
+    struct AtlasEntry {
+        std::uint32_t page;
+        SDL_FRect rect;
+    };
+    std::vector<TextureSlot> m_slots;                               ///< @brief 所有纹理槽位
+    std::vector<std::uint32_t> m_freeSlots;                         ///< @brief 空闲槽位下标
+    std::unordered_map<std::string, std::uint32_t> m_textures = {}; ///< @brief 路径 -> 槽位下标
+
+    /// @name 纹理图集
+    /// @{
+    std::unordered_map<std::string, AtlasEntry> m_atlasEntries;     ///< @brief 原始图片路径（规范化后）-> 图集区域
+    std::vector<std::string> m_atlasPagePaths;                      ///< @brief 各图集页的图片路径
+    std::vector<std::unique_ptr<SDL_Texture, SDLTextureDeleter>> m_atlasPages;   ///< @brief 图集页纹理（首次使用时加载）
+    std::vector<bool> m_atlasPageRequested;                         ///< @brief 图集页是否已提交后台解码
+    std::vector<std::vector<TextureHandle>> m_atlasPageWaiters;     ///< @brief 等待各图集页解码完成的槽位
+    /// @}
+
+    /// @name 后台解码
+    /// @{
+    static constexpr int MAX_UPLOADS_PER_FRAME = 8;                 ///< @brief 每帧最多上传的解码结果数
+    std::unique_ptr<ImageDecoder> m_decoder;                        ///< @brief 图片解码器（解码在任务系统的工作线程进行）
+    std::unique_ptr<SDL_Texture, SDLTextureDeleter> m_placeholder;  ///< @brief 解码完成前使用的占位纹理（1x1 透明）
+    /// @}
+
     SDL_Renderer* m_renderer = nullptr;
 
 public:
     /**
      * @brief 构造函数，初始化 TextureManager
      * @param renderer 渲染器指针
+     * @param jobSystem 执行图片解码任务的任务系统
      * @throw std::runtime_error 如果渲染器为空或初始化失败，则抛出异常
      */
-    explicit TextureManager(SDL_Renderer* renderer);
+    TextureManager(SDL_Renderer* renderer, engine::core::JobSystem& jobSystem);
     ~TextureManager(); // 析构函数，清空纹理管理器中的所有纹理
 
     /// @name 删除移动拷贝构造函数
@@ -58,12 +107,54 @@ private:
      * @return 加载的纹理指针
      */
     SDL_Texture* loadTexture(const std::string_view path);
+    /**
+     * @brief 请求异步加载纹理，立即返回句柄（不会在调用线程解码图片）
+     * @param path 纹理文件的路径
+     * @return 纹理句柄；解码完成前句柄指向占位纹理，区域已是图片的真实尺寸。无法读取图片尺寸时退化为同步加载
+     */
+    TextureHandle requestTexture(const std::string_view path);
+    /**
+     * @brief 上传后台解码完成的纹理（每帧在主线程调用一次）
+     * @param maxUploads 本次最多上传的数量
+     */
+    void processDecodedTextures(int maxUploads = MAX_UPLOADS_PER_FRAME);
+    /// @brief 是否还有纹理在后台解码或等待上传
+    bool hasPendingTextures() const;
+    /**
+     * @brief 用已解码好的图片创建纹理并存储在纹理管理器中（只做 GPU 上传，图片解码可以在后台线程完成）
+     * @param path 纹理文件的路径（即纹理ID）
+     * @param surface 已解码的图片（不转移所有权）；同名纹理已存在或图片被打包进图集时不会使用它
+     * @return 纹理指针，失败时返回 nullptr
+     */
+    SDL_Texture* loadTextureFromSurface(const std::string_view path, SDL_Surface* surface);
     /**
      * @brief 从纹理管理器中获取纹理
      * @param name 纹理的名称
      * @return 纹理指针
      */
     SDL_Texture* getTexture(const std::string_view path);
+    /**
+     * @brief 获取纹理句柄（纹理未加载时会尝试加载）
+     * @param path 纹理的路径
+     * @return 纹理句柄，加载失败时返回无效句柄
+     */
+    TextureHandle getTextureHandle(const std::string_view path);
+    /**
+     * @brief 通过句柄获取纹理（只做一次下标访问）
+     * @param handle 纹理句柄
+     * @return 纹理指针，句柄无效或纹理已卸载时返回 nullptr
+     */
+    SDL_Texture* getTexture(TextureHandle handle) const {
+        if (handle.index >= m_slots.size()) return nullptr;
+        const auto& slot = m_slots[handle.index];
+        return slot.generation == handle.generation ? slot.texture : nullptr;
+    }
+    /**
+     * @brief 通过句柄获取图片在纹理中的区域（单独的纹理为整张纹理，图集中的图片为其在图集页中的区域）
+     * @param handle 纹理句柄（需为有效句柄）
+     * @return 区域（像素）
+     */
+    const SDL_FRect& getTextureRegion(TextureHandle handle) const { return m_slots[handle.index].region; }
     /**
      * @brief 获取纹理的大小
      * @param name 纹理的名称
@@ -78,8 +169,39 @@ private:
     
     /// @brief 清空纹理管理器中的所有纹理
     void clearTextures();
+
+    /**
+     * @brief 加载纹理图集清单（由 AtlasPacker 生成），之后加载清单中的图片时将使用图集页纹理
+     * @param manifestPath 清单文件路径
+     * @return 是否加载成功
+     */
+    bool loadAtlasManifest(const std::string_view manifestPath);
     /// @}
 
+    /// @brief 分配一个槽位，返回槽位下标
+    std::uint32_t allocateSlot();
+    /// @brief 释放槽位（销毁纹理并递增代数，使旧句柄失效）
+    void releaseSlot(std::uint32_t index);
+    /// @brief 若图片被打包进图集，则为其分配指向图集页的槽位并返回纹理，否则返回 nullptr
+    SDL_Texture* loadFromAtlas(const std::string_view path);
+    /// @brief 从文件加载纹理并设置为最邻近采样
+    SDL_Texture* loadTextureFile(const std::string& path);
+    /// @brief 为独占纹理分配槽位并登记路径
+    void addOwnedTexture(const std::string_view path, SDL_Texture* texture);
+    /// @brief 用解码好的图片创建纹理并设置为最邻近采样
+    SDL_Texture* createTextureFromSurface(SDL_Surface* surface);
+    /// @brief 把等待中的槽位指向上传完成的纹理（texture 为空表示解码或上传失败，槽位的纹理置空）
+    void finishPendingSlot(std::uint32_t index, SDL_Texture* texture, bool isOwned);
+    /// @brief 上传一个图集页的解码结果，并通知等待该页的槽位
+    void finishAtlasPage(std::uint32_t page, SDL_Surface* surface);
+    /**
+     * @brief 只读取 PNG 文件头中的图片尺寸（不解码）
+     * @return 是否成功（文件不存在或不是 PNG 时返回 false）
+     */
+    static bool readImageSize(const std::string& path, int& width, int& height);
+    /// @brief 规范化图片路径（绝对路径转为相对于工作目录的路径，统一分隔符），用于图集查找
+    static std::string normalizeAtlasKey(const std::string_view path);
+
 };
 
 }
\ No newline at end of file
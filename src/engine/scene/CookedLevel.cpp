@@ -0,0 +1,437 @@
+#include "CookedLevel.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace engine::scene {
+
+namespace {
+
+constexpr char MAGIC[4] = {'S', 'L', 'V', 'L'};
+
+/// @brief 精灵标志位
+enum SpriteFlags : std::uint8_t {
+    SPRITE_HAS_RECT = 1 << 0,
+    SPRITE_FLIPPED  = 1 << 1,
+};
+
+/// @brief 对象标志位
+enum ObjectFlags : std::uint8_t {
+    OBJECT_HAS_SPRITE   = 1 << 0,
+    OBJECT_HAS_COLLIDER = 1 << 1,
+    OBJECT_TRIGGER      = 1 << 2,
+    OBJECT_HAS_PHYSICS  = 1 << 3,
+    OBJECT_USE_GRAVITY  = 1 << 4,
+    OBJECT_HAS_HEALTH   = 1 << 5,
+};
+
+/// @brief 计算文件内容的 FNV-1a 64位哈希
+bool hashFile(const std::string& path, std::uint64_t& size, std::uint64_t& hash) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) return false;
+    const std::vector<char> content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    hash = 14695981039346656037ull;
+    for (char c : content) {
+        hash ^= static_cast<std::uint8_t>(c);
+        hash *= 1099511628211ull;
+    }
+    size = content.size();
+    return true;
+}
+
+/// @brief 顺序写入的二进制缓冲区
+class BinaryWriter {
+    std::vector<std::byte> m_buffer;
+public:
+    template<typename T>
+    void write(const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        writeBytes(&value, sizeof(T));
+    }
+    void writeBytes(const void* data, size_t size) {
+        const auto* bytes = static_cast<const std::byte*>(data);
+        m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+    }
+    void writeString(std::string_view str) {
+        write(static_cast<std::uint32_t>(str.size()));
+        writeBytes(str.data(), str.size());
+    }
+    void writeVec2(glm::vec2 v) { write(v.x); write(v.y); }
+    void writeRect(const SDL_FRect& rect) { write(rect.x); write(rect.y); write(rect.w); write(rect.h); }
+    const std::vector<std::byte>& getBuffer() const { return m_buffer; }
+};
+
+/// @brief 顺序读取的二进制视图（越界后所有读取返回默认值，并将 isOk() 置为 false）
+class BinaryReader {
+    std::span<const std::byte> m_bytes;
+    size_t m_pos = 0;
+    bool m_ok = true;
+public:
+    explicit BinaryReader(std::span<const std::byte> bytes) : m_bytes(bytes) {}
+
+    template<typename T>
+    T read() {
+        static_assert(std::is_trivially_copyable_v<T>);
+        T value{};
+        if (!m_ok || remaining() < sizeof(T)) {
+            m_ok = false;
+            return value;
+        }
+        std::memcpy(&value, m_bytes.data() + m_pos, sizeof(T));
+        m_pos += sizeof(T);
+        return value;
+    }
+    std::string_view readString() {
+        const auto size = read<std::uint32_t>();
+        if (!m_ok || remaining() < size) {
+            m_ok = false;
+            return {};
+        }
+        std::string_view str(reinterpret_cast<const char*>(m_bytes.data() + m_pos), size);
+        m_pos += size;
+        return str;
+    }
+    /// @brief 读取 count 个元素的紧密数组（一次 memcpy）
+    template<typename T>
+    void readArray(std::vector<T>& out, size_t count) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        if (!m_ok || remaining() / sizeof(T) < count) {
+            m_ok = false;
+            return;
+        }
+        out.resize(count);
+        std::memcpy(out.data(), m_bytes.data() + m_pos, count * sizeof(T));
+        m_pos += count * sizeof(T);
+    }
+    /// @brief 读取元素数量（每个元素至少占 1 字节，数量超过剩余字节数说明数据已损坏）
+    size_t readCount() {
+        const auto count = read<std::uint32_t>();
+        if (count > remaining()) m_ok = false;
+        return m_ok ? count : 0;
+    }
+    glm::vec2 readVec2() {
+        const float x = read<float>();
+        const float y = read<float>();
+        return {x, y};
+    }
+    SDL_FRect readRect() {
+        SDL_FRect rect;
+        rect.x = read<float>();
+        rect.y = read<float>();
+        rect.w = read<float>();
+        rect.h = read<float>();
+        return rect;
+    }
+    size_t remaining() const { return m_bytes.size() - m_pos; }
+    bool isOk() const { return m_ok; }
+    void fail() { m_ok = false; }
+};
+
+/// @brief 字符串表（写入时去重）
+class StringTable {
+    std::unordered_map<std::string, std::uint32_t> m_indices;
+    std::vector<std::string_view> m_strings;    // 指向 m_indices 中的键（节点地址稳定）
+public:
+    std::uint32_t add(const std::string& str) {
+        auto [it, inserted] = m_indices.try_emplace(str, static_cast<std::uint32_t>(m_strings.size()));
+        if (inserted) m_strings.push_back(it->first);
+        return it->second;
+    }
+    void write(BinaryWriter& writer) const {
+        writer.write(static_cast<std::uint32_t>(m_strings.size()));
+        for (auto str : m_strings) writer.writeString(str);
+    }
+};
+
+void writeSprite(BinaryWriter& writer, StringTable& strings, const engine::render::Sprite& sprite) {
+    writer.write(strings.add(std::string(sprite.getTextureID())));
+    const auto& rect = sprite.getSourceRect();
+    std::uint8_t flags = 0;
+    if (rect) flags |= SPRITE_HAS_RECT;
+    if (sprite.isFlipped()) flags |= SPRITE_FLIPPED;
+    writer.write(flags);
+    if (rect) writer.writeRect(*rect);
+}
+
+void writeObject(BinaryWriter& writer, StringTable& strings, const ObjectData& object) {
+    std::uint8_t flags = 0;
+    if (object.sprite) flags |= OBJECT_HAS_SPRITE;
+    if (object.hasCollider) flags |= OBJECT_HAS_COLLIDER;
+    if (object.isTrigger) flags |= OBJECT_TRIGGER;
+    if (object.hasPhysics) flags |= OBJECT_HAS_PHYSICS;
+    if (object.useGravity) flags |= OBJECT_USE_GRAVITY;
+    if (object.health) flags |= OBJECT_HAS_HEALTH;
+    writer.write(flags);
+    writer.write(strings.add(object.name));
+    writer.write(strings.add(object.tag));
+    writer.writeVec2(object.position);
+    writer.writeVec2(object.scale);
+    writer.write(object.rotation);
+    if (object.sprite) writeSprite(writer, strings, *object.sprite);
+    if (object.hasCollider) {
+        writer.writeVec2(object.colliderSize);
+        writer.writeVec2(object.colliderOffset);
+    }
+    if (object.health) writer.write(static_cast<std::int32_t>(*object.health));
+    writer.write(static_cast<std::uint32_t>(object.animations.size()));
+    for (const auto& animation : object.animations) {
+        writer.write(strings.add(animation.name));
+        writer.write(static_cast<std::uint32_t>(animation.frames.size()));
+        for (const auto& frame : animation.frames) {
+            writer.writeRect(frame.sourceRect);
+            writer.write(frame.duration);
+        }
+    }
+}
+
+void writeLayer(BinaryWriter& writer, StringTable& strings, const LayerData& layer) {
+    writer.write(static_cast<std::uint8_t>(layer.type));
+    writer.write(strings.add(layer.name));
+    writer.write(static_cast<std::int32_t>(layer.sortLayer));
+    switch (layer.type) {
+        case LayerType::IMAGE:
+            writer.write(strings.add(layer.textureID));
+            writer.writeVec2(layer.offset);
+            writer.writeVec2(layer.scrollFactor);
+            writer.write(static_cast<std::uint8_t>(layer.repeat.x));
+            writer.write(static_cast<std::uint8_t>(layer.repeat.y));
+            break;
+        case LayerType::TILE:
+            writer.write(static_cast<std::uint32_t>(layer.palette.size()));
+            for (const auto& tileInfo : layer.palette) {
+                writeSprite(writer, strings, tileInfo.sprite);
+                writer.write(static_cast<std::uint8_t>(tileInfo.type));
+            }
+            writer.write(static_cast<std::uint32_t>(layer.cells.size()));
+            writer.writeBytes(layer.cells.data(), layer.cells.size() * sizeof(std::uint16_t));
+            break;
+        case LayerType::OBJECT:
+            writer.write(static_cast<std::uint32_t>(layer.objects.size()));
+            for (const auto& object : layer.objects) {
+                writeObject(writer, strings, object);
+            }
+            break;
+    }
+}
+
+/// @brief 读取字符串表下标并返回对应的字符串
+std::string_view readStringRef(BinaryReader& reader, const std::vector<std::string_view>& strings) {
+    const auto index = reader.read<std::uint32_t>();
+    if (index >= strings.size()) {
+        reader.fail();
+        return {};
+    }
+    return strings[index];
+}
+
+engine::render::Sprite readSprite(BinaryReader& reader, const std::vector<std::string_view>& strings) {
+    const auto textureID = readStringRef(reader, strings);
+    const auto flags = reader.read<std::uint8_t>();
+    std::optional<SDL_FRect> rect;
+    if (flags & SPRITE_HAS_RECT) rect = reader.readRect();
+    return engine::render::Sprite(textureID, rect, (flags & SPRITE_FLIPPED) != 0);
+}
+
+void readObject(BinaryReader& reader, const std::vector<std::string_view>& strings, ObjectData& object) {
+    const auto flags = reader.read<std::uint8_t>();
+    object.name = readStringRef(reader, strings);
+    object.tag = readStringRef(reader, strings);
+    object.position = reader.readVec2();
+    object.scale = reader.readVec2();
+    object.rotation = reader.read<float>();
+    if (flags & OBJECT_HAS_SPRITE) object.sprite = readSprite(reader, strings);
+    object.hasCollider = (flags & OBJECT_HAS_COLLIDER) != 0;
+    if (object.hasCollider) {
+        object.colliderSize = reader.readVec2();
+        object.colliderOffset = reader.readVec2();
+    }
+    object.isTrigger = (flags & OBJECT_TRIGGER) != 0;
+    object.hasPhysics = (flags & OBJECT_HAS_PHYSICS) != 0;
+    object.useGravity = (flags & OBJECT_USE_GRAVITY) != 0;
+    if (flags & OBJECT_HAS_HEALTH) object.health = reader.read<std::int32_t>();
+    const size_t animationCount = reader.readCount();
+    object.animations.resize(animationCount);
+    for (auto& animation : object.animations) {
+        animation.name = readStringRef(reader, strings);
+        const size_t frameCount = reader.readCount();
+        animation.frames.resize(frameCount);
+        for (auto& frame : animation.frames) {
+            frame.sourceRect = reader.readRect();
+            frame.duration = reader.read<float>();
+        }
+    }
+}
+
+void readLayer(BinaryReader& reader, const std::vector<std::string_view>& strings, LayerData& layer) {
+    const auto type = reader.read<std::uint8_t>();
+    if (type > static_cast<std::uint8_t>(LayerType::OBJECT)) {
+        reader.fail();
+        return;
+    }
+    layer.type = static_cast<LayerType>(type);
+    layer.name = readStringRef(reader, strings);
+    layer.sortLayer = reader.read<std::int32_t>();
+    switch (layer.type) {
+        case LayerType::IMAGE:
+            layer.textureID = readStringRef(reader, strings);
+            layer.offset = reader.readVec2();
+            layer.scrollFactor = reader.readVec2();
+            layer.repeat.x = reader.read<std::uint8_t>() != 0;
+            layer.repeat.y = reader.read<std::uint8_t>() != 0;
+            break;
+        case LayerType::TILE: {
+            const size_t paletteCount = reader.readCount();
+            layer.palette.reserve(paletteCount);
+            for (size_t i = 0; i < paletteCount && reader.isOk(); ++i) {
+                auto sprite = readSprite(reader, strings);
+                const auto tileType = reader.read<std::uint8_t>();
+                if (tileType > static_cast<std::uint8_t>(engine::component::TileType::LADDER)) {
+                    reader.fail();
+                    return;
+                }
+                layer.palette.emplace_back(std::move(sprite), static_cast<engine::component::TileType>(tileType));
+            }
+            reader.readArray(layer.cells, reader.read<std::uint32_t>());
+            break;
+        }
+        case LayerType::OBJECT: {
+            const size_t objectCount = reader.readCount();
+            layer.objects.resize(objectCount);
+            for (auto& object : layer.objects) {
+                if (!reader.isOk()) return;
+                readObject(reader, strings, object);
+            }
+            break;
+        }
+    }
+}
+
+} // namespace
+
+std::string CookedLevel::getCookedPath(std::string_view mapPath) {
+    return std::filesystem::path(mapPath).replace_extension(EXTENSION).string();
+}
+
+bool CookedLevel::save(const LevelData& level, std::string_view path) {
+    // 1. 图层数据（先写入单独的缓冲区，同时收集字符串表）
+    StringTable strings;
+    BinaryWriter body;
+    body.write(static_cast<std::int32_t>(level.mapSize.x));
+    body.write(static_cast<std::int32_t>(level.mapSize.y));
+    body.write(static_cast<std::int32_t>(level.tileSize.x));
+    body.write(static_cast<std::int32_t>(level.tileSize.y));
+    body.write(static_cast<std::uint32_t>(level.layers.size()));
+    for (const auto& layer : level.layers) {
+        writeLayer(body, strings, layer);
+    }
+
+    // 2. 文件头 + 源文件列表 + 字符串表 + 图层数据
+    BinaryWriter file;
+    file.writeBytes(MAGIC, sizeof(MAGIC));
+    file.write(VERSION);
+    file.write(static_cast<std::uint32_t>(level.sourceFiles.size()));
+    for (const auto& source : level.sourceFiles) {
+        std::uint64_t size = 0;
+        std::uint64_t hash = 0;
+        if (!hashFile(source, size, hash)) {
+            spdlog::error("COOKEDLEVEL::save::ERROR::无法读取源文件: {}", source);
+            return false;
+        }
+        file.writeString(source);
+        file.write(size);
+        file.write(hash);
+    }
+    strings.write(file);
+    file.writeBytes(body.getBuffer().data(), body.getBuffer().size());
+
+    // 3. 先写入临时文件再替换，避免游戏读到写了一半的文件
+    const std::filesystem::path outputPath(path);
+    auto tempPath = outputPath;
+    tempPath += ".tmp";
+    {
+        std::ofstream output(tempPath, std::ios::binary | std::ios::trunc);
+        if (!output.is_open()) {
+            spdlog::error("COOKEDLEVEL::save::ERROR::无法写入文件: {}", tempPath.string());
+            return false;
+        }
+        output.write(reinterpret_cast<const char*>(file.getBuffer().data()), static_cast<std::streamsize>(file.getBuffer().size()));
+        if (!output) {
+            spdlog::error("COOKEDLEVEL::save::ERROR::写入文件失败: {}", tempPath.string());
+            return false;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(tempPath, outputPath, ec);
+    if (ec) {
+        spdlog::error("COOKEDLEVEL::save::ERROR::重命名文件失败: {} : {}", outputPath.string(), ec.message());
+        return false;
+    }
+    return true;
+}
+
+bool CookedLevel::load(std::span<const std::byte> bytes, LevelData& level) {
+    BinaryReader reader(bytes);
+    // 1. 文件头
+    char magic[sizeof(MAGIC)] = {};
+    for (auto& c : magic) c = reader.read<char>();
+    if (!reader.isOk() || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0) {
+        spdlog::warn("COOKEDLEVEL::load::WARN::不是有效的预处理关卡文件");
+        return false;
+    }
+    if (const auto version = reader.read<std::uint32_t>(); version != VERSION) {
+        spdlog::info("COOKEDLEVEL::load::INFO::预处理关卡文件版本 {} 与当前版本 {} 不符", version, VERSION);
+        return false;
+    }
+
+    // 2. 源文件是否变化（先比较文件大小，大小一致时再比较内容哈希）
+    LevelData result;
+    const size_t sourceCount = reader.readCount();
+    result.sourceFiles.reserve(sourceCount);
+    for (size_t i = 0; i < sourceCount && reader.isOk(); ++i) {
+        std::string source(reader.readString());
+        const auto size = reader.read<std::uint64_t>();
+        const auto hash = reader.read<std::uint64_t>();
+        if (!reader.isOk()) break;
+        std::error_code ec;
+        const auto currentSize = std::filesystem::file_size(source, ec);
+        std::uint64_t currentHash = 0;
+        std::uint64_t hashedSize = 0;
+        if (ec || currentSize != size || !hashFile(source, hashedSize, currentHash) || currentHash != hash) {
+            spdlog::info("COOKEDLEVEL::load::INFO::源文件 '{}' 已变化，预处理关卡文件已过期", source);
+            return false;
+        }
+        result.sourceFiles.push_back(std::move(source));
+    }
+
+    // 3. 字符串表（字符串视图直接指向文件内容）
+    std::vector<std::string_view> strings(reader.readCount());
+    for (auto& str : strings) {
+        str = reader.readString();
+    }
+
+    // 4. 地图信息与图层
+    result.mapSize.x = reader.read<std::int32_t>();
+    result.mapSize.y = reader.read<std::int32_t>();
+    result.tileSize.x = reader.read<std::int32_t>();
+    result.tileSize.y = reader.read<std::int32_t>();
+    result.layers.resize(reader.readCount());
+    for (auto& layer : result.layers) {
+        if (!reader.isOk()) break;
+        readLayer(reader, strings, layer);
+    }
+    if (!reader.isOk()) {
+        spdlog::error("COOKEDLEVEL::load::ERROR::预处理关卡文件已损坏");
+        return false;
+    }
+    level = std::move(result);
+    return true;
+}
+
+} // namespace engine::scene
@@ -0,0 +1,55 @@
+#pragma once
+#include "LevelData.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace engine::scene {
+
+/**
+ * @brief 预处理（cooked）关卡文件的读写
+ *
+ * 预处理文件是 LevelData 的二进制快照，由离线工具 LevelCooker 从 .tmj/.tsj 生成，
+ * 保存在地图文件旁边（扩展名 .lvlb）。游戏运行时通过内存映射读取，无需解析 JSON。
+ *
+ * 文件布局（小端序，所有字段按字节紧密排列）：
+ * - 文件头：magic "SLVL"、格式版本号
+ * - 源文件列表：路径 + 字节数 + 内容哈希（任一源文件变化即视为过期，回退到解析 .tmj）
+ * - 字符串表：纹理ID、图层名、对象名、标签、动画名（其余位置只保存字符串表下标）
+ * - 地图尺寸、瓦片尺寸
+ * - 图层列表：图片图层参数 / 瓦片调色板 + uint16 格子索引数组 / 已解析好组件参数的对象列表
+ */
+class CookedLevel final {
+public:
+    static constexpr std::uint32_t VERSION = 1;         ///< @brief 格式版本号（格式变化时递增，旧文件自动失效）
+    static constexpr std::string_view EXTENSION = ".lvlb";   ///< @brief 预处理文件扩展名
+
+    CookedLevel() = delete;
+
+    /**
+     * @brief 获取地图文件对应的预处理文件路径 ("assets/maps/level1.tmj" -> "assets/maps/level1.lvlb")
+     * @param mapPath 地图文件路径
+     */
+    static std::string getCookedPath(std::string_view mapPath);
+
+    /**
+     * @brief 把关卡数据写入预处理文件（同时记录 level.sourceFiles 中各源文件的当前内容哈希）
+     * @param level 关卡数据
+     * @param path 输出文件路径
+     * @return bool 是否成功
+     */
+    [[nodiscard]] static bool save(const LevelData& level, std::string_view path);
+
+    /**
+     * @brief 从预处理文件的内容中读取关卡数据
+     * @param bytes 文件内容（通常来自内存映射）
+     * @param level 输出的关卡数据
+     * @return bool 是否成功（版本不符、源文件已变化或数据损坏时返回 false，调用者应回退到解析 .tmj）
+     */
+    [[nodiscard]] static bool load(std::span<const std::byte> bytes, LevelData& level);
+};
+
+} // namespace engine::scene
@@ -0,0 +1,93 @@
+/**
+ * @file LevelData.hpp
+ * @brief 与数据来源无关的关卡描述（组件参数均已解析完毕）
+ *
+ * LevelParser 从 Tiled JSON 文件生成它，CookedLevel 负责它与二进制文件之间的相互转换，
+ * LevelLoader 只根据它创建游戏对象，不再关心数据来自 JSON 还是预处理好的二进制文件。
+ */
+
+#pragma once
+#include "../component/TilelayerComponent.hpp"
+#include "../render/Sprite.hpp"
+
+#include <SDL3/SDL_rect.h>
+#include <glm/vec2.hpp>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace engine::scene {
+
+/// @brief 动画数据（对应一个 engine::render::Animation）
+struct AnimationData {
+    /// @brief 动画帧
+    struct Frame {
+        SDL_FRect sourceRect = {0.0f, 0.0f, 0.0f, 0.0f};   ///< @brief 源矩形
+        float duration = 0.0f;                              ///< @brief 持续时间（秒）
+    };
+    std::string name;               ///< @brief 动画名称
+    std::vector<Frame> frames;      ///< @brief 动画帧（按播放顺序）
+};
+
+/// @brief 对象层中的一个对象（只记录需要添加的组件及其参数）
+struct ObjectData {
+    std::string name;                                   ///< @brief 对象名称
+    std::string tag;                                    ///< @brief 标签（为空则不设置）
+    glm::vec2 position = {0.0f, 0.0f};                  ///< @brief TransformComponent 位置
+    glm::vec2 scale = {1.0f, 1.0f};                     ///< @brief TransformComponent 缩放
+    float rotation = 0.0f;                              ///< @brief TransformComponent 旋转角度
+    std::optional<engine::render::Sprite> sprite;       ///< @brief 有值时添加 SpriteComponent
+    bool hasCollider = false;                           ///< @brief 是否添加 ColliderComponent (AABB)
+    glm::vec2 colliderSize = {0.0f, 0.0f};              ///< @brief 碰撞盒尺寸
+    glm::vec2 colliderOffset = {0.0f, 0.0f};            ///< @brief 碰撞盒相对于 Transform 的偏移
+    bool isTrigger = false;                             ///< @brief 碰撞器是否为触发器
+    bool hasPhysics = false;                            ///< @brief 是否添加 PhysicsComponent
+    bool useGravity = false;                            ///< @brief 物理组件是否受重力影响
+    std::vector<AnimationData> animations;              ///< @brief 非空时添加 AnimationComponent
+    std::optional<int> health;                          ///< @brief 有值时添加 HealthComponent (最大生命值)
+};
+
+/// @brief 图层类型
+enum class LayerType : std::uint8_t {
+    IMAGE,      ///< @brief 图片图层（视差背景）
+    TILE,       ///< @brief 瓦片图层
+    OBJECT,     ///< @brief 对象图层
+};
+
+/// @brief 一个图层（只有与 type 对应的字段有效）
+struct LayerData {
+    LayerType type = LayerType::IMAGE;      ///< @brief 图层类型
+    std::string name;                       ///< @brief 图层名称（即游戏对象名称）
+    int sortLayer = 0;                      ///< @brief 图层序号（用作游戏对象的渲染排序层）
+
+    /// @name 图片图层
+    /// @{
+    std::string textureID;                              ///< @brief 图片纹理ID
+    glm::vec2 offset = {0.0f, 0.0f};                    ///< @brief 图层偏移量
+    glm::vec2 scrollFactor = {1.0f, 1.0f};              ///< @brief 视差因子
+    glm::bvec2 repeat = {false, false};                 ///< @brief 是否重复
+    /// @}
+
+    /// @name 瓦片图层
+    /// @{
+    std::vector<engine::component::TileInfo> palette;   ///< @brief 瓦片调色板 (0 号为空瓦片)
+    std::vector<std::uint16_t> cells;                   ///< @brief 每个格子的调色板索引 (行主序)
+    /// @}
+
+    /// @name 对象图层
+    /// @{
+    std::vector<ObjectData> objects;                    ///< @brief 对象列表
+    /// @}
+};
+
+/// @brief 整个关卡
+struct LevelData {
+    glm::ivec2 mapSize = {0, 0};            ///< @brief 地图尺寸（瓦片数）
+    glm::ivec2 tileSize = {0, 0};           ///< @brief 瓦片尺寸（像素）
+    std::vector<LayerData> layers;          ///< @brief 可见图层（按 Tiled 中的顺序）
+    std::vector<std::string> sourceFiles;   ///< @brief 生成该关卡所用的源文件（地图及图块集，用于判断预处理文件是否过期）
+};
+
+} // namespace engine::scene
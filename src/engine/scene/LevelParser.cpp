@@ -0,0 +1,500 @@
+#include "LevelParser.hpp"
+
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+#include <glm/vec2.hpp>
+
+#include <fstream>
+#include <filesystem>
+#include <limits>
+#include <unordered_map>
+
+namespace engine::scene {
+bool LevelParser::parse(std::string_view mapPath, LevelData& level) {
+    // 1. 加载 JSON 文件
+    auto path = std::filesystem::path(mapPath);
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        spdlog::error("LEVELPARSER::parse::ERROR::无法打开关卡文件: {}", mapPath);
+        return false;
+    }
+    // 2. 解析 JSON 数据
+    nlohmann::json jsonData;
+    try {
+        file >> jsonData;
+    } catch (const nlohmann::json::parse_error& e) {
+        spdlog::error("LEVELPARSER::parse::ERROR::解析 JSON 数据失败: {}", e.what());
+        return false;
+    }
+    // 3. 获取基本地图信息 (名称、地图尺寸、瓦片尺寸)
+    m_tilesetData.clear();
+    m_gidTable.clear();
+    m_sourceFiles.clear();
+    m_mapPath = mapPath;
+    m_sourceFiles.push_back(path.lexically_normal().generic_string());
+    m_mapSize = glm::ivec2(jsonData.value("width", 0), jsonData.value("height", 0));
+    m_tileSize = glm::ivec2(jsonData.value("tilewidth", 0), jsonData.value("tileheight", 0));
+    // 4. 加载 tileset 数据
+    if (jsonData.contains("tilesets") && jsonData["tilesets"].is_array()) {
+        for (const auto& tilesetJson : jsonData["tilesets"]) {
+            if (!tilesetJson.contains("source") || !tilesetJson["source"].is_string() ||
+                !tilesetJson.contains("firstgid") || !tilesetJson["firstgid"].is_number_integer()) {
+                spdlog::error("LEVELPARSER::parse::ERROR::tilesets 对象中缺少有效 'source' 或 'firstgid' 字段。");
+                continue;
+            }
+            auto tilesetPath = resolvePath(tilesetJson["source"].get<std::string>(), m_mapPath);  // 支持隐式转换，可以省略.get<T>()方法，
+            auto firstGid = tilesetJson["firstgid"];
+            loadTileset(tilesetPath, firstGid);
+        }
+    }
+    // 5. 解析图层数据
+    if (!jsonData.contains("layers") || !jsonData["layers"].is_array()) {       // 地图文件中必须有 layers 数组
+        spdlog::error("LEVELPARSER::parse::ERROR::地图文件 '{}' 中缺少或无效的 'layers' 数组。", mapPath);
+        return false;
+    }
+    level = LevelData{};
+    level.mapSize = m_mapSize;
+    level.tileSize = m_tileSize;
+    int layerIndex = -1;
+    for (const auto& layerJson : jsonData["layers"]) {
+        ++layerIndex;       // 图层序号与 Tiled 中的图层顺序一致（包括不可见图层）
+        // 获取各图层对象中的类型（type）字段
+        std::string layerType = layerJson.value("type", "none");
+        if (!layerJson.value("visible", true)) {
+            spdlog::info("LEVELPARSER::parse::INFO::图层 '{}' 不可见，跳过加载。", layerJson.value("name", "Unnamed"));
+            continue;
+        }
+        LayerData layer;
+        layer.name = layerJson.value("name", "Unnamed");
+        layer.sortLayer = layerIndex;
+        // 根据图层类型决定解析方法
+        if (layerType == "imagelayer") {
+            layer.type = LayerType::IMAGE;
+            parseImageLayer(layerJson, layer);
+        } else if (layerType == "tilelayer") {
+            layer.type = LayerType::TILE;
+            parseTileLayer(layerJson, layer);
+        } else if (layerType == "objectgroup") {
+            layer.type = LayerType::OBJECT;
+            parseObjectLayer(layerJson, layer);
+        } else {
+            spdlog::warn("LEVELPARSER::parse::WARN::不支持的图层类型: {}", layerType);
+            continue;
+        }
+        level.layers.push_back(std::move(layer));
+    }
+    level.sourceFiles = m_sourceFiles;
+    return true;
+}
+
+void LevelParser::parseImageLayer(const nlohmann::json& layerJson, LayerData& layer) {
+    // 获取纹理相对路径 （会自动处理'\/'符号）
+    // json.value()返回的是一个临时对象，需要赋值才能保存，不能直接使用std::string_view
+    std::string imagePath = layerJson.value("image", "");
+    if (imagePath.empty()) {
+        spdlog::error("LEVELPARSER::parseImageLayer::ERROR::图层 '{}' 缺少 'image' 属性。", layer.name);
+        return;
+    }
+    layer.textureID = resolvePath(imagePath, m_mapPath);
+    // 获取图层偏移量（json中没有则代表未设置，给默认值即可）
+    layer.offset = glm::vec2(layerJson.value("offsetx", 0.0f), layerJson.value("offsety", 0.0f));
+    // 获取视差因子及重复标志
+    layer.scrollFactor = glm::vec2(layerJson.value("parallaxx", 1.0f), layerJson.value("parallaxy", 1.0f));
+    layer.repeat = glm::bvec2(layerJson.value("repeatx", false), layerJson.value("repeaty", false));
+
+    /*  可用类似方法获取其它各种属性，这里我们暂时用不上 */
+}
+
+void LevelParser::parseTileLayer(const nlohmann::json& layerJson, LayerData& layer) {
+    // 准备调色板（0 号为空瓦片）与格子索引 (格子数量 = 地图宽度 * 地图高度)
+    layer.palette.assign(1, engine::component::TileInfo());
+    layer.cells.clear();
+    if (!layerJson.contains("data") || !layerJson["data"].is_array()) {
+        spdlog::error("LEVELPARSER::parseTileLayer::ERROR::图层 '{}' 缺少 'data' 属性", layer.name);
+        return;
+    }
+    layer.cells.reserve(static_cast<size_t>(m_mapSize.x) * m_mapSize.y);
+    std::unordered_map<int, std::uint16_t> paletteIndexByGid;   // gid -> 调色板索引
+
+    // 获取图层数据 (瓦片 ID 列表)
+    const auto& data = layerJson["data"];
+
+    // 每种 gid 只查表一次，之后的格子直接复用调色板索引
+    for (const auto& gidJson : data) {
+        const int gid = gidJson.get<int>();
+        if (gid == 0) {
+            layer.cells.push_back(0);
+            continue;
+        }
+        auto [it, inserted] = paletteIndexByGid.try_emplace(gid, static_cast<std::uint16_t>(0));
+        if (inserted) {
+            const auto& tileInfo = getTileInfoByGid(gid);
+            if (tileInfo.type == engine::component::TileType::EMPTY) {
+                // 找不到的瓦片按空瓦片处理
+            } else if (layer.palette.size() > std::numeric_limits<std::uint16_t>::max()) {
+                spdlog::error("LEVELPARSER::parseTileLayer::ERROR::图层 '{}' 的瓦片种类过多，gid {} 将按空瓦片处理", layer.name, gid);
+            } else {
+                it->second = static_cast<std::uint16_t>(layer.palette.size());
+                layer.palette.push_back(tileInfo);
+            }
+        }
+        layer.cells.push_back(it->second);
+    }
+}
+
+void LevelParser::parseObjectLayer(const nlohmann::json &layerJson, LayerData& layer) {
+    if (!layerJson.contains("objects") || !layerJson["objects"].is_array()) {
+        spdlog::error("LEVELPARSER::parseObjectLayer::ERROR::图层 '{}' 缺少 'objects' 属性", layer.name);
+        return;
+    }
+    // 获取对象数据
+    const auto& objects = layerJson["objects"];
+    // 遍历对象数据
+    for (const auto& object : objects) {
+        auto gid = object.value("gid", 0);
+        if (gid == 0) { // 如果 gid 为 0，则代表自己绘制的形状
+            // 非矩形对象会有额外标识（目前不考虑）
+            if (object.value("point", false)) {             // 如果是点对象
+                continue;       // TODO: 点对象的处理方式
+            } else if (object.value("ellipse", false)) {    // 如果是椭圆对象
+                continue;       // TODO: 椭圆对象的处理方式
+            } else if (object.value("polygon", false)) {    // 如果是多边形对象
+                continue;       // TODO: 多边形对象的处理方式
+            } 
+            // 没有这些标识则默认是矩形对象
+            else {  
+                ObjectData data;
+                data.name = object.value("name", "Unnamed");
+                // 获取Transform相关信息 （自定义形状的坐标针对左上角），缩放为设定为1.0f
+                data.position = glm::vec2(object.value("x", 0.0f), object.value("y", 0.0f));
+                data.rotation = object.value("rotation", 0.0f);
+
+                // 碰撞盒大小与dstSize相同 
+                data.hasCollider = true;
+                data.colliderSize = glm::vec2(object.value("width", 0.0f), object.value("height", 0.0f));
+                // 自定义形状通常是trigger类型，除非显示指定 （因此默认为真）
+                data.isTrigger = object.value("trigger", true);
+                // 物理组件，不受重力影响
+                data.hasPhysics = true;
+                data.useGravity = false;
+
+                // 获取标签信息
+                if (auto tag = getTileProperty<std::string>(object, "tag"); tag) {  // 如果有标签
+                    data.tag = tag.value();
+                }
+                layer.objects.push_back(std::move(data));
+            }
+        } else {
+            // 根据gid获取必要信息
+            const auto& tileInfo = getTileInfoByGid(gid);
+            if (tileInfo.sprite.getTextureID().empty()) {
+                spdlog::error("LEVELPARSER::parseObjectLayer::ERROR::gid 为 {} 的对象缺少纹理", gid);
+                continue;
+            }
+            auto srcSizeOpt = tileInfo.sprite.getSourceRect();
+            if (!srcSizeOpt) {
+                spdlog::error("LEVELPARSER::parseObjectLayer::ERROR::gid 为 {} 的对象缺少源尺寸", gid);
+                continue;
+            }
+            auto srcSize = glm::vec2(srcSizeOpt->w, srcSizeOpt->h);    // 成员变量除了 value().w 外，也可以这样获取
+            auto dstSize = glm::vec2(object.value("width", 0.0f), object.value("height", 0.0f));
+
+            ObjectData data;
+            data.name = object.value("name", "Unnamed");
+            data.position = glm::vec2(object.value("x", 0.0f), object.value("y", 0.0f));
+            data.position.y -= dstSize.y;   // Tiled 的坐标原点在左下角，而引擎的坐标原点在左上角，所以需要转换
+            data.rotation = object.value("rotation", 0.0f);
+            data.scale = dstSize / srcSize;
+            data.sprite = tileInfo.sprite;
+
+            // 获取瓦片json信息（查表，单一图片图块集中没有设置属性的瓦片返回空对象）
+            const auto& tileJson = getTileJsonByGid(gid);
+
+            // 获取碰信息：如果是SOLID类型，则添加物理组件，且图片源矩形区域就是碰撞盒大小
+            if (tileInfo.type == engine::component::TileType::SOLID) {
+                data.hasCollider = true;
+                data.colliderSize = srcSize;
+                // 物理组件不受重力影响
+                data.hasPhysics = true;
+                // 设置标签方便物理引擎检索
+                data.tag = "solid";
+            } else if (auto rect = getColliderRect(tileJson); rect) {  
+                // 如果非SOLID类型，检查自定义碰撞盒是否存在
+                // 如果有，添加碰撞组件
+                data.hasCollider = true;
+                data.colliderSize = rect->size;
+                data.colliderOffset = rect->position;   // 自定义碰撞盒的坐标是相对于图片坐标，也就是针对Transform的偏移量
+                // 和物理组件（默认不受重力影响）
+                data.hasPhysics = true;
+            }
+
+            // 获取标签信息
+            auto tag = getTileProperty<std::string>(tileJson, "tag");
+            if (tag) {
+                data.tag = tag.value();
+            } else if (tileInfo.type == engine::component::TileType::HAZARD) {
+                // 如果是危险瓦片，且没有手动设置标签，则自动设置标签为 "hazard"
+                data.tag = "hazard";
+            }
+
+            // 获取重力信息
+            auto gravity = getTileProperty<bool>(tileJson, "gravity");
+            if (gravity) {
+                if (!data.hasPhysics) {
+                    spdlog::warn("LEVELPARSER::parseObjectLayer::WARN::对象 '{}' 在设置重力信息时没有物理组件，请检查地图设置。", data.name);
+                    data.hasPhysics = true;
+                }
+                data.useGravity = gravity.value();
+            }
+
+            // 获取动画信息
+            auto animString = getTileProperty<std::string>(tileJson, "animation");
+            if (animString) {
+                // 解析string为JSON对象
+                nlohmann::json animJson;
+                try {
+                    animJson = nlohmann::json::parse(animString.value());
+                } catch (const nlohmann::json::parse_error& e) {
+                    spdlog::error("解析动画 JSON 字符串失败: {}", e.what());
+                    continue;  // 跳过此对象
+                }
+                parseAnimations(animJson, srcSize, data.animations);
+            }
+
+            // 获取生命值信息
+            data.health = getTileProperty<int>(tileJson, "health");
+
+            layer.objects.push_back(std::move(data));
+        }
+    }
+}
+
+void LevelParser::parseAnimations(const nlohmann::json &animJson, const glm::vec2 &spriteSize, std::vector<AnimationData>& animations) {
+    // 检查 animJson 必须是一个对象
+    if (!animJson.is_object()) {
+        spdlog::error("无效的动画 JSON。");
+        return;
+    }
+    // 遍历动画 JSON 对象中的每个键值对（动画名称 : 动画信息）
+    for (const auto& anim : animJson.items()) {
+        std::string_view animName = anim.key();
+        const auto& animInfo = anim.value();
+        if (!animInfo.is_object()) {
+            spdlog::warn("动画 '{}' 的信息无效或为空。", animName);
+            continue;
+        }
+        // 获取可能存在的动画帧信息
+        auto durationMS = animInfo.value("duration", 100);        // 默认持续时间为100毫秒
+        auto duration = static_cast<float>(durationMS) / 1000.0f;  // 转换为秒
+        auto row = animInfo.value("row", 0);                       // 默认行数为0
+        // 帧信息（数组）是必须存在的
+        if (!animInfo.contains("frames") || !animInfo["frames"].is_array()) {
+            spdlog::warn("动画 '{}' 缺少 'frames' 数组。", animName);
+            continue;
+        }
+        AnimationData animation;
+        animation.name = animName;
+
+        // 遍历数组并记录帧信息
+        for (const auto& frame : animInfo["frames"]) {
+            if (!frame.is_number_integer()) {
+                spdlog::warn("动画 {} 中 frames 数组格式错误！", animName);
+                continue;
+            }
+            auto column = frame.get<int>();
+            // 计算源矩形
+            SDL_FRect srcRect = { 
+                column * spriteSize.x, 
+                row * spriteSize.y, 
+                spriteSize.x, 
+                spriteSize.y 
+            };
+            animation.frames.push_back({srcRect, duration});
+        }
+        animations.push_back(std::move(animation));
+    }
+}
+
+std::optional<utils::Rect> LevelParser::getColliderRect(const nlohmann::json &tileJson) {
+    if (!tileJson.contains("objectgroup")) return std::nullopt;
+    auto& objectgroup = tileJson["objectgroup"];
+    if (!objectgroup.contains("objects")) return std::nullopt;
+    auto& objects = objectgroup["objects"];
+    for (const auto& object : objects) {    // 一个图片只支持一个碰撞器。如果有多个，则返回第一个不为空的
+        auto rect = utils::Rect(glm::vec2(object.value("x", 0.0f), object.value("y", 0.0f)), glm::vec2(object.value("width", 0.0f), object.value("height", 0.0f)));
+        if (rect.size.x > 0 && rect.size.y > 0) {
+            return rect;
+        }
+    }
+    return std::nullopt;    // 如果没找到碰撞器，则返回空
+}
+
+component::TileType LevelParser::getTileType(const nlohmann::json &tileJson) {
+    if (tileJson.contains("properties")) {
+        auto& properties = tileJson["properties"];
+        for (auto& property : properties) {
+            if (property.contains("name") && property["name"] == "solid") {
+                auto isSolid = property.value("value", false);
+                return isSolid ? engine::component::TileType::SOLID : engine::component::TileType::NORMAL;
+            } else if (property.contains("name") && property["name"] == "slope") {
+                auto slopeType = property.value("value", "");
+                if (slopeType == "0_1") {
+                    return engine::component::TileType::SLOPE_0_1;
+                } else if (slopeType == "1_0") {
+                    return engine::component::TileType::SLOPE_1_0;
+                } else if (slopeType == "0_2") {
+                    return engine::component::TileType::SLOPE_0_2;
+                } else if (slopeType == "2_0") {
+                    return engine::component::TileType::SLOPE_2_0;
+                } else if (slopeType == "2_1") {
+                    return engine::component::TileType::SLOPE_2_1;
+                } else if (slopeType == "1_2") {
+                    return engine::component::TileType::SLOPE_1_2;
+                } else {
+                    spdlog::error("LEVELPARSER::getTileType::ERROR::未知的斜坡类型: {}", slopeType);
+                    return engine::component::TileType::NORMAL;
+                }
+            } else if (property.contains("name") && property["name"] == "unisolid") {
+                auto isUnisolid = property.value("value", false);
+                return isUnisolid ? engine::component::TileType::UNISOLID : engine::component::TileType::NORMAL;
+            } else if (property.contains("name") && property["name"] == "hazard") {
+                auto isHazard = property.value("value", false);
+                return isHazard ? engine::component::TileType::HAZARD : engine::component::TileType::NORMAL;
+            } else if (property.contains("name") && property["name"] == "ladder") {
+                auto isLadder = property.value("value", false);
+                return isLadder ? engine::component::TileType::LADDER : engine::component::TileType::NORMAL;
+            }
+            // TODO: 可以在这里添加更多的自定义属性处理逻辑
+        }
+    }
+    return engine::component::TileType::NORMAL;
+}
+const engine::component::TileInfo& LevelParser::getTileInfoByGid(int gid) const {
+    static const engine::component::TileInfo EMPTY_TILE_INFO;
+    if (gid == 0) {
+        return EMPTY_TILE_INFO;
+    }
+    if (gid < 0 || gid >= static_cast<int>(m_gidTable.size()) || !m_gidTable[gid].isValid) {
+        spdlog::error("LEVELPARSER::getTileInfoByGid::ERROR::未找到gid为 {} 的瓦片。", gid);
+        return EMPTY_TILE_INFO;
+    }
+    return m_gidTable[gid].info;
+}
+
+const nlohmann::json& LevelParser::getTileJsonByGid(int gid) const {
+    static const nlohmann::json EMPTY_TILE_JSON = nlohmann::json::object();
+    if (gid <= 0 || gid >= static_cast<int>(m_gidTable.size()) || !m_gidTable[gid].tileJson) {
+        return EMPTY_TILE_JSON;
+    }
+    return *m_gidTable[gid].tileJson;
+}
+
+void LevelParser::loadTileset(std::string_view tilesetPath, int firstGid) {
+    auto path = std::filesystem::path(tilesetPath);
+    std::ifstream tilesetFile(path);
+    if (!tilesetFile.is_open()) {
+        spdlog::error("LEVELPARSER::loadTileset::ERROR::无法打开 Tileset 文件: {}", tilesetPath);
+        return;
+    }
+
+    nlohmann::json tsJson;
+    try {
+        tilesetFile >> tsJson;
+    } catch (const nlohmann::json::parse_error& e) {
+        spdlog::error("LEVELPARSER::loadTileset::ERROR::解析 Tileset JSON 文件 '{}' 失败: {} (at byte {})", tilesetPath, e.what(), e.byte);
+        return;
+    }
+    tsJson["file_path"] = tilesetPath;    // 将文件路径存储到json中，后续解析图片路径时需要
+    m_sourceFiles.emplace_back(tilesetPath);
+    m_tilesetData[firstGid] = std::move(tsJson);
+    buildGidTable(firstGid, m_tilesetData[firstGid]);
+    spdlog::info("LEVELPARSER::loadTileset::INFO::Tileset 文件 '{}' 加载完成, firstgid: {}", tilesetPath, firstGid);
+}
+
+void LevelParser::buildGidTable(int firstGid, const nlohmann::json &tileset) {
+    std::string filePath = tileset.value("file_path", "");       // 获取图块集文件路径
+    if (filePath.empty()) {
+        spdlog::error("LEVELPARSER::buildGidTable::ERROR::Tileset 文件 '{}' 缺少 'file_path' 属性。", firstGid);
+        return;
+    }
+    auto setEntry = [this](int gid, engine::component::TileInfo info, const nlohmann::json* tileJson) {
+        if (gid >= static_cast<int>(m_gidTable.size())) {
+            m_gidTable.resize(gid + 1);
+        }
+        m_gidTable[gid] = {std::move(info), tileJson, true};
+    };
+
+    // 先按局部ID为 tiles 数组建立索引（单一图片的图块集中，tiles 只包含设置了属性的瓦片）
+    std::unordered_map<int, const nlohmann::json*> tileJsonByID;
+    if (tileset.contains("tiles") && tileset["tiles"].is_array()) {
+        for (const auto& tileJson : tileset["tiles"]) {
+            tileJsonByID.emplace(tileJson.value("id", 0), &tileJson);
+        }
+    }
+
+    // 图块集分为两种情况，需要分别考虑
+    if (tileset.contains("image")) {    // 这是单一图片的情况
+        // 图片路径对所有瓦片都相同，只需解析一次
+        auto textureID = resolvePath(tileset["image"].get<std::string>(), filePath);
+        const int columns = tileset.value("columns", 0);
+        if (columns <= 0 || m_tileSize.x <= 0 || m_tileSize.y <= 0) {
+            spdlog::error("LEVELPARSER::buildGidTable::ERROR::Tileset 文件 '{}' 的 'columns' 或瓦片尺寸无效。", firstGid);
+            return;
+        }
+        const int tileCount = tileset.value("tilecount", columns * (tileset.value("imageheight", 0) / m_tileSize.y));
+        for (int localID = 0; localID < tileCount; ++localID) {
+            // 根据瓦片在图片网格中的坐标确定源矩形
+            SDL_FRect textureRect = {
+                static_cast<float>(localID % columns * m_tileSize.x),
+                static_cast<float>(localID / columns * m_tileSize.y),
+                static_cast<float>(m_tileSize.x),
+                static_cast<float>(m_tileSize.y)
+            };
+            auto it = tileJsonByID.find(localID);
+            const nlohmann::json* tileJson = it != tileJsonByID.end() ? it->second : nullptr;
+            auto tileType = tileJson ? getTileType(*tileJson) : engine::component::TileType::NORMAL;
+            setEntry(firstGid + localID, engine::component::TileInfo(engine::render::Sprite{textureID, textureRect}, tileType), tileJson);
+        }
+    } else {   // 这是多图片的情况
+        if (tileJsonByID.empty()) {   // 没有tiles字段的话不符合数据格式要求
+            spdlog::error("LEVELPARSER::buildGidTable::ERROR::Tileset 文件 '{}' 缺少 'tiles' 属性。", firstGid);
+            return;
+        }
+        for (const auto& [tileID, tileJson] : tileJsonByID) {
+            if (!tileJson->contains("image")) {   // 没有image字段的话不符合数据格式要求，跳过该瓦片
+                spdlog::error("LEVELPARSER::buildGidTable::ERROR::Tileset 文件 '{}' 中瓦片 {} 缺少 'image' 属性。", firstGid, tileID);
+                continue;
+            }
+            // 获取图片路径
+            auto textureID = resolvePath((*tileJson)["image"].get<std::string>(), filePath);
+            // 先确认图片尺寸
+            auto imageWidth = tileJson->value("imagewidth", 0);
+            auto imageHeight = tileJson->value("imageheight", 0);
+            // 从json中获取源矩形信息
+            SDL_FRect textureRect = {      // tiled中源矩形信息只有设置了才会有值，没有就是默认值
+                static_cast<float>(tileJson->value("x", 0)),
+                static_cast<float>(tileJson->value("y", 0)),
+                static_cast<float>(tileJson->value("width", imageWidth)),    // 如果未设置，则使用图片尺寸
+                static_cast<float>(tileJson->value("height", imageHeight))
+            };
+            setEntry(firstGid + tileID, engine::component::TileInfo(engine::render::Sprite{textureID, textureRect}, getTileType(*tileJson)), tileJson);
+        }
+    }
+}
+
+std::string LevelParser::resolvePath(std::string_view relativePath, std::string_view filePath) {
+    try {   
+        // 获取地图文件的父目录（相对于可执行文件） "assets/maps/level1.tmj" -> "assets/maps"
+        auto mapDir = std::filesystem::path(filePath).parent_path();
+        // 合并路径（相对于可执行文件）并返回。 
+        /* std::filesystem::canonical：解析路径中的当前目录（.）和上级目录（..）导航符，得到一个干净的路径 */
+        auto finalPath = std::filesystem::canonical(mapDir / relativePath);
+        // 再转换为相对于运行目录的路径，避免把本机的绝对路径写进预处理后的关卡文件
+        return std::filesystem::proximate(finalPath).generic_string();
+    } catch (const std::exception& e) {
+        spdlog::error("LEVELPARSER::resolvePath::ERROR::解析路径失败: {}", e.what());
+        return std::string(relativePath);
+    }
+}
+
+}
\ No newline at end of file
@@ -0,0 +1,137 @@
+#pragma once
+#include "LevelData.hpp"
+#include "../utils/Math.hpp"
+#include "../component/TilelayerComponent.hpp"
+
+#include <glm/vec2.hpp>
+#include <nlohmann/json.hpp>
+
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace engine::scene {
+
+/**
+ * @brief 解析 Tiled JSON 地图文件 (.tmj) 及其图块集 (.tsj)，生成 LevelData。
+ *
+ * 只依赖 JSON 与精灵数据，不创建任何游戏对象，因此既可用于游戏运行时加载关卡，
+ * 也可用于离线的关卡预处理工具 (LevelCooker)。
+ */
+class LevelParser final {
+    /// @brief gid 查找表中的一项（在加载图块集时一次性生成）
+    struct GidEntry {
+        engine::component::TileInfo info;               ///< @brief 已解析好的瓦片信息（纹理ID、源矩形、类型）
+        const nlohmann::json* tileJson = nullptr;       ///< @brief 瓦片json（指向 m_tilesetData 内部，没有则为空）
+        bool isValid = false;                           ///< @brief 该 gid 是否存在
+    };
+
+    std::string m_mapPath;      ///< @brief 地图路径（拼接路径时需要）
+    glm::ivec2  m_mapSize;       ///< @brief 地图尺寸(瓦片数量)
+    glm::ivec2  m_tileSize;      ///< @brief 瓦片尺寸(像素)
+    std::map<int, nlohmann::json> m_tilesetData;    ///< @brief firstgid -> 瓦片集数据
+    std::vector<GidEntry> m_gidTable;               ///< @brief gid -> 瓦片信息的稠密查找表 (下标即 gid)
+    std::vector<std::string> m_sourceFiles;         ///< @brief 已读取的源文件（地图及图块集）
+
+public:
+    LevelParser() = default;
+
+    /**
+     * @brief 解析地图文件。
+     * @param mapPath Tiled JSON 地图文件的路径。
+     * @param level 输出的关卡数据。
+     * @return bool 是否解析成功。
+     */
+    [[nodiscard]] bool parse(std::string_view mapPath, LevelData& level);
+
+private:
+    void parseImageLayer(const nlohmann::json& layerJson, LayerData& layer);                       ///< @brief 解析图片图层
+    void parseTileLayer(const nlohmann::json& layerJson, LayerData& layer);                        ///< @brief 解析瓦片图层
+    void parseObjectLayer(const nlohmann::json& layerJson, LayerData& layer);                      ///< @brief 解析对象图层
+
+    /**
+     * @brief 解析动画数据。
+     * @param animJson 动画json数据（自定义）
+     * @param spriteSize 每一帧动画的尺寸
+     * @param animations 解析出的动画追加到此数组
+     */
+    void parseAnimations(const nlohmann::json& animJson, const glm::vec2& spriteSize, std::vector<AnimationData>& animations);
+
+    /**
+     * @brief 获取瓦片属性
+     * @tparam T 属性类型
+     * @param tileJson 瓦片json数据
+     * @param propertyName 属性名称
+     * @return 属性值，如果属性不存在则返回 std::nullopt
+     */
+    template<typename T>
+    std::optional<T> getTileProperty(const nlohmann::json& tileJson, std::string_view propertyName) {
+        if (!tileJson.contains("properties")) return std::nullopt;
+        const auto& properties = tileJson["properties"];
+        for (const auto& property : properties) {
+            if (property.contains("name") && property["name"] == std::string(propertyName)) {
+                if (property.contains("value")) {
+                    return property["value"].get<T>();
+                }
+            }
+        }
+        return std::nullopt;
+    }
+
+    /**
+     * @brief 获取瓦片碰撞器矩形
+     * @param tileJson 瓦片json数据
+     * @return 碰撞器矩形，如果碰撞器不存在则返回 std::nullopt
+     */
+    std::optional<engine::utils::Rect> getColliderRect(const nlohmann::json& tileJson);
+
+    /**
+     * @brief 根据瓦片json对象获取瓦片类型
+     * @param tileJson 瓦片json数据
+     * @return 瓦片类型
+     */
+    engine::component::TileType getTileType(const nlohmann::json& tileJson);
+
+    /**
+     * @brief 根据全局 ID 获取瓦片信息（查表，O(1)）。
+     * @param gid 全局 ID。
+     * @return const engine::component::TileInfo& 瓦片信息，gid 为 0 或不存在时返回空的瓦片信息。
+     */
+    const engine::component::TileInfo& getTileInfoByGid(int gid) const;
+
+    /**
+     * @brief 根据全局 ID 获取瓦片json对象 (用于对象层获取瓦片信息，查表，O(1))
+     * @param gid 全局 ID
+     * @return const nlohmann::json& 瓦片json对象，不存在时返回空对象
+     */
+    const nlohmann::json& getTileJsonByGid(int gid) const;
+
+    /**
+     * @brief 为图块集中的所有瓦片生成 gid 查找表项（路径解析、类型解析都只在这里做一次）
+     * @param firstGid 图块集的第一个全局 ID
+     * @param tileset 图块集json数据（需已存入 m_tilesetData，查找表会保存指向其内部的指针）
+     */
+    void buildGidTable(int firstGid, const nlohmann::json& tileset);
+
+    /**
+     * @brief 加载 Tiled tileset 文件 (.tsj)。
+     * @param tilesetPath Tileset 文件路径。
+     * @param firstGid 此 tileset 的第一个全局 ID。
+     */
+    void loadTileset(std::string_view tilesetPath, int firstGid);
+
+    /**
+     * @brief 解析图片路径，合并地图路径和相对路径。例如：
+     * @brief - 文件路径："assets/maps/level1.tmj"
+     * @brief - 相对路径："../textures/Layers/back.png"
+     * @brief - 最终路径："assets/textures/Layers/back.png"
+     * @param relativePath 相对路径（相对于文件）
+     * @param filePath 文件路径
+     * @return std::string 解析后的路径（相对于运行目录，使用 '/' 分隔，预处理后的关卡文件因此可以随资源目录一起移动）。
+     */
+    std::string resolvePath(std::string_view relativePath, std::string_view filePath);
+};
+
+} // namespace engine::scene
@@ -0,0 +1,126 @@
+#include "LevelPreloader.hpp"
+#include "LevelLoader.hpp"
+#include "../resource/ResourceManager.hpp"
+
+#include <SDL3/SDL_surface.h>
+#include <SDL3_image/SDL_image.h>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <chrono>
+#include <unordered_set>
+
+namespace engine::scene {
+
+void LevelPreloader::SurfaceDeleter::operator()(SDL_Surface* surface) const {
+    SDL_DestroySurface(surface);
+}
+
+LevelPreloader::LevelPreloader(engine::resource::ResourceManager& resourceManager)
+    : m_resourceManager(resourceManager) {
+}
+
+LevelPreloader::~LevelPreloader() {
+    clear();
+}
+
+void LevelPreloader::preload(std::string_view mapPath) {
+    const bool isRunning = std::any_of(m_tasks.begin(), m_tasks.end(), [mapPath](const PreloadTask& task) {
+        return task.mapPath == mapPath;
+    });
+    if (isRunning) {
+        return;
+    }
+    spdlog::debug("LEVELPRELOADER::preload::DEBUG::开始后台预加载关卡: {}", mapPath);
+    m_tasks.push_back({std::string(mapPath), std::async(std::launch::async, &LevelPreloader::runPreload, std::string(mapPath))});
+}
+
+bool LevelPreloader::take(std::string_view mapPath, LevelData& level) {
+    auto it = std::find_if(m_tasks.begin(), m_tasks.end(), [mapPath](const PreloadTask& task) {
+        return task.mapPath == mapPath;
+    });
+    if (it == m_tasks.end()) {
+        return false;
+    }
+    auto future = std::move(it->future);
+    m_tasks.erase(it);
+    if (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+        spdlog::info("LEVELPRELOADER::take::INFO::关卡 {} 尚未预加载完成，等待后台线程...", mapPath);
+    }
+    auto result = future.get();
+    if (!result.isValid) {
+        spdlog::warn("LEVELPRELOADER::take::WARN::关卡 {} 预加载失败，改为同步加载", mapPath);
+        return false;
+    }
+    // 只有纹理上传需要在主线程完成
+    for (const auto& image : result.images) {
+        m_resourceManager.loadTextureFromSurface(image.textureID, image.surface.get());
+    }
+    level = std::move(result.level);
+    spdlog::debug("LEVELPRELOADER::take::DEBUG::取出预加载关卡: {} ({} 张图片)", mapPath, result.images.size());
+    return true;
+}
+
+void LevelPreloader::markStale() {
+    for (auto& task : m_tasks) {
+        task.isStale = true;
+    }
+}
+
+void LevelPreloader::discardStale() {
+    // 新场景的 init 已经执行完毕：它需要的预加载已被取走，它新发起的任务没有过期标记
+    for (auto it = m_tasks.begin(); it != m_tasks.end();) {
+        if (it->isStale) {
+            spdlog::debug("LEVELPRELOADER::discardStale::DEBUG::放弃未使用的预加载关卡: {}", it->mapPath);
+            m_discarded.push_back(std::move(it->future));
+            it = m_tasks.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void LevelPreloader::update() {
+    std::erase_if(m_discarded, [](const std::future<PreloadResult>& future) {
+        return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    });
+}
+
+void LevelPreloader::clear() {
+    m_tasks.clear();        // std::async 返回的 future 在析构时等待后台线程结束
+    m_discarded.clear();
+}
+
+LevelPreloader::PreloadResult LevelPreloader::runPreload(std::string mapPath) {
+    const auto startTime = std::chrono::steady_clock::now();
+    PreloadResult result;
+    if (!LevelLoader::loadLevelData(mapPath, result.level)) {
+        return result;
+    }
+    // 收集关卡用到的所有图片（去重）
+    std::unordered_set<std::string> textureIDs;
+    for (const auto& layer : result.level.layers) {
+        if (!layer.textureID.empty()) textureIDs.emplace(layer.textureID);
+        for (const auto& tileInfo : layer.palette) {
+            if (!tileInfo.sprite.getTextureID().empty()) textureIDs.emplace(tileInfo.sprite.getTextureID());
+        }
+        for (const auto& object : layer.objects) {
+            if (object.sprite) textureIDs.emplace(object.sprite->getTextureID());
+        }
+    }
+    // 解码图片（只生成 SDL_Surface，不涉及渲染器）
+    for (const auto& textureID : textureIDs) {
+        std::unique_ptr<SDL_Surface, SurfaceDeleter> surface(IMG_Load(textureID.c_str()));
+        if (!surface) {
+            spdlog::warn("LEVELPRELOADER::runPreload::WARN::解码图片失败: {} : {}", textureID, SDL_GetError());
+            continue;   // 进入关卡时会再按常规方式加载（并输出错误）
+        }
+        result.images.push_back({textureID, std::move(surface)});
+    }
+    result.isValid = true;
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - startTime;
+    spdlog::info("LEVELPRELOADER::runPreload::INFO::关卡 {} 预加载完成 ({} 张图片, 耗时 {:.2f} ms)", mapPath, result.images.size(), elapsed.count());
+    return result;
+}
+
+} // namespace engine::scene
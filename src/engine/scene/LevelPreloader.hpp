@@ -0,0 +1,97 @@
+#pragma once
+#include "LevelData.hpp"
+
+#include <future>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct SDL_Surface;
+
+namespace engine::resource {
+class ResourceManager;
+}
+
+namespace engine::scene {
+
+/**
+ * @brief 在后台线程预加载关卡
+ *
+ * 后台线程完成所有与渲染器无关的工作：读取关卡数据（预处理文件或 JSON 解析）、解码关卡用到的图片；
+ * 主线程在真正进入关卡时 (take) 只需把解码好的图片上传为纹理，再由 LevelLoader 创建游戏对象。
+ *
+ * 由 SceneManager 持有，场景通过 SceneManager::requestPreloadLevel 发起预加载。
+ */
+class LevelPreloader final {
+    /// @brief SDL_Surface 删除器
+    struct SurfaceDeleter {
+        void operator()(SDL_Surface* surface) const;
+    };
+    /// @brief 后台线程解码好的图片
+    struct DecodedImage {
+        std::string textureID;                                  ///< @brief 纹理ID（图片路径）
+        std::unique_ptr<SDL_Surface, SurfaceDeleter> surface;   ///< @brief 解码结果
+    };
+    /// @brief 后台线程的产出
+    struct PreloadResult {
+        LevelData level;                        ///< @brief 关卡数据
+        std::vector<DecodedImage> images;       ///< @brief 关卡用到的图片
+        bool isValid = false;                   ///< @brief 关卡数据是否读取成功
+    };
+    /// @brief 一个预加载任务
+    struct PreloadTask {
+        std::string mapPath;                        ///< @brief 地图文件路径
+        std::future<PreloadResult> future;          ///< @brief 后台任务
+        bool isStale = false;                       ///< @brief 发起任务的场景已被替换
+    };
+
+    engine::resource::ResourceManager& m_resourceManager;  ///< @brief 上传纹理使用的资源管理器
+    std::vector<PreloadTask> m_tasks;                       ///< @brief 进行中或已完成、尚未被取用的任务
+    std::vector<std::future<PreloadResult>> m_discarded;    ///< @brief 已放弃但后台线程仍在运行的任务（完成后再销毁，避免主线程阻塞）
+
+public:
+    explicit LevelPreloader(engine::resource::ResourceManager& resourceManager);
+    ~LevelPreloader();
+
+    /// @name 禁止拷贝和移动
+    /// @{
+    LevelPreloader(const LevelPreloader&) = delete;
+    LevelPreloader& operator=(const LevelPreloader&) = delete;
+    LevelPreloader(LevelPreloader&&) = delete;
+    LevelPreloader& operator=(LevelPreloader&&) = delete;
+    /// @}
+
+    /**
+     * @brief 开始在后台预加载关卡（同一地图已在预加载时忽略）
+     * @param mapPath 地图文件路径
+     */
+    void preload(std::string_view mapPath);
+
+    /**
+     * @brief 取出预加载好的关卡：上传解码好的图片为纹理，并移出关卡数据（只能在主线程调用）
+     * @param mapPath 地图文件路径
+     * @param level 输出的关卡数据
+     * @return bool 是否取到（没有对应的预加载任务或预加载失败时返回 false，调用者应同步加载）
+     * @note 后台任务尚未完成时会等待其完成
+     */
+    [[nodiscard]] bool take(std::string_view mapPath, LevelData& level);
+
+    /// @brief 即将替换场景：把现有任务标记为过期（新场景初始化时仍可取用）
+    void markStale();
+
+    /// @brief 新场景初始化完毕：放弃仍未被取用的过期任务
+    void discardStale();
+
+    /// @brief 每帧调用，销毁已完成的被放弃任务
+    void update();
+
+    /// @brief 等待并放弃所有任务
+    void clear();
+
+private:
+    /// @brief 后台线程执行的预加载
+    static PreloadResult runPreload(std::string mapPath);
+};
+
+} // namespace engine::scene
@@ -1,19 +1,29 @@
 #include "Scene.hpp"
+#include "SceneManager.hpp"
 #include "../object/GameObject.hpp"
 #include "../core/Context.hpp"
 #include "../core/GameState.hpp"
+#include "../core/Time.hpp"
+#include "../component/TransformComponent.hpp"
 #include "../render/Camera.hpp"
+#include "../render/Renderer.hpp"
 #include "../physics/PhysicsEngine.hpp"
 #include "../UI/UIManager.hpp"
+#include "../utils/Profiler.hpp"
 
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
+#include <chrono>
 
 namespace engine::scene {
 
 Scene::Scene(std::string_view name, engine::core::Context &context, engine::scene::SceneManager &sceneManager)
-    : m_sceneName(name), m_context(context), m_sceneManager(sceneManager), m_isInitialized(false), m_UIManager(std::make_unique<engine::ui::UIManager>()) {
+    : m_arena(sceneManager.isSceneArenaEnabled()), m_sceneName(name), m_context(context), m_sceneManager(sceneManager), m_isInitialized(false) {
+    // 新场景通常在旧场景的 update / handleInput 中创建（requestReplaceScene），此时生效的是旧场景的内存区。
+    // UI 根面板必须分配在本场景的内存区，否则替换场景销毁旧内存区后它就成了悬空指针
+    engine::utils::ArenaScope scope(&m_arena);
+    m_UIManager = std::make_unique<engine::ui::UIManager>();
     spdlog::trace("SCENE::\"{}\"场景构造完成", m_sceneName);
 }
 
@@ -29,29 +39,33 @@ void Scene::init() {
 void Scene::update(float deltaTime) {
     if (!m_isInitialized) return;
 
+    // 记录本次逻辑更新前的位置，用于渲染插值
+    const auto tick = m_context.getTime().getTickCount();
+    engine::object::forEachWith<engine::component::TransformComponent>(m_gameObjects,
+        [tick](engine::object::GameObject&, engine::component::TransformComponent& transform) {
+            transform.storePreviousPosition(tick);
+        });
+
     // 只有游戏进行中，才需要更新物理引擎和相机
     if (m_context.getGameState().isPlaying()) {
+        m_context.getCamera().storePreviousPosition(tick);
         m_context.getPhysicsEngine().update(deltaTime);
         m_context.getCamera().update(deltaTime);
     }
 
-    for (auto it = m_gameObjects.begin(); it != m_gameObjects.end();) {
-        if (*it && !(*it)->isNeedRemove()) {
-            (*it)->update(deltaTime, m_context);
-            ++it;
-        } else {
-            if (*it) (*it)->clean();
-            it = m_gameObjects.erase(it);
-        }
-    }
+    updateComponents(deltaTime);
+    removeFlaggedGameObjects();
     m_UIManager->update(deltaTime, m_context);
     processPendingAdditions();
 }
 void Scene::render() {
     if (!m_isInitialized) return;
+    auto& renderer = m_context.getRenderer();
     for (auto &gameObject : m_gameObjects) {
+        renderer.setSortLayer(gameObject->getSortLayer());
         gameObject->render(m_context);
     }
+    renderer.flush();   // 游戏对象的精灵需在 UI 之前绘制完成
     m_UIManager->render(m_context);
 }
 
@@ -73,11 +87,18 @@ void Scene::handleInput() {
 
 void Scene::clean() {
     if (!m_isInitialized) return;
+    const auto start = std::chrono::steady_clock::now();
+    const size_t allocationCount = m_arena.getAllocationCount();
+    const size_t peakBytes = m_arena.getPeakBytes();
     for (auto &gameObject : m_gameObjects) {
         gameObject->clean();
     }
     m_gameObjects.clear();
+    m_pendingAdditions.clear();
     m_isInitialized = false;
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    spdlog::debug("SCENE::clean::\"{}\"场景清理用时 {:.3f} ms, 场景内存{}: 共分配 {} 次, 峰值 {:.1f} KB",
+        m_sceneName, elapsed.count(), m_arena.isPooled() ? "" : " (未启用内存池)", allocationCount, peakBytes / 1024.0);
     spdlog::trace("SCENE::clean::\"{}\"场景清理完成", m_sceneName);
 }
 /// @}
@@ -123,6 +144,31 @@ engine::object::GameObject *Scene::findGameObjectByName(std::string_view name) c
 /// @}
 
 
+void Scene::updateComponents(float deltaTime) {
+    SL_PROFILE_ZONE("Scene::updateComponents");
+    // 按组件类型批量更新：外层循环组件编号，同一类型的组件连续执行（同一段代码、同一个对象池），
+    // 而不是逐个对象轮流调用各类组件。编号顺序即更新顺序：引擎组件在前，游戏逻辑组件在后。
+    for (engine::component::ComponentId id = 0; id < engine::component::MAX_COMPONENTS; ++id) {
+        for (auto& gameObject : m_gameObjects) {
+            // 本帧中途被标记删除的对象不再更新后续类型的组件
+            if (gameObject && !gameObject->isNeedRemove()) {
+                gameObject->updateComponent(id, deltaTime, m_context);
+            }
+        }
+    }
+}
+
+void Scene::removeFlaggedGameObjects() {
+    for (auto it = m_gameObjects.begin(); it != m_gameObjects.end();) {
+        if (*it && !(*it)->isNeedRemove()) {
+            ++it;
+        } else {
+            if (*it) (*it)->clean();
+            it = m_gameObjects.erase(it);
+        }
+    }
+}
+
 void Scene::processPendingAdditions() {
     for (auto &gemeObject : m_pendingAdditions) {
         m_gameObjects.push_back(std::move(gemeObject));
@@ -1,4 +1,6 @@
 #pragma once
+#include "../utils/MemoryArena.hpp"
+
 #include <vector>
 #include <memory>
 #include <string>
@@ -27,6 +29,7 @@ namespace engine::scene {
  */
 class Scene {
 protected:
+    engine::utils::MemoryArena m_arena;                 ///< @brief 场景内存区（最先声明、最后销毁：场景的对象与 UI 元素都在它之前释放）
     std::string m_sceneName;                            ///< @brief 场景名称
     engine::core::Context& m_context;                    ///< @brief 上下文引用（隐式，构造时传入）
     engine::scene::SceneManager& m_sceneManager;        ///< @brief 场景管理器引用（构造时传入）
@@ -43,6 +46,8 @@ public:
      * @param name 场景的名称。
      * @param context 场景上下文。
      * @param scene_manager 场景管理器。
+     * @note 新场景常在旧场景的回调中构造（此时生效的是旧场景的内存区）：基类会在本场景的内存区中创建 UI 管理器，
+     *       派生类的构造函数不要创建游戏对象、UI 元素等 ArenaAllocated 对象，应放到 init 中（init 在本场景的内存区中执行）。
      */
     Scene(std::string_view name, engine::core::Context& context, engine::scene::SceneManager& scene_manager);
 
@@ -89,10 +94,13 @@ public:
 
     engine::core::Context& getContext() const { return m_context; }                  ///< @brief 获取上下文引用
     engine::scene::SceneManager& getSceneManager() const { return m_sceneManager; } ///< @brief 获取场景管理器引用
+    engine::utils::MemoryArena& getArena() { return m_arena; }                     ///< @brief 获取场景内存区
     std::vector<std::unique_ptr<engine::object::GameObject>>& getGameObjects() { return m_gameObjects; } ///< @brief 获取场景中的游戏对象
 
 protected:
     void processPendingAdditions();     ///< @brief 处理待添加的游戏对象。（每轮更新的最后调用）
+    void updateComponents(float deltaTime);     ///< @brief 按组件类型批量更新所有游戏对象的组件
+    void removeFlaggedGameObjects();    ///< @brief 清理并移除标记为删除的游戏对象
 };
 
 } // namespace engine::scene
\ No newline at end of file
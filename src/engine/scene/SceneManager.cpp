@@ -1,11 +1,17 @@
 #include "SceneManager.hpp"
 #include "Scene.hpp"
+#include "LevelPreloader.hpp"
 #include "../core/Context.hpp"
+#include "../utils/MemoryArena.hpp"
+#include "../utils/Profiler.hpp"
+
+#include <chrono>
 
 #include <spdlog/spdlog.h>
 
 namespace engine::scene {
-SceneManager::SceneManager(engine::core::Context &context) : m_context(context) {
+SceneManager::SceneManager(engine::core::Context &context)
+    : m_context(context), m_levelPreloader(std::make_unique<LevelPreloader>(context.getResourceManager())) {
     spdlog::trace("SCENEMANAGER::场景管理器已创建");
 }
 
@@ -27,15 +33,19 @@ engine::core::Context &SceneManager::getContext() const {
 }
 
 void SceneManager::update(float deltaTime) {
+    SL_PROFILE_ZONE("SceneManager::update");
     // 只更新当前场景
     Scene *currentScene = getCurrentScene();
     if (currentScene) {
+        engine::utils::ArenaScope scope(&currentScene->getArena());   // 场景运行中创建的对象分配到场景内存区
         currentScene->update(deltaTime);
     }
     processPendingActions(); // 处理挂起的操作
+    m_levelPreloader->update();
 }
 
 void SceneManager::render() {
+    SL_PROFILE_ZONE("SceneManager::render");
     // 渲染时需要渲染所有场景，而不是只渲染当前场景
     for (auto &scene : m_sceneStack) {
         scene->render();
@@ -43,14 +53,17 @@ void SceneManager::render() {
 }
 
 void SceneManager::handleInput() {
+    SL_PROFILE_ZONE("SceneManager::handleInput");
     Scene *currentScene = getCurrentScene();
     if (currentScene) {
+        engine::utils::ArenaScope scope(&currentScene->getArena());
         currentScene->handleInput();
     }
 }
 
 void SceneManager::close() {
     spdlog::trace("SCENEMANAGER::close::TRACE::关闭场景管理器并清理所有场景");
+    m_levelPreloader->clear();  // 等待后台预加载结束
     // 清理并移除所有场景 (从栈顶到栈底)
     while (!m_sceneStack.empty()) {
         if (m_sceneStack.back()) {
@@ -89,9 +102,7 @@ void SceneManager::pushScene(std::unique_ptr<Scene> &&scene) {
     }
     spdlog::debug("SCENEMANAGER::pushScene::DEBUG::压入场景: {}", scene->getName());
     // 确保场景初始化
-    if (!scene->isInitialized()) {
-        scene->init();
-    }
+    initScene(*scene);
     // 压入场景至栈
     m_sceneStack.push_back(std::move(scene));
 }
@@ -114,6 +125,7 @@ void SceneManager::replaceScene(std::unique_ptr<Scene> &&scene) {
         return;
     }
     spdlog::debug("SCENEMANAGER::replaceScene::DEBUG::替换场景: {}", scene->getName());
+    m_levelPreloader->markStale();
     // 清理并移除所有场景
     while (!m_sceneStack.empty()) {
         if (m_sceneStack.back()) {
@@ -122,11 +134,24 @@ void SceneManager::replaceScene(std::unique_ptr<Scene> &&scene) {
         m_sceneStack.pop_back();
     }
     // 确保场景初始化
-    if (!scene->isInitialized()) {
-        scene->init();
-    }
+    initScene(*scene);
     // 压入新场景
     m_sceneStack.push_back(std::move(scene));
+    // 放弃旧场景发起、新场景没有用到的预加载
+    m_levelPreloader->discardStale();
+}
+
+void SceneManager::initScene(Scene &scene) {
+    if (scene.isInitialized()) return;
+    auto& arena = scene.getArena();
+    const auto start = std::chrono::steady_clock::now();
+    {
+        engine::utils::ArenaScope scope(&arena);
+        scene.init();
+    }
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    spdlog::debug("SCENEMANAGER::initScene::场景 {} 初始化用时 {:.3f} ms, 场景内存{}: 分配 {} 次, {:.1f} KB",
+        scene.getName(), elapsed.count(), arena.isPooled() ? "" : " (未启用内存池)", arena.getAllocationCount(), arena.getBytesInUse() / 1024.0);
 }
 
 void SceneManager::requestPushScene(std::unique_ptr<Scene> &&scene) {
@@ -143,4 +168,12 @@ void SceneManager::requestReplaceScene(std::unique_ptr<Scene> &&scene) {
     m_pendingScene = std::move(scene);
 }
 
+void SceneManager::requestPreloadLevel(std::string_view mapPath) {
+    m_levelPreloader->preload(mapPath);
+}
+
+bool SceneManager::takePreloadedLevel(std::string_view mapPath, LevelData &level) {
+    return m_levelPreloader->take(mapPath, level);
+}
+
 } // namespace engine::scene
\ No newline at end of file
@@ -6,6 +6,7 @@
 #pragma once
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 
 // 前置声明
@@ -14,6 +15,8 @@ namespace engine::core {
 }
 namespace engine::scene {
     class Scene;
+    class LevelPreloader;
+    struct LevelData;
 }
 
 namespace engine::scene {
@@ -45,6 +48,9 @@ private:
     PendingAction m_pendingAction;                          ///< 当前待处理的场景操作类型
     std::unique_ptr<Scene> m_pendingScene;                  ///< 待处理的新场景（用于Push和Replace操作）
 
+    std::unique_ptr<LevelPreloader> m_levelPreloader;       ///< 关卡后台预加载器
+    bool m_isSceneArenaEnabled = true;                      ///< 新场景是否使用场景内存池（关闭时直接使用全局堆，便于对比）
+
 public:
     explicit SceneManager(engine::core::Context& context);
     ~SceneManager();
@@ -88,6 +94,29 @@ public:
     /// @}
 
 
+    /// @name 关卡预加载
+    /// @{
+    /**
+     * @brief 请求在后台预加载关卡
+     * @param mapPath 地图文件路径
+     * 
+     * 在后台线程读取关卡数据并解码图片，当前场景继续运行。
+     * 之后加载该关卡的场景 (LevelLoader) 只需在主线程上传纹理、创建游戏对象。
+     * 当前场景被替换后，它发起的、未被新场景使用的预加载会被放弃。
+     */
+    void requestPreloadLevel(std::string_view mapPath);
+    /**
+     * @brief 取出预加载好的关卡数据（由 LevelLoader 调用）
+     * @param mapPath 地图文件路径
+     * @param level 输出的关卡数据
+     * @return 是否取到，没有预加载或预加载失败时返回 false
+     * 
+     * 预加载尚未完成时会等待其完成；关卡用到的纹理在返回前上传完毕。
+     */
+    bool takePreloadedLevel(std::string_view mapPath, LevelData& level);
+    /// @}
+
+
     /// @name getter
     /// @{
     /**
@@ -100,6 +129,8 @@ public:
      * @return 引擎上下文引用
      */
     engine::core::Context& getContext() const;
+    bool isSceneArenaEnabled() const { return m_isSceneArenaEnabled; }              ///< 新场景是否使用场景内存池
+    void setSceneArenaEnabled(bool isEnabled) { m_isSceneArenaEnabled = isEnabled; } ///< 设置新场景是否使用场景内存池（只影响之后创建的场景）
     /// @}
 
 
@@ -164,6 +195,11 @@ private:
      * @note 此方法直接操作场景栈，可能导致不安全的状态，应仅在 processPendingActions 中使用。
      */
     void replaceScene(std::unique_ptr<Scene>&& scene);
+    /**
+     * @brief 在场景的内存区中初始化场景（已初始化则跳过），并输出加载用时与内存分配统计
+     * @param scene 要初始化的场景
+     */
+    void initScene(Scene& scene);
 };
 
 } // namespace engine::scene
@@ -0,0 +1,109 @@
+#include "MappedFile.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <string>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace engine::utils {
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+#ifdef _WIN32
+
+bool MappedFile::open(std::string_view path) {
+    close();
+    const std::string pathString(path);
+    HANDLE file = CreateFileA(pathString.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;   // 文件不存在属于正常情况（例如关卡尚未预处理），由调用者决定是否输出日志
+    }
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0) {
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping) {
+        spdlog::error("MAPPEDFILE::open::ERROR::创建文件映射失败: {} (错误码 {})", path, GetLastError());
+        CloseHandle(file);
+        return false;
+    }
+    const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        spdlog::error("MAPPEDFILE::open::ERROR::映射文件失败: {} (错误码 {})", path, GetLastError());
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+    m_fileHandle = file;
+    m_mappingHandle = mapping;
+    m_data = static_cast<const std::byte*>(view);
+    m_size = static_cast<size_t>(fileSize.QuadPart);
+    return true;
+}
+
+void MappedFile::close() {
+    if (m_data) UnmapViewOfFile(m_data);
+    if (m_mappingHandle) CloseHandle(static_cast<HANDLE>(m_mappingHandle));
+    if (m_fileHandle) CloseHandle(static_cast<HANDLE>(m_fileHandle));
+    m_data = nullptr;
+    m_size = 0;
+    m_mappingHandle = nullptr;
+    m_fileHandle = nullptr;
+}
+
+#else
+
+bool MappedFile::open(std::string_view path) {
+    close();
+    const std::string pathString(path);
+    const int fd = ::open(pathString.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;   // 文件不存在属于正常情况（例如关卡尚未预处理），由调用者决定是否输出日志
+    }
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0) {
+        ::close(fd);
+        return false;
+    }
+    void* view = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    if (view == MAP_FAILED) {
+        spdlog::error("MAPPEDFILE::open::ERROR::映射文件失败: {}", path);
+        ::close(fd);
+        return false;
+    }
+    m_fd = fd;
+    m_data = static_cast<const std::byte*>(view);
+    m_size = static_cast<size_t>(fileStat.st_size);
+    return true;
+}
+
+void MappedFile::close() {
+    if (m_data) munmap(const_cast<std::byte*>(m_data), m_size);
+    if (m_fd >= 0) ::close(m_fd);
+    m_data = nullptr;
+    m_size = 0;
+    m_fd = -1;
+}
+
+#endif
+
+} // namespace engine::utils
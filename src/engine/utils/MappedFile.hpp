@@ -0,0 +1,52 @@
+#pragma once
+#include <cstddef>
+#include <span>
+#include <string_view>
+
+namespace engine::utils {
+
+/**
+ * @brief 只读内存映射文件
+ *
+ * 把整个文件映射到进程地址空间，由操作系统按需分页读入，读取时不需要额外的缓冲区与拷贝。
+ * 映射在对象析构或调用 close() 时解除，之后通过 getData() 得到的指针全部失效。
+ */
+class MappedFile final {
+private:
+    const std::byte* m_data = nullptr;  ///< @brief 映射的起始地址
+    size_t m_size = 0;                  ///< @brief 文件大小（字节）
+#ifdef _WIN32
+    void* m_fileHandle = nullptr;       ///< @brief 文件句柄 (HANDLE)
+    void* m_mappingHandle = nullptr;    ///< @brief 文件映射对象句柄 (HANDLE)
+#else
+    int m_fd = -1;                      ///< @brief 文件描述符
+#endif
+
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    /// @name 禁止拷贝和移动
+    /// @{
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&&) = delete;
+    MappedFile& operator=(MappedFile&&) = delete;
+    /// @}
+
+    /**
+     * @brief 以只读方式映射文件（已打开的文件会先被关闭）
+     * @param path 文件路径
+     * @return bool 是否成功（文件不存在或为空时返回 false）
+     */
+    [[nodiscard]] bool open(std::string_view path);
+
+    void close();                                                           ///< @brief 解除映射并关闭文件
+
+    bool isOpen() const { return m_data != nullptr; }                       ///< @brief 是否已映射
+    const std::byte* getData() const { return m_data; }                     ///< @brief 获取映射的起始地址
+    size_t getSize() const { return m_size; }                               ///< @brief 获取文件大小（字节）
+    std::span<const std::byte> getBytes() const { return {m_data, m_size}; } ///< @brief 获取整个文件的只读视图
+};
+
+} // namespace engine::utils
@@ -0,0 +1,74 @@
+#include "MemoryArena.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+
+namespace engine::utils {
+
+namespace {
+thread_local std::pmr::memory_resource* t_currentResource = nullptr;   ///< @brief 当前线程的 ArenaScope 内存资源
+
+/// @brief ArenaAllocated 每块内存前的头部大小（保持 max_align_t 对齐）
+constexpr size_t HEADER_SIZE = alignof(std::max_align_t);
+static_assert(HEADER_SIZE >= sizeof(std::pmr::memory_resource*));
+} // namespace
+
+MemoryArena::MemoryArena(bool isPooled)
+    : m_buffer(INITIAL_BUFFER_SIZE), m_pool(&m_buffer), m_isPooled(isPooled) {
+}
+
+MemoryArena::~MemoryArena() {
+    if (m_liveCount > 0) {
+        spdlog::warn("MEMORYARENA::~MemoryArena::仍有 {} 个分配 ({} 字节) 未释放", m_liveCount, m_bytesInUse);
+    }
+    // m_pool 与 m_buffer 析构时一次性归还所有内存
+}
+
+void* MemoryArena::do_allocate(size_t bytes, size_t alignment) {
+    void* ptr = m_isPooled ? m_pool.allocate(bytes, alignment)
+                           : std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    ++m_allocationCount;
+    ++m_liveCount;
+    m_bytesInUse += bytes;
+    m_peakBytes = std::max(m_peakBytes, m_bytesInUse);
+    return ptr;
+}
+
+void MemoryArena::do_deallocate(void* ptr, size_t bytes, size_t alignment) {
+    if (m_isPooled) {
+        m_pool.deallocate(ptr, bytes, alignment);
+    } else {
+        std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+    }
+    --m_liveCount;
+    m_bytesInUse -= bytes;
+}
+
+ArenaScope::ArenaScope(std::pmr::memory_resource* resource) : m_previous(t_currentResource) {
+    t_currentResource = resource;
+}
+
+ArenaScope::~ArenaScope() {
+    t_currentResource = m_previous;
+}
+
+std::pmr::memory_resource* ArenaScope::getCurrent() {
+    return t_currentResource;
+}
+
+void* ArenaAllocated::operator new(size_t size) {
+    auto* resource = t_currentResource ? t_currentResource : std::pmr::new_delete_resource();
+    auto* block = static_cast<std::byte*>(resource->allocate(size + HEADER_SIZE, alignof(std::max_align_t)));
+    *reinterpret_cast<std::pmr::memory_resource**>(block) = resource;
+    return block + HEADER_SIZE;
+}
+
+void ArenaAllocated::operator delete(void* ptr, size_t size) noexcept {
+    if (!ptr) return;
+    auto* block = static_cast<std::byte*>(ptr) - HEADER_SIZE;
+    auto* resource = *reinterpret_cast<std::pmr::memory_resource**>(block);
+    resource->deallocate(block, size + HEADER_SIZE, alignof(std::max_align_t));
+}
+
+} // namespace engine::utils
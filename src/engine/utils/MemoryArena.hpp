@@ -0,0 +1,88 @@
+#pragma once
+#include <cstddef>
+#include <memory_resource>
+
+namespace engine::utils {
+
+/**
+ * @brief 场景级内存区：场景中的游戏对象、UI 元素、动画、碰撞器从这里分配，场景销毁时整体归还。
+ *
+ * 内部是 “池 (unsynchronized_pool_resource) + 单调缓冲 (monotonic_buffer_resource)”：
+ * 释放的内存块回到池中供同一场景复用，向系统申请的大块内存直到 MemoryArena 析构才一次性释放。
+ * 禁用池时（isPooled 为 false）每次分配直接转发给全局堆，只保留统计，用于对比。
+ *
+ * @note 只在主线程使用，不加锁。
+ */
+class MemoryArena final : public std::pmr::memory_resource {
+private:
+    static constexpr size_t INITIAL_BUFFER_SIZE = 64 * 1024;   ///< @brief 单调缓冲首次向系统申请的大小
+
+    std::pmr::monotonic_buffer_resource m_buffer;       ///< @brief 向系统申请大块内存（只增不减）
+    std::pmr::unsynchronized_pool_resource m_pool;      ///< @brief 按大小分级复用释放的内存块
+    bool m_isPooled = true;                             ///< @brief 是否使用池（false 时直接使用全局堆）
+
+    size_t m_allocationCount = 0;                       ///< @brief 累计分配次数
+    size_t m_liveCount = 0;                             ///< @brief 尚未释放的分配数
+    size_t m_bytesInUse = 0;                            ///< @brief 尚未释放的字节数
+    size_t m_peakBytes = 0;                             ///< @brief 使用字节数的峰值
+
+public:
+    explicit MemoryArena(bool isPooled = true);
+    ~MemoryArena() override;
+
+    /// @name 禁止拷贝和移动
+    /// @{
+    MemoryArena(const MemoryArena&) = delete;
+    MemoryArena& operator=(const MemoryArena&) = delete;
+    MemoryArena(MemoryArena&&) = delete;
+    MemoryArena& operator=(MemoryArena&&) = delete;
+    /// @}
+
+    bool isPooled() const { return m_isPooled; }                    ///< @brief 是否使用池
+    size_t getAllocationCount() const { return m_allocationCount; } ///< @brief 累计分配次数
+    size_t getLiveCount() const { return m_liveCount; }             ///< @brief 尚未释放的分配数
+    size_t getBytesInUse() const { return m_bytesInUse; }           ///< @brief 尚未释放的字节数
+    size_t getPeakBytes() const { return m_peakBytes; }             ///< @brief 使用字节数的峰值
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* ptr, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+/**
+ * @brief 在作用域内把 ArenaAllocated 类型的分配重定向到指定的内存资源（作用域结束时恢复）
+ * @note 由 SceneManager 在调用场景的 init / update / handleInput 时设置；传入 nullptr 表示使用全局堆。
+ */
+class ArenaScope final {
+private:
+    std::pmr::memory_resource* m_previous = nullptr;   ///< @brief 进入作用域前的内存资源
+
+public:
+    explicit ArenaScope(std::pmr::memory_resource* resource);
+    ~ArenaScope();
+
+    /// @name 禁止拷贝和移动
+    /// @{
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+    ArenaScope(ArenaScope&&) = delete;
+    ArenaScope& operator=(ArenaScope&&) = delete;
+    /// @}
+
+    static std::pmr::memory_resource* getCurrent();    ///< @brief 当前线程正在使用的内存资源（nullptr 表示全局堆）
+};
+
+/**
+ * @brief 继承此类的类型用 new 创建时，从当前 ArenaScope 指定的内存资源分配。
+ *
+ * 每块内存前记录来源的内存资源，因此 delete 时无论处在哪个作用域都能归还到正确的地方。
+ * 对象必须在其内存资源销毁前释放（场景的对象由场景持有，满足这一点）。
+ */
+class ArenaAllocated {
+public:
+    static void* operator new(size_t size);
+    static void operator delete(void* ptr, size_t size) noexcept;
+};
+
+} // namespace engine::utils
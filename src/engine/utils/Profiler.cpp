@@ -0,0 +1,199 @@
+#include "Profiler.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+
+namespace engine::utils {
+
+namespace {
+/// @brief 输出 JSON 字符串（转义引号、反斜杠和控制字符）
+void writeJsonString(std::ofstream& out, std::string_view text) {
+    out << '"';
+    for (const char c : text) {
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            out << ' ';
+        } else {
+            out << c;
+        }
+    }
+    out << '"';
+}
+} // namespace
+
+thread_local Profiler::ThreadBuffer* Profiler::s_threadBuffer = nullptr;
+
+Profiler& Profiler::get() {
+    static Profiler profiler;
+    return profiler;
+}
+
+std::uint64_t Profiler::now() {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void Profiler::record(const char* name, std::uint64_t startNs, std::uint64_t endNs) {
+    auto& buffer = getThreadBuffer();
+    // 只有本线程写入：先写记录，再发布写入位置，主线程读到位置后即可看到完整的记录
+    const auto index = buffer.writeIndex.load(std::memory_order_relaxed);
+    buffer.events[index & (RING_CAPACITY - 1)] = {name, startNs, endNs};
+    buffer.writeIndex.store(index + 1, std::memory_order_release);
+}
+
+void Profiler::setThreadName(std::string_view name) {
+    auto& buffer = getThreadBuffer();
+    std::lock_guard lock(m_mutex);
+    buffer.threadName = name;
+}
+
+Profiler::ThreadBuffer& Profiler::getThreadBuffer() {
+    if (s_threadBuffer) {
+        return *s_threadBuffer;
+    }
+    std::lock_guard lock(m_mutex);
+    auto buffer = std::make_unique<ThreadBuffer>();
+    buffer->threadId = static_cast<std::uint32_t>(m_buffers.size());
+    buffer->threadName = "Thread " + std::to_string(buffer->threadId);
+    s_threadBuffer = buffer.get();
+    m_buffers.push_back(std::move(buffer));
+    return *m_buffers.back();
+}
+
+void Profiler::endFrame() {
+    const auto frameEndNs = now();
+    if (m_frameStartNs == 0) {
+        m_frameStartNs = frameEndNs;    // 第一帧只记录开始时间
+        return;
+    }
+    // 复用最旧一帧的内存，避免每帧分配
+    Frame frame;
+    if (m_history.size() >= HISTORY_FRAMES) {
+        frame = std::move(m_history.front());
+        m_history.pop_front();
+        frame.events.clear();
+    }
+    frame.startNs = m_frameStartNs;
+    frame.endNs = frameEndNs;
+    m_frameStartNs = frameEndNs;
+
+    // 1. 收集各线程新写入的记录
+    {
+        std::lock_guard lock(m_mutex);
+        for (auto& buffer : m_buffers) {
+            const auto writeIndex = buffer->writeIndex.load(std::memory_order_acquire);
+            if (writeIndex - buffer->readIndex > RING_CAPACITY) {
+                // 写入速度超过了缓冲容量，最早的记录已被覆盖
+                m_droppedEvents += writeIndex - buffer->readIndex - RING_CAPACITY;
+                buffer->readIndex = writeIndex - RING_CAPACITY;
+            }
+            for (auto i = buffer->readIndex; i < writeIndex; ++i) {
+                frame.events.push_back({buffer->events[i & (RING_CAPACITY - 1)], buffer->threadId});
+            }
+            buffer->readIndex = writeIndex;
+        }
+    }
+
+    // 2. 汇总本帧各区段（区段种类很少，线性查找即可）
+    m_frameStats.clear();
+    for (const auto& captured : frame.events) {
+        const std::string_view name = captured.event.name;
+        auto it = std::find_if(m_frameStats.begin(), m_frameStats.end(), [&](const ZoneStats& stats) { return stats.name == name; });
+        if (it == m_frameStats.end()) {
+            it = m_frameStats.insert(m_frameStats.end(), {name, 0.0, 0});
+        }
+        it->totalMs += static_cast<double>(captured.event.endNs - captured.event.startNs) / 1'000'000.0;
+        ++it->calls;
+    }
+    for (const auto& stats : m_frameStats) {
+        auto it = std::find_if(m_totalStats.begin(), m_totalStats.end(), [&](const ZoneStats& total) { return total.name == stats.name; });
+        if (it == m_totalStats.end()) {
+            it = m_totalStats.insert(m_totalStats.end(), {stats.name, 0.0, 0});
+        }
+        it->totalMs += stats.totalMs;
+        it->calls += stats.calls;
+    }
+    ++m_totalFrames;
+    m_history.push_back(std::move(frame));
+}
+
+bool Profiler::dumpChromeTrace(const std::string& path) const {
+    if (m_history.empty()) {
+        spdlog::warn("PROFILER::dumpChromeTrace::没有可导出的帧记录");
+        return false;
+    }
+    std::ofstream out(path);
+    if (!out) {
+        spdlog::error("PROFILER::dumpChromeTrace::无法写入文件: {}", path);
+        return false;
+    }
+    const auto originNs = m_history.front().startNs;
+    auto toMicroseconds = [originNs](std::uint64_t ns) {
+        return static_cast<double>(ns - std::min(ns, originNs)) / 1000.0;
+    };
+    out.setf(std::ios::fixed);
+    out.precision(3);
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    // 线程名称（帧事件单独放在所有线程之后的一行）
+    std::uint32_t frameTrackId = 0;
+    {
+        std::lock_guard lock(m_mutex);
+        for (const auto& buffer : m_buffers) {
+            out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << buffer->threadId << ",\"args\":{\"name\":";
+            writeJsonString(out, buffer->threadName);
+            out << "}},\n";
+        }
+        frameTrackId = static_cast<std::uint32_t>(m_buffers.size());
+    }
+    out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << frameTrackId << ",\"args\":{\"name\":\"Frames\"}}";
+    // 每一帧本身，以及帧内的所有区段（"X" 为完整事件：开始时间 + 持续时间）
+    size_t eventCount = 0;
+    for (const auto& frame : m_history) {
+        out << ",\n{\"name\":\"Frame\",\"ph\":\"X\",\"pid\":0,\"tid\":" << frameTrackId << ",\"ts\":"
+            << toMicroseconds(frame.startNs) << ",\"dur\":" << static_cast<double>(frame.endNs - frame.startNs) / 1000.0 << '}';
+        for (const auto& captured : frame.events) {
+            out << ",\n{\"name\":";
+            writeJsonString(out, captured.event.name);
+            out << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << captured.threadId << ",\"ts\":" << toMicroseconds(captured.event.startNs)
+                << ",\"dur\":" << static_cast<double>(captured.event.endNs - captured.event.startNs) / 1000.0 << '}';
+        }
+        eventCount += frame.events.size();
+    }
+    out << "\n]}\n";
+    if (!out) {
+        spdlog::error("PROFILER::dumpChromeTrace::写入文件失败: {}", path);
+        return false;
+    }
+
+    // 日志中输出各区段的平均耗时（按耗时从高到低）
+    std::vector<ZoneStats> totals;
+    for (const auto& frame : m_history) {
+        for (const auto& captured : frame.events) {
+            const std::string_view name = captured.event.name;
+            auto it = std::find_if(totals.begin(), totals.end(), [&](const ZoneStats& stats) { return stats.name == name; });
+            if (it == totals.end()) {
+                it = totals.insert(totals.end(), {name, 0.0, 0});
+            }
+            it->totalMs += static_cast<double>(captured.event.endNs - captured.event.startNs) / 1'000'000.0;
+            ++it->calls;
+        }
+    }
+    std::sort(totals.begin(), totals.end(), [](const ZoneStats& a, const ZoneStats& b) { return a.totalMs > b.totalMs; });
+    const auto frameCount = static_cast<double>(m_history.size());
+    const double averageFrameMs = static_cast<double>(m_history.back().endNs - m_history.front().startNs) / 1'000'000.0 / frameCount;
+    spdlog::info("PROFILER::dumpChromeTrace::已导出 {} 帧 ({} 条记录) 到 {}, 平均帧耗时 {:.3f} ms",
+                 m_history.size(), eventCount, path, averageFrameMs);
+    for (const auto& stats : totals) {
+        spdlog::info("PROFILER::    {:<40} {:8.3f} ms/帧 {:8.1f} 次/帧", stats.name, stats.totalMs / frameCount, stats.calls / frameCount);
+    }
+    if (m_droppedEvents > 0) {
+        spdlog::warn("PROFILER::dumpChromeTrace::共有 {} 条记录因缓冲溢出而丢失", m_droppedEvents);
+    }
+    return true;
+}
+
+} // namespace engine::utils
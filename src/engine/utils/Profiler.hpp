@@ -0,0 +1,165 @@
+/**
+ * @file Profiler.hpp
+ * @brief 帧性能分析器：RAII 区段计时、每线程无锁环形缓冲、逐帧汇总，以及导出 Chrome trace_event JSON
+ *
+ * 用法：在需要计时的作用域开头写 SL_PROFILE_ZONE("类名::函数名")，作用域结束时自动记录。
+ * 主线程每帧调用一次 SL_PROFILE_END_FRAME() 收集各线程的记录；
+ * 导出的文件可在 chrome://tracing 或 https://ui.perfetto.dev 中打开。
+ * 编译时未定义 SL_ENABLE_PROFILER（或为 0）时，这些宏全部为空，不产生任何开销。
+ */
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#ifndef SL_ENABLE_PROFILER
+#define SL_ENABLE_PROFILER 0
+#endif
+
+namespace engine::utils {
+
+/**
+ * @class Profiler
+ * @brief 性能分析器（全局唯一，任意线程都可以记录区段）
+ *
+ * 每个线程第一次记录时分配自己的环形缓冲，之后写入只有一次原子存储，不加锁；
+ * 主线程在 endFrame 中读取所有缓冲，汇总本帧各区段的耗时，并保留最近若干帧的记录供导出。
+ */
+class Profiler final {
+public:
+    /// @brief 一次区段记录
+    struct Event {
+        const char* name = nullptr;     ///< @brief 区段名称（必须是字符串字面量等静态字符串）
+        std::uint64_t startNs = 0;      ///< @brief 开始时间（纳秒）
+        std::uint64_t endNs = 0;        ///< @brief 结束时间（纳秒）
+    };
+
+    /// @brief 一个区段在一帧内的汇总
+    struct ZoneStats {
+        std::string_view name;          ///< @brief 区段名称
+        double totalMs = 0.0;           ///< @brief 总耗时（毫秒，包含嵌套的子区段）
+        int calls = 0;                  ///< @brief 调用次数
+    };
+
+private:
+    static constexpr size_t RING_CAPACITY = 1 << 14;    ///< @brief 每个线程环形缓冲的容量（必须是 2 的幂）
+    static constexpr size_t HISTORY_FRAMES = 300;       ///< @brief 保留用于导出的帧数
+
+    /// @brief 单个线程的环形缓冲（只有所属线程写入，只有主线程读取）
+    struct ThreadBuffer {
+        std::array<Event, RING_CAPACITY> events;        ///< @brief 记录
+        std::atomic<std::uint64_t> writeIndex = 0;      ///< @brief 已写入的记录总数
+        std::uint64_t readIndex = 0;                    ///< @brief 主线程已读取的记录总数
+        std::uint32_t threadId = 0;                     ///< @brief 线程编号（导出时使用）
+        std::string threadName;                         ///< @brief 线程名称（导出时使用）
+    };
+
+    /// @brief 收集到的一条记录
+    struct CapturedEvent {
+        Event event;                    ///< @brief 记录
+        std::uint32_t threadId = 0;     ///< @brief 所在线程编号
+    };
+
+    /// @brief 一帧的记录
+    struct Frame {
+        std::uint64_t startNs = 0;                  ///< @brief 帧开始时间
+        std::uint64_t endNs = 0;                    ///< @brief 帧结束时间
+        std::vector<CapturedEvent> events;          ///< @brief 本帧收集到的所有记录
+    };
+
+    static thread_local ThreadBuffer* s_threadBuffer;       ///< @brief 当前线程的缓冲（首次记录时注册）
+
+    mutable std::mutex m_mutex;                             ///< @brief 保护 m_buffers（线程注册与主线程读取）
+    std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;   ///< @brief 所有线程的缓冲（线程退出后仍保留，直到程序结束）
+    std::deque<Frame> m_history;                            ///< @brief 最近的帧记录
+    std::vector<ZoneStats> m_frameStats;                    ///< @brief 上一帧的区段汇总
+    std::vector<ZoneStats> m_totalStats;                    ///< @brief 程序启动以来的区段汇总
+    std::uint64_t m_totalFrames = 0;                        ///< @brief 程序启动以来已汇总的帧数
+    std::uint64_t m_frameStartNs = 0;                       ///< @brief 当前帧的开始时间
+    std::uint64_t m_droppedEvents = 0;                      ///< @brief 因缓冲溢出而丢失的记录数
+
+public:
+    static Profiler& get();                 ///< @brief 获取全局分析器
+    static std::uint64_t now();             ///< @brief 当前时间（纳秒，单调时钟）
+
+    /// @name 禁止拷贝和移动
+    /// @{
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+    Profiler(Profiler&&) = delete;
+    Profiler& operator=(Profiler&&) = delete;
+    /// @}
+
+    /**
+     * @brief 记录一个区段（任意线程，无锁）
+     * @param name 区段名称（必须是静态字符串）
+     * @param startNs 开始时间
+     * @param endNs 结束时间
+     */
+    void record(const char* name, std::uint64_t startNs, std::uint64_t endNs);
+    /// @brief 设置当前线程在导出文件中显示的名称
+    void setThreadName(std::string_view name);
+
+    /// @brief 结束当前帧：收集各线程的记录并汇总（每帧在主线程调用一次）
+    void endFrame();
+    /// @brief 上一帧各区段的汇总（按首次出现的顺序）
+    const std::vector<ZoneStats>& getFrameStats() const { return m_frameStats; }
+    /// @brief 程序启动以来各区段的累计汇总
+    const std::vector<ZoneStats>& getTotalStats() const { return m_totalStats; }
+    /// @brief 程序启动以来已汇总的帧数
+    std::uint64_t getTotalFrames() const { return m_totalFrames; }
+    /**
+     * @brief 把最近的帧记录导出为 Chrome trace_event JSON，并在日志中输出各区段的平均耗时
+     * @param path 输出文件路径
+     * @return 是否成功
+     */
+    [[nodiscard]] bool dumpChromeTrace(const std::string& path) const;
+
+private:
+    Profiler() = default;
+    ThreadBuffer& getThreadBuffer();        ///< @brief 获取（必要时注册）当前线程的缓冲
+};
+
+/**
+ * @class ProfileZone
+ * @brief RAII 区段：构造时记录开始时间，析构时提交记录。一般通过 SL_PROFILE_ZONE 使用
+ */
+class ProfileZone final {
+    const char* m_name;             ///< @brief 区段名称
+    std::uint64_t m_startNs;        ///< @brief 开始时间
+
+public:
+    explicit ProfileZone(const char* name) : m_name(name), m_startNs(Profiler::now()) {}
+    ~ProfileZone() { Profiler::get().record(m_name, m_startNs, Profiler::now()); }
+
+    /// @name 禁止拷贝和移动
+    /// @{
+    ProfileZone(const ProfileZone&) = delete;
+    ProfileZone& operator=(const ProfileZone&) = delete;
+    ProfileZone(ProfileZone&&) = delete;
+    ProfileZone& operator=(ProfileZone&&) = delete;
+    /// @}
+};
+
+} // namespace engine::utils
+
+#if SL_ENABLE_PROFILER
+#define SL_PROFILE_CONCAT_INNER(a, b) a##b
+#define SL_PROFILE_CONCAT(a, b) SL_PROFILE_CONCAT_INNER(a, b)
+/// @brief 计时当前作用域（name 必须是字符串字面量）
+#define SL_PROFILE_ZONE(name) const ::engine::utils::ProfileZone SL_PROFILE_CONCAT(profileZone_, __LINE__)(name)
+/// @brief 设置当前线程在导出文件中的名称
+#define SL_PROFILE_THREAD_NAME(name) ::engine::utils::Profiler::get().setThreadName(name)
+/// @brief 结束当前帧（主线程每帧调用一次）
+#define SL_PROFILE_END_FRAME() ::engine::utils::Profiler::get().endFrame()
+#else
+#define SL_PROFILE_ZONE(name) ((void)0)
+#define SL_PROFILE_THREAD_NAME(name) ((void)0)
+#define SL_PROFILE_END_FRAME() ((void)0)
+#endif
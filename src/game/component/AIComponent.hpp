@@ -1,5 +1,6 @@
 #pragma once
 #include "../../engine/component/Component.hpp"
+#include "GameComponentId.hpp"
 #include "AI/AIBehavior.hpp"
 #include <memory>
 
@@ -22,6 +23,8 @@ namespace game::component {
  */
 class AIComponent final : public engine::component::Component {
     friend class engine::object::GameObject;
+public:
+    static constexpr engine::component::ComponentId COMPONENT_ID = AI_COMPONENT_ID;   ///< @brief 组件编号（GameObject 组件槽位的下标）
 private:
     std::unique_ptr<ai::AIBehavior> m_currentBehavior = nullptr; ///< @brief 当前 AI 行为策略
     /* 未来可添加一些敌人属性 */
@@ -0,0 +1,13 @@
+/**
+ * @file GameComponentId.hpp
+ * @brief 游戏层组件的编号（接在引擎组件编号之后）
+ */
+#pragma once
+#include "../../engine/component/ComponentId.hpp"
+
+namespace game::component {
+
+inline constexpr engine::component::ComponentId PLAYER_COMPONENT_ID = engine::component::FIRST_GAME_COMPONENT_ID + 0;
+inline constexpr engine::component::ComponentId AI_COMPONENT_ID     = engine::component::FIRST_GAME_COMPONENT_ID + 1;
+
+} // namespace game::component
@@ -1,5 +1,6 @@
 #pragma once
 #include "../../engine/component/Component.hpp"
+#include "GameComponentId.hpp"
 #include "state/PlayerState.hpp"
 #include <memory>
 
@@ -27,6 +28,8 @@ namespace game::component {
  */
 class PlayerComponent final : public engine::component::Component {
     friend class engine::object::GameObject;
+public:
+    static constexpr engine::component::ComponentId COMPONENT_ID = PLAYER_COMPONENT_ID;   ///< @brief 组件编号（GameObject 组件槽位的下标）
 private:
     engine::component::TransformComponent* m_transformComponent = nullptr; // 指向 TransformComponent 的非拥有指针
     engine::component::SpriteComponent*    m_spriteComponent    = nullptr;
@@ -143,6 +143,13 @@ bool GameScene::initLevel() {
     // 设置世界边界
     m_context.getPhysicsEngine().setWorldBounds(engine::utils::Rect(glm::vec2(0.0f), worldSize));
 
+    // 在后台预加载后续关卡，到达 next_level 触发器时只需上传纹理、创建对象
+    for (const auto& obj : getGameObjects()) {
+        if (obj->getTag() == "next_level") {
+            m_sceneManager.requestPreloadLevel(levelNameToPath(obj->getName()));
+        }
+    }
+
     spdlog::trace("GAMESCENE::initLevel::TRACE::关卡初始化完成。");
     return true;
 }
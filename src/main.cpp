@@ -2,6 +2,7 @@
 #include "engine/core/Context.hpp"
 #include "engine/scene/SceneManager.hpp"
 #include "game/scene/TitleScene.hpp"
+#include "game/scene/GameScene.hpp"
 #include <spdlog/spdlog.h>
 #include <SDL3/SDL.h>
 
@@ -11,11 +12,24 @@ void setupInitialScene(engine::scene::SceneManager& sceneManager) {
     sceneManager.requestPushScene(std::move(titleScene));
 }
 
-int main() {
+void setupHeadlessScene(engine::scene::SceneManager& sceneManager) {
+    // 无头模式跳过标题菜单，直接进入关卡
+    auto gameScene = std::make_unique<game::scene::GameScene>(sceneManager.getContext(), sceneManager);
+    sceneManager.requestPushScene(std::move(gameScene));
+}
+
+int main(int argc, char* argv[]) {
     spdlog::set_level(spdlog::level::trace);
 
     engine::core::Game app;
-    app.registerSceneSetup(setupInitialScene);
+    app.setCommandLine(argc, argv);
+    app.registerSceneSetup([&app](engine::scene::SceneManager& sceneManager) {
+        if (app.isHeadless()) {
+            setupHeadlessScene(sceneManager);
+        } else {
+            setupInitialScene(sceneManager);
+        }
+    });
     app.run();
     return 0;
 }
\ No newline at end of file
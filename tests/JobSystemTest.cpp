@@ -0,0 +1,157 @@
+/**
+ * @file JobSystemTest.cpp
+ * @brief 任务系统 (JobSystem) 的单元测试：提交与等待、任务依赖、并行 for 的边界、任务抛出异常
+ */
+#include "TestHarness.hpp"
+#include "../src/engine/core/JobSystem.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using engine::core::JobCounter;
+using engine::core::JobSystem;
+
+namespace {
+
+void testScheduleAndWait() {
+    JobSystem jobs(3);
+    JobCounter counter;
+    std::atomic<int> sum = 0;
+    for (int i = 1; i <= 1000; ++i) {
+        jobs.schedule([&sum, i] { sum.fetch_add(i, std::memory_order_relaxed); }, &counter);
+    }
+    jobs.wait(counter);
+    TEST_CHECK(counter.isDone());
+    TEST_CHECK(sum.load() == 500500);
+
+    // 任务中提交的子任务计入同一个计数器，wait 要等到子任务也完成
+    JobCounter nested;
+    std::atomic<int> leaves = 0;
+    for (int i = 0; i < 16; ++i) {
+        jobs.schedule([&] {
+            for (int j = 0; j < 16; ++j) {
+                jobs.schedule([&leaves] { leaves.fetch_add(1, std::memory_order_relaxed); }, &nested);
+            }
+        }, &nested);
+    }
+    jobs.wait(nested);
+    TEST_CHECK(leaves.load() == 256);
+}
+
+void testScheduleAfter() {
+    JobSystem jobs(2);
+
+    // 依赖从未关联任务（计数为 0）：立即提交
+    {
+        JobCounter dependency;
+        JobCounter counter;
+        std::atomic<bool> hasRun = false;
+        jobs.scheduleAfter(dependency, [&hasRun] { hasRun = true; }, &counter);
+        jobs.wait(counter);
+        TEST_CHECK(hasRun.load());
+    }
+    // 依赖的任务已经执行完：立即提交，不会挂在已归零的计数器上
+    {
+        JobCounter dependency;
+        jobs.schedule([] {}, &dependency);
+        jobs.wait(dependency);
+        JobCounter counter;
+        std::atomic<bool> hasRun = false;
+        jobs.scheduleAfter(dependency, [&hasRun] { hasRun = true; }, &counter);
+        jobs.wait(counter);
+        TEST_CHECK(hasRun.load());
+    }
+    // 依赖尚未完成：后续任务必须在依赖的所有任务之后执行
+    {
+        JobCounter dependency;
+        std::atomic<int> finished = 0;
+        for (int i = 0; i < 8; ++i) {
+            jobs.schedule([&finished] {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+                finished.fetch_add(1, std::memory_order_relaxed);
+            }, &dependency);
+        }
+        JobCounter counter;
+        std::atomic<int> seen = -1;
+        jobs.scheduleAfter(dependency, [&] { seen = finished.load(); }, &counter);
+        TEST_CHECK(!counter.isDone());      // 提交时就已计入自己的计数器
+        jobs.wait(counter);
+        jobs.wait(dependency);
+        TEST_CHECK(seen.load() == 8);
+    }
+}
+
+void testParallelFor() {
+    JobSystem jobs(3);
+    // 元素数不是分块大小的整数倍（最后一块不满），以及分块大小为 0（按线程数平均分配）
+    for (size_t count : {0u, 1u, 7u, 100u, 1003u, 4097u}) {
+        for (size_t grainSize : {0u, 1u, 64u, 100u, 5000u}) {
+            std::vector<int> visits(count, 0);     // 各块互不重叠，不需要原子操作
+            std::atomic<size_t> maxEnd = 0;
+            jobs.parallelFor(count, grainSize, [&](size_t begin, size_t end) {
+                TEST_CHECK(begin < end);
+                TEST_CHECK(end <= visits.size());
+                for (size_t i = begin; i < end; ++i) ++visits[i];
+                size_t current = maxEnd.load();
+                while (end > current && !maxEnd.compare_exchange_weak(current, end)) {}
+            });
+            bool isEachOnce = true;
+            for (int visit : visits) isEachOnce = isEachOnce && visit == 1;
+            TEST_CHECK(isEachOnce);
+            TEST_CHECK(maxEnd.load() == count);
+        }
+    }
+}
+
+void testJobThrows() {
+    JobSystem jobs(2);
+    JobCounter counter;
+    std::atomic<int> completed = 0;
+    jobs.schedule([] { throw std::runtime_error("测试异常"); }, &counter);
+    jobs.schedule([] { throw 42; }, &counter);      // 非 std::exception 的异常
+    for (int i = 0; i < 10; ++i) {
+        jobs.schedule([&completed] { completed.fetch_add(1); }, &counter);
+    }
+    jobs.wait(counter);     // 抛出异常的任务也要令计数器减一，否则这里会一直等待
+    TEST_CHECK(counter.isDone());
+    TEST_CHECK(completed.load() == 10);
+
+    // 依赖抛出异常的任务的后续任务仍会执行，工作线程也仍然可用
+    JobCounter dependency;
+    jobs.schedule([] { throw std::logic_error("依赖抛出异常"); }, &dependency);
+    JobCounter after;
+    std::atomic<bool> hasRun = false;
+    jobs.scheduleAfter(dependency, [&hasRun] { hasRun = true; }, &after);
+    jobs.wait(after);
+    TEST_CHECK(hasRun.load());
+}
+
+void testMainThreadTasks() {
+    JobSystem jobs(2);
+    TEST_CHECK(jobs.isMainThread());
+    JobCounter dependency;
+    jobs.schedule([] {}, &dependency);
+    jobs.wait(dependency);
+
+    JobCounter counter;
+    std::atomic<bool> isOnMainThread = false;
+    jobs.runOnMainThreadAfter(dependency, [&] { isOnMainThread = jobs.isMainThread(); }, &counter);
+    TEST_CHECK(!counter.isDone());      // 只在 update 中执行
+    jobs.update();
+    TEST_CHECK(counter.isDone());
+    TEST_CHECK(isOnMainThread.load());
+}
+
+} // namespace
+
+int main() {
+    test::run("schedule / wait", testScheduleAndWait);
+    test::run("scheduleAfter", testScheduleAfter);
+    test::run("parallelFor 不满的最后一块", testParallelFor);
+    test::run("任务抛出异常", testJobThrows);
+    test::run("主线程延续任务", testMainThreadTasks);
+    return test::finish("JOBSYSTEMTEST");
+}
@@ -0,0 +1,400 @@
+/**
+ * @file PhysicsEngineTest.cpp
+ * @brief 物理引擎 (PhysicsEngine) 的单元测试：静态物体的转换与碰撞对、休眠、空间查询
+ *
+ * 只使用物理相关的组件，不需要 Context 和渲染器。
+ */
+#include "TestHarness.hpp"
+#include "../src/engine/component/ColliderComponent.hpp"
+#include "../src/engine/component/PhysicsComponent.hpp"
+#include "../src/engine/component/TilelayerComponent.hpp"
+#include "../src/engine/component/TransformComponent.hpp"
+#include "../src/engine/object/GameObject.hpp"
+#include "../src/engine/physics/Collider.hpp"
+#include "../src/engine/physics/PhysicsEngine.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+using engine::component::ColliderComponent;
+using engine::component::PhysicsComponent;
+using engine::component::TileLayerComponent;
+using engine::component::TileType;
+using engine::component::TransformComponent;
+using engine::object::GameObject;
+using engine::physics::QueryFilter;
+
+namespace {
+
+constexpr float DT = 1.0f / 60.0f;
+
+/// @brief 物理引擎与其中的物体，析构时先清理物体（注销物理组件）
+struct World {
+    engine::physics::PhysicsEngine physics;
+    std::vector<std::unique_ptr<GameObject>> objects;
+
+    ~World() {
+        for (auto& object : objects) object->clean();
+    }
+
+    /// @brief 添加一个 Transform + AABB 碰撞器 + 物理组件的物体
+    GameObject* add(std::string_view name, std::string_view tag, glm::vec2 position, glm::vec2 size, bool useGravity) {
+        auto object = std::make_unique<GameObject>(name, tag);
+        object->addComponent<TransformComponent>(position);
+        object->addComponent<ColliderComponent>(std::make_unique<engine::physics::AABBCollider>(size));
+        object->addComponent<PhysicsComponent>(&physics, useGravity);
+        objects.push_back(std::move(object));
+        return objects.back().get();
+    }
+
+    /// @brief 添加一个碰撞瓦片层（types 按行主序给出每个格子的瓦片类型）
+    void addTiles(glm::ivec2 tileSize, glm::ivec2 mapSize, const std::vector<TileType>& types) {
+        std::vector<engine::component::TileInfo> palette(1);    // 0 号为空瓦片
+        std::vector<std::uint16_t> cells;
+        for (auto type : types) {
+            if (type != TileType::EMPTY) palette.emplace_back(engine::render::Sprite(), type);
+            cells.push_back(type == TileType::EMPTY ? 0 : static_cast<std::uint16_t>(palette.size() - 1));
+        }
+        auto object = std::make_unique<GameObject>("tiles");
+        auto* layer = object->addComponent<TileLayerComponent>(tileSize, mapSize, std::move(palette), std::move(cells));
+        physics.registerCollisionLayer(layer);
+        objects.push_back(std::move(object));
+    }
+
+    void step(int count = 1) {
+        for (int i = 0; i < count; ++i) physics.update(DT);
+    }
+
+    /// @brief 本次更新的碰撞对中是否有 a 与 b（不分先后）
+    bool hasPair(const GameObject* a, const GameObject* b) const {
+        const auto& pairs = physics.getCollisionPairs();
+        return std::any_of(pairs.begin(), pairs.end(), [a, b](const auto& pair) {
+            return (pair.first == a && pair.second == b) || (pair.first == b && pair.second == a);
+        });
+    }
+};
+
+bool near(glm::vec2 a, glm::vec2 b) { return glm::abs(a.x - b.x) < 1e-3f && glm::abs(a.y - b.y) < 1e-3f; }
+PhysicsComponent* physicsOf(GameObject* object) { return object->getComponent<PhysicsComponent>(); }
+TransformComponent* transformOf(GameObject* object) { return object->getComponent<TransformComponent>(); }
+
+void testStaticPromotion() {
+    World world;
+    world.add("box", "solid", {0.0f, 0.0f}, {16.0f, 16.0f}, false);
+    world.add("crate", "solid", {64.0f, 0.0f}, {16.0f, 16.0f}, true);      // 受重力，保持动态
+    world.add("enemy", "enemy", {128.0f, 0.0f}, {16.0f, 16.0f}, false);    // 不是 solid，保持动态
+    world.step();
+    TEST_CHECK(world.physics.getStaticBodyCount() == 1);
+    TEST_CHECK(world.physics.getDynamicBodyCount() == 2);
+}
+
+void testDemoteOnVelocity() {
+    World world;
+    auto* box = world.add("box", "solid", {0.0f, 0.0f}, {16.0f, 16.0f}, false);
+    world.step();
+    TEST_CHECK(world.physics.getStaticBodyCount() == 1);
+
+    physicsOf(box)->setVelocity({60.0f, 0.0f});
+    world.step();
+    TEST_CHECK(world.physics.getStaticBodyCount() == 0);
+    TEST_CHECK(transformOf(box)->getPosition().x > 0.5f);   // 转回动态后照常积分
+
+    // 停下后再次转为静态
+    physicsOf(box)->setVelocity({0.0f, 0.0f});
+    world.step();
+    TEST_CHECK(world.physics.getStaticBodyCount() == 1);
+}
+
+void testDemoteOnGravityForceOrDisable() {
+    World world;
+    auto* a = world.add("a", "solid", {0.0f, 0.0f}, {16.0f, 16.0f}, false);
+    auto* b = world.add("b", "solid", {64.0f, 0.0f}, {16.0f, 16.0f}, false);
+    auto* c = world.add("c", "solid", {128.0f, 0.0f}, {16.0f, 16.0f}, false);
+    auto* d = world.add("d", "solid", {192.0f, 0.0f}, {16.0f, 16.0f}, false);
+    world.step();
+    TEST_CHECK(world.physics.getStaticBodyCount() == 4);
+
+    physicsOf(a)->setUseGravity(true);
+    physicsOf(b)->addForce({0.0f, -600.0f});
+    physicsOf(c)->setEnabled(false);
+    d->getComponent<ColliderComponent>()->setTrigger(true);
+    world.step();
+    TEST_CHECK(world.physics.getStaticBodyCount() == 0);
+    TEST_CHECK(transformOf(a)->getPosition().y > 0.0f);     // 开始下落
+    TEST_CHECK(transformOf(b)->getPosition().y < 0.0f);     // 被力推动
+}
+
+void testDemoteOnDirectMove() {
+    World world;
+    auto* platform = world.add("platform", "solid", {0.0f, 0.0f}, {32.0f, 8.0f}, false);
+    world.step();
+    TEST_CHECK(world.physics.getStaticBodyCount() == 1);
+
+    // 脚本直接移动的平台：转回动态，之后不再转为静态
+    for (int i = 1; i <= 5; ++i) {
+        transformOf(platform)->setPosition({static_cast<float>(i) * 4.0f, 0.0f});
+        world.step();
+        TEST_CHECK(world.physics.getStaticBodyCount() == 0);
+    }
+    world.step(3);
+    TEST_CHECK(world.physics.getStaticBodyCount() == 0);
+
+    // 移动后的位置参与碰撞：落在新位置（x 为 20~52，原位置为 0~32）上的物体被挡住
+    auto* player = world.add("player", "player", {40.0f, -20.0f}, {8.0f, 8.0f}, true);
+    world.step(30);
+    TEST_CHECK(transformOf(player)->getPosition().y <= -8.0f + 0.5f);
+}
+
+void testSolidPairs() {
+    World world;
+    auto* a = world.add("a", "solid", {0.0f, 0.0f}, {16.0f, 16.0f}, false);
+    auto* b = world.add("b", "solid", {8.0f, 0.0f}, {16.0f, 16.0f}, false);
+    auto* c = world.add("c", "solid", {100.0f, 0.0f}, {16.0f, 16.0f}, false);
+    auto* falling = world.add("falling", "solid", {100.0f, 4.0f}, {16.0f, 16.0f}, true);
+    for (int i = 0; i < 2; ++i) {
+        world.step();
+        TEST_CHECK(world.physics.getStaticBodyCount() == 3);
+        TEST_CHECK(world.hasPair(a, b));            // 两个静态物体重叠：每步都输出碰撞对
+        TEST_CHECK(world.hasPair(c, falling));      // 动态 SOLID 物体与静态物体重叠：不推挤，只输出碰撞对
+        TEST_CHECK(!world.hasPair(a, c));
+    }
+}
+
+void testPromoteSleepingBody() {
+    World world;
+    world.add("floor", "solid", {0.0f, 100.0f}, {200.0f, 16.0f}, false);
+    auto* a = world.add("a", "item", {10.0f, 84.0f}, {16.0f, 16.0f}, true);
+    auto* b = world.add("b", "item", {100.0f, 84.0f}, {16.0f, 16.0f}, true);
+    world.step(60);
+    TEST_CHECK(world.physics.getSleepingBodyCount() == 2);
+
+    // 休眠中的物体改为不受重力的 SOLID 物体：转为静态时要同时扣除休眠计数，并使休眠索引与查询数据失效
+    a->setTag("solid");
+    physicsOf(a)->setUseGravity(false);
+    world.step();
+    TEST_CHECK(world.physics.getStaticBodyCount() == 2);
+    TEST_CHECK(world.physics.getDynamicBodyCount() == 1);
+    TEST_CHECK(world.physics.getSleepingBodyCount() == 1);
+    TEST_CHECK(world.physics.getAwakeBodyCount() == 0);
+
+    // b 的下标前移后，查询仍然找到 b 本身
+    std::array<GameObject*, 4> found{};
+    engine::physics::QueryFilter dynamicOnly;
+    dynamicOnly.flags = engine::physics::QUERY_DYNAMIC;
+    TEST_CHECK(world.physics.overlapBox({{100.0f, 84.0f}, {16.0f, 16.0f}}, found, dynamicOnly) == 1);
+    TEST_CHECK(found[0] == b);
+    engine::physics::QueryFilter staticOnly;
+    staticOnly.flags = engine::physics::QUERY_STATIC;
+    staticOnly.tag = "solid";
+    const size_t count = world.physics.overlapBox({{10.0f, 84.0f}, {16.0f, 16.0f}}, found, staticOnly);
+    TEST_CHECK(std::find(found.begin(), found.begin() + count, a) != found.begin() + count);
+
+    // 落下的物体唤醒 b，计数不会下溢
+    world.add("c", "item", {100.0f, 60.0f}, {16.0f, 16.0f}, true);
+    world.step(10);
+    TEST_CHECK(world.physics.getSleepingBodyCount() == 0);
+    TEST_CHECK(world.physics.getAwakeBodyCount() == world.physics.getDynamicBodyCount());
+}
+
+void testSleepingPairs() {
+    World world;
+    world.add("floor", "solid", {0.0f, 100.0f}, {200.0f, 16.0f}, false);
+    auto* player = world.add("player", "player", {10.0f, 84.0f}, {16.0f, 16.0f}, true);
+    auto* enemy = world.add("enemy", "enemy", {20.0f, 84.0f}, {16.0f, 16.0f}, true);   // 与 player 重叠
+    auto* item = world.add("item", "item", {100.0f, 84.0f}, {16.0f, 16.0f}, true);
+    world.step(60);
+    TEST_CHECK(world.physics.getSleepingBodyCount() == 3);
+
+    // 两个都在休眠的物体重叠：每步照常输出碰撞对，且不会因此醒来
+    for (int i = 0; i < 3; ++i) {
+        world.step();
+        TEST_CHECK(world.hasPair(player, enemy));
+        TEST_CHECK(!world.hasPair(player, item));
+        TEST_CHECK(world.physics.getSleepingBodyCount() == 3);
+    }
+
+    // 其中一个醒来后改由粗检测输出，不会重复
+    physicsOf(enemy)->setVelocity({0.0f, -1.0f});
+    world.step();
+    const auto& pairs = world.physics.getCollisionPairs();
+    TEST_CHECK(std::count_if(pairs.begin(), pairs.end(), [&](const auto& pair) {
+        return (pair.first == player && pair.second == enemy) || (pair.first == enemy && pair.second == player);
+    }) == 1);
+}
+
+/// @brief 空间查询用的场景：都不受重力，位置保持不变
+struct QueryWorld : World {
+    GameObject* wall = add("wall", "solid", {200.0f, 0.0f}, {16.0f, 64.0f}, false);     // 转为静态
+    GameObject* enemyA = add("enemyA", "enemy", {100.0f, 0.0f}, {16.0f, 16.0f}, false);
+    GameObject* enemyB = add("enemyB", "enemy", {300.0f, 0.0f}, {16.0f, 16.0f}, false);
+    GameObject* coin = add("coin", "coin", {120.0f, 40.0f}, {8.0f, 8.0f}, false);       // 触发器
+    GameObject* ball = nullptr;                                                           // 圆形碰撞器，AABB 为 (0, 100) ~ (16, 116)
+
+    QueryWorld() {
+        coin->getComponent<ColliderComponent>()->setTrigger(true);
+        auto object = std::make_unique<GameObject>("ball", "ball");
+        object->addComponent<TransformComponent>(glm::vec2(0.0f, 100.0f));
+        object->addComponent<ColliderComponent>(std::make_unique<engine::physics::CircleCollider>(8.0f));
+        object->addComponent<PhysicsComponent>(&physics, false);
+        objects.push_back(std::move(object));
+        ball = objects.back().get();
+        step();
+    }
+};
+
+void testOverlapBox() {
+    QueryWorld world;
+    TEST_CHECK(world.physics.getStaticBodyCount() == 1);
+    std::array<GameObject*, 8> found{};
+    auto contains = [&found](size_t count, const GameObject* object) {
+        return std::find(found.begin(), found.begin() + std::min(count, found.size()), object) != found.begin() + std::min(count, found.size());
+    };
+
+    // 默认过滤条件包括触发器与静态物体
+    size_t count = world.physics.overlapBox({{90.0f, -10.0f}, {50.0f, 60.0f}}, found);
+    TEST_CHECK(count == 2 && contains(count, world.enemyA) && contains(count, world.coin));
+    QueryFilter noTriggers;
+    noTriggers.flags = engine::physics::QUERY_DYNAMIC | engine::physics::QUERY_STATIC;
+    count = world.physics.overlapBox({{90.0f, -10.0f}, {50.0f, 60.0f}}, found, noTriggers);
+    TEST_CHECK(count == 1 && found[0] == world.enemyA);
+
+    // 边界接触不算重叠
+    TEST_CHECK(world.physics.overlapBox({{116.0f, 0.0f}, {4.0f, 16.0f}}, found) == 0);
+
+    // 按标签过滤、忽略自身
+    const engine::utils::Rect everything = {{-100.0f, -100.0f}, {600.0f, 400.0f}};
+    QueryFilter enemies;
+    enemies.tag = "enemy";
+    count = world.physics.overlapBox(everything, found, enemies);
+    TEST_CHECK(count == 2 && contains(count, world.enemyA) && contains(count, world.enemyB));
+    enemies.ignore = world.enemyA;
+    count = world.physics.overlapBox(everything, found, enemies);
+    TEST_CHECK(count == 1 && found[0] == world.enemyB);
+
+    // 只查询静态物体
+    QueryFilter staticOnly;
+    staticOnly.flags = engine::physics::QUERY_STATIC;
+    count = world.physics.overlapBox(everything, found, staticOnly);
+    TEST_CHECK(count == 1 && found[0] == world.wall);
+
+    // 缓冲区不足时返回总数，只写入缓冲区大小的结果
+    std::array<GameObject*, 1> one{};
+    TEST_CHECK(world.physics.overlapBox(everything, one) == 5);
+    TEST_CHECK(one[0] != nullptr);
+}
+
+void testQueryRadius() {
+    QueryWorld world;
+    std::array<GameObject*, 8> found{};
+    // 圆与圆：圆心距离 22，半径之和 23 时重叠，21 时不重叠
+    TEST_CHECK(world.physics.queryRadius({30.0f, 108.0f}, 15.0f, found) == 1 && found[0] == world.ball);
+    TEST_CHECK(world.physics.queryRadius({30.0f, 108.0f}, 13.0f, found) == 0);
+    // 圆与 AABB：外接正方形与 enemyA 的角重叠，但圆心到角的距离约 12.7
+    TEST_CHECK(world.physics.queryRadius({125.0f, 25.0f}, 10.0f, found) == 0);
+    TEST_CHECK(world.physics.queryRadius({125.0f, 25.0f}, 13.0f, found) == 1 && found[0] == world.enemyA);
+}
+
+void testRaycast() {
+    QueryWorld world;
+    std::vector<TileType> types(30 * 8, TileType::EMPTY);
+    for (int y = 0; y < 8; ++y) types[static_cast<size_t>(y) * 30 + 15] = TileType::SOLID;    // 实心瓦片列：x 为 240~256
+    world.addTiles({16, 16}, {30, 8}, types);
+
+    // 命中最近的物体
+    engine::physics::RaycastHit hit;
+    TEST_CHECK(world.physics.raycast({0.0f, 8.0f}, {400.0f, 8.0f}, hit));
+    TEST_CHECK(hit.object == world.enemyA && hit.tileType == TileType::EMPTY);
+    TEST_CHECK(hit.fraction == 0.25f && near(hit.point, {100.0f, 8.0f}) && hit.normal == glm::vec2(-1.0f, 0.0f));
+
+    // 忽略 enemyA 后命中静态的墙
+    QueryFilter filter;
+    filter.ignore = world.enemyA;
+    TEST_CHECK(world.physics.raycast({0.0f, 8.0f}, {400.0f, 8.0f}, hit, filter));
+    TEST_CHECK(hit.object == world.wall && hit.fraction == 0.5f);
+
+    // 不查询静态物体时命中瓦片
+    filter.flags = engine::physics::QUERY_DYNAMIC | engine::physics::QUERY_TILES;
+    TEST_CHECK(world.physics.raycast({0.0f, 8.0f}, {400.0f, 8.0f}, hit, filter));
+    TEST_CHECK(hit.object == nullptr && hit.tileType == TileType::SOLID);
+    TEST_CHECK(near(hit.point, {240.0f, 8.0f}) && hit.normal == glm::vec2(-1.0f, 0.0f));
+
+    // 瓦片比物体近：命中瓦片；向上的射线命中圆形碰撞器的底部
+    TEST_CHECK(world.physics.raycast({260.0f, 8.0f}, {0.0f, 8.0f}, hit));
+    TEST_CHECK(hit.object == nullptr && near(hit.point, {256.0f, 8.0f}) && hit.normal == glm::vec2(1.0f, 0.0f));
+    TEST_CHECK(world.physics.raycast({8.0f, 200.0f}, {8.0f, 0.0f}, hit));
+    TEST_CHECK(hit.object == world.ball && near(hit.point, {8.0f, 116.0f}) && hit.normal == glm::vec2(0.0f, 1.0f));
+
+    // 未命中时不修改 hit
+    hit = {};
+    TEST_CHECK(!world.physics.raycast({0.0f, 300.0f}, {100.0f, 300.0f}, hit));
+    TEST_CHECK(hit.object == nullptr && hit.fraction == 1.0f);
+}
+
+void testFindNearest() {
+    QueryWorld world;
+    QueryFilter enemies;
+    enemies.tag = "enemy";
+    TEST_CHECK(world.physics.findNearest({0.0f, 8.0f}, 1000.0f, enemies) == world.enemyA);
+    TEST_CHECK(world.physics.findNearest({400.0f, 8.0f}, 1000.0f, enemies) == world.enemyB);
+    TEST_CHECK(world.physics.findNearest({0.0f, 8.0f}, 50.0f, enemies) == nullptr);     // 超出最大距离
+    enemies.ignore = world.enemyA;
+    TEST_CHECK(world.physics.findNearest({0.0f, 8.0f}, 1000.0f, enemies) == world.enemyB);
+    // 不按标签过滤：最近的是圆形碰撞器
+    TEST_CHECK(world.physics.findNearest({8.0f, 140.0f}, 1000.0f) == world.ball);
+}
+
+void testQueryDoesNotWake() {
+    World world;
+    world.add("floor", "solid", {0.0f, 100.0f}, {200.0f, 16.0f}, false);
+    auto* item = world.add("item", "item", {10.0f, 84.0f}, {16.0f, 16.0f}, true);
+    world.step(60);
+    TEST_CHECK(world.physics.getSleepingBodyCount() == 1);
+
+    // 两次更新之间注册新物体并给休眠物体速度：查询读取新数据，但不唤醒物体
+    auto* added = world.add("added", "item", {100.0f, 40.0f}, {16.0f, 16.0f}, false);
+    physicsOf(item)->setVelocity({30.0f, 0.0f});
+    std::array<GameObject*, 4> found{};
+    TEST_CHECK(world.physics.overlapBox({{100.0f, 40.0f}, {16.0f, 16.0f}}, found) == 1 && found[0] == added);
+    TEST_CHECK(world.physics.overlapBox({{10.0f, 84.0f}, {16.0f, 16.0f}}, found) == 1 && found[0] == item);
+    TEST_CHECK(world.physics.getSleepingBodyCount() == 1);
+
+    // 下一次更新时才唤醒
+    world.step();
+    TEST_CHECK(world.physics.getSleepingBodyCount() == 0);
+    TEST_CHECK(transformOf(item)->getPosition().x > 10.0f);
+}
+
+void testQueryAfterPush() {
+    World world;
+    world.add("crate", "solid", {60.0f, 0.0f}, {64.0f, 64.0f}, true);      // 受重力，保持动态
+    auto* item = world.add("item", "item", {110.0f, 20.0f}, {16.0f, 16.0f}, false);
+    world.step();
+    // item 被推到右侧 (x 为 124~140)，进入登记时没有覆盖的网格 (x >= 128)
+    TEST_CHECK(glm::abs(transformOf(item)->getPosition().x - 124.0f) < 0.5f);
+    std::array<GameObject*, 4> found{};
+    TEST_CHECK(world.physics.overlapBox({{130.0f, 20.0f}, {4.0f, 8.0f}}, found) == 1 && found[0] == item);
+    TEST_CHECK(world.physics.findNearest({136.0f, 28.0f}, 8.0f) == item);
+}
+
+} // namespace
+
+int main() {
+    test::run("不受重力的 SOLID 物体转为静态", testStaticPromotion);
+    test::run("赋予速度后转回动态，停下后再转为静态", testDemoteOnVelocity);
+    test::run("启用重力、受力、禁用或改为触发器后转回动态", testDemoteOnGravityForceOrDisable);
+    test::run("直接移动的静态物体转回动态并保持动态", testDemoteOnDirectMove);
+    test::run("SOLID 物体之间的碰撞对", testSolidPairs);
+    test::run("休眠中的物体转为静态", testPromoteSleepingBody);
+    test::run("两个休眠物体之间的碰撞对", testSleepingPairs);
+    test::run("矩形查询", testOverlapBox);
+    test::run("圆形查询", testQueryRadius);
+    test::run("射线检测", testRaycast);
+    test::run("最近对象查询", testFindNearest);
+    test::run("查询不唤醒休眠物体", testQueryDoesNotWake);
+    test::run("物体被推开后的查询", testQueryAfterPush);
+    return test::finish("PHYSICSENGINETEST");
+}
@@ -0,0 +1,110 @@
+/**
+ * @file SceneArenaTest.cpp
+ * @brief 场景内存区的回归测试：在按钮回调中替换场景时，新场景的对象不能分配到旧场景的内存区
+ *
+ * 游戏中的场景切换都发生在按钮回调里（SceneManager::handleInput 的 ArenaScope 中），
+ * 新场景在那里构造；若其 UI 根面板分配在旧场景的内存区，替换场景销毁旧内存区后根面板即成为悬空指针。
+ */
+#include "TestHarness.hpp"
+#include "TestContext.hpp"
+#include "../src/engine/scene/Scene.hpp"
+#include "../src/engine/scene/SceneManager.hpp"
+#include "../src/engine/UI/UIButton.hpp"
+#include "../src/engine/UI/UIManager.hpp"
+#include "../src/engine/utils/MemoryArena.hpp"
+
+#include <memory>
+
+namespace {
+
+const char* const BUTTON_SPRITE = "assets/textures/UI/buttons/Start1.png";
+
+/// @brief 只有一个按钮的场景，点击按钮时替换为下一代场景（与标题、菜单场景的按钮相同）
+class ButtonScene final : public engine::scene::Scene {
+private:
+    engine::ui::UIButton* m_button = nullptr;
+    bool m_isClickPending = false;
+    int m_generation = 0;
+
+public:
+    ButtonScene(engine::core::Context& context, engine::scene::SceneManager& sceneManager, int generation)
+        : Scene("ButtonScene", context, sceneManager), m_generation(generation) {}
+
+    void init() override {
+        if (m_isInitialized) return;
+        auto button = std::make_unique<engine::ui::UIButton>(m_context, BUTTON_SPRITE, BUTTON_SPRITE, BUTTON_SPRITE,
+            glm::vec2(0.0f, 0.0f), glm::vec2(32.0f, 32.0f), [this] { onClick(); });
+        m_button = button.get();
+        m_UIManager->addElement(std::move(button));
+        Scene::init();
+    }
+
+    void handleInput() override {
+        // 模拟一次点击：与真实点击一样，回调在 SceneManager::handleInput 设置的 ArenaScope 中执行
+        if (m_isClickPending) {
+            m_isClickPending = false;
+            m_button->clicked();
+            return;
+        }
+        Scene::handleInput();
+    }
+
+    void click() { m_isClickPending = true; }
+    int getGeneration() const { return m_generation; }
+
+private:
+    void onClick() {
+        m_sceneManager.requestReplaceScene(std::make_unique<ButtonScene>(m_context, m_sceneManager, m_generation + 1));
+    }
+};
+
+/// @brief 在其他内存区的作用域中构造场景：UI 根面板仍分配在场景自己的内存区
+void testConstructInOtherScope(engine::core::Context& context) {
+    engine::scene::SceneManager sceneManager(context);
+    engine::utils::MemoryArena otherArena;
+    std::unique_ptr<ButtonScene> scene;
+    {
+        engine::utils::ArenaScope scope(&otherArena);
+        scene = std::make_unique<ButtonScene>(context, sceneManager, 0);
+    }
+    TEST_CHECK(otherArena.getLiveCount() == 0);
+    TEST_CHECK(scene->getArena().getLiveCount() > 0);
+    scene.reset();
+}
+
+/// @brief 在按钮回调中连续替换场景，旧场景的内存区不会收到新场景的分配
+void testReplaceFromButton(engine::core::Context& context, bool isArenaEnabled) {
+    engine::scene::SceneManager sceneManager(context);
+    sceneManager.setSceneArenaEnabled(isArenaEnabled);
+    sceneManager.requestPushScene(std::make_unique<ButtonScene>(context, sceneManager, 0));
+    sceneManager.update(0.0f);
+
+    for (int generation = 0; generation < 3; ++generation) {
+        auto* scene = dynamic_cast<ButtonScene*>(sceneManager.getCurrentScene());
+        TEST_CHECK(scene && scene->getGeneration() == generation);
+        if (!scene) return;
+        const size_t liveCount = scene->getArena().getLiveCount();
+        scene->click();
+        sceneManager.handleInput();     // 回调中构造下一代场景
+        TEST_CHECK(scene->getArena().getLiveCount() == liveCount);
+        sceneManager.update(0.0f);      // 替换场景：旧场景连同其内存区一起销毁
+    }
+
+    // 新场景的 UI 仍可正常处理输入和渲染（根面板若已随旧内存区释放，这里会访问悬空指针）
+    auto* scene = dynamic_cast<ButtonScene*>(sceneManager.getCurrentScene());
+    TEST_CHECK(scene && scene->getGeneration() == 3);
+    TEST_CHECK(scene && scene->isInitialized());
+    sceneManager.handleInput();
+    sceneManager.render();
+    sceneManager.close();
+}
+
+} // namespace
+
+int main() {
+    test::TestContext context;
+    test::run("在其他内存区的作用域中构造场景", [&] { testConstructInOtherScope(context.get()); });
+    test::run("按钮回调中替换场景（启用内存池）", [&] { testReplaceFromButton(context.get(), true); });
+    test::run("按钮回调中替换场景（未启用内存池）", [&] { testReplaceFromButton(context.get(), false); });
+    return test::finish("SCENEARENATEST");
+}
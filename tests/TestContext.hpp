@@ -0,0 +1,92 @@
+/**
+ * @file TestContext.hpp
+ * @brief 需要完整 Context 的测试使用的环境：与无头模式相同，离屏视频驱动 + 隐藏窗口 + 软件渲染器
+ *
+ * 按 Game::init 的顺序创建各模块，析构时按 Game::close 的顺序释放，不需要显示器和 GPU。
+ */
+#pragma once
+#include "../src/engine/core/Config.hpp"
+#include "../src/engine/core/Context.hpp"
+#include "../src/engine/core/GameState.hpp"
+#include "../src/engine/core/JobSystem.hpp"
+#include "../src/engine/core/Time.hpp"
+#include "../src/engine/input/InputManager.hpp"
+#include "../src/engine/physics/PhysicsEngine.hpp"
+#include "../src/engine/render/Camera.hpp"
+#include "../src/engine/render/Renderer.hpp"
+#include "../src/engine/render/TextRenderer.hpp"
+#include "../src/engine/resource/ResourceManager.hpp"
+
+#include <SDL3/SDL.h>
+#include <spdlog/spdlog.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace test {
+
+class TestContext final {
+private:
+    SDL_Window* m_window = nullptr;
+    SDL_Renderer* m_SDLRenderer = nullptr;
+    std::unique_ptr<engine::core::Config> m_config;
+    std::unique_ptr<engine::core::JobSystem> m_jobSystem;
+    std::unique_ptr<engine::resource::ResourceManager> m_resourceManager;
+    std::unique_ptr<engine::render::Renderer> m_renderer;
+    std::unique_ptr<engine::render::Camera> m_camera;
+    std::unique_ptr<engine::render::TextRenderer> m_textRenderer;
+    std::unique_ptr<engine::input::InputManager> m_inputManager;
+    std::unique_ptr<engine::physics::PhysicsEngine> m_physicsEngine;
+    std::unique_ptr<engine::core::GameState> m_gameState;
+    std::unique_ptr<engine::core::Time> m_time;
+    std::unique_ptr<engine::core::Context> m_context;
+
+public:
+    /// @brief 创建所有模块，失败时抛出 std::runtime_error
+    TestContext() {
+        SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "offscreen");
+        if (!SDL_Init(SDL_INIT_VIDEO)) {
+            throw std::runtime_error("SDL 初始化失败: " + std::string(SDL_GetError()));
+        }
+        m_window = SDL_CreateWindow("test", 640, 360, SDL_WINDOW_HIDDEN);
+        m_SDLRenderer = m_window ? SDL_CreateRenderer(m_window, SDL_SOFTWARE_RENDERER) : nullptr;
+        if (!m_SDLRenderer) {
+            throw std::runtime_error("SDL 窗口或渲染器创建失败: " + std::string(SDL_GetError()));
+        }
+        m_config = std::make_unique<engine::core::Config>("assets/config.json");
+        m_jobSystem = std::make_unique<engine::core::JobSystem>(1);
+        m_resourceManager = std::make_unique<engine::resource::ResourceManager>(m_SDLRenderer, *m_jobSystem);
+        m_renderer = std::make_unique<engine::render::Renderer>(m_SDLRenderer, m_resourceManager.get());
+        m_camera = std::make_unique<engine::render::Camera>(glm::vec2(320.0f, 180.0f));
+        m_textRenderer = std::make_unique<engine::render::TextRenderer>(m_SDLRenderer, m_resourceManager.get());
+        m_inputManager = std::make_unique<engine::input::InputManager>(m_SDLRenderer, m_config.get());
+        m_physicsEngine = std::make_unique<engine::physics::PhysicsEngine>();
+        m_gameState = std::make_unique<engine::core::GameState>(m_window, m_SDLRenderer);
+        m_time = std::make_unique<engine::core::Time>();
+        m_context = std::make_unique<engine::core::Context>(*m_inputManager, *m_renderer, *m_camera, *m_textRenderer,
+            *m_resourceManager, *m_physicsEngine, *m_gameState, *m_time, *m_jobSystem);
+    }
+
+    ~TestContext() {
+        m_context.reset();
+        m_textRenderer.reset();
+        m_resourceManager.reset();
+        m_jobSystem.reset();        // 资源管理器等使用任务系统的模块释放后再停止工作线程
+        if (m_SDLRenderer) SDL_DestroyRenderer(m_SDLRenderer);
+        if (m_window) SDL_DestroyWindow(m_window);
+        SDL_Quit();
+    }
+
+    /// @name 禁止拷贝和移动
+    /// @{
+    TestContext(const TestContext&) = delete;
+    TestContext& operator=(const TestContext&) = delete;
+    TestContext(TestContext&&) = delete;
+    TestContext& operator=(TestContext&&) = delete;
+    /// @}
+
+    engine::core::Context& get() { return *m_context; }     ///< @brief 获取上下文
+};
+
+} // namespace test
@@ -0,0 +1,74 @@
+/**
+ * @file TestHarness.hpp
+ * @brief 单元测试的公共工具：检查宏、用例运行与结果汇总
+ *
+ * 每个测试文件是一个独立的可执行文件，由 ctest 在项目根目录运行；有失败的检查时返回非零。
+ * 用法：
+ *     int main() {
+ *         test::run("用例名", [] { TEST_CHECK(1 + 1 == 2); });
+ *         return test::finish("XXXTEST");
+ *     }
+ */
+#pragma once
+#include <spdlog/spdlog.h>
+
+#include <atomic>
+#include <exception>
+
+namespace test {
+
+/// @brief 失败的检查数（包括用例中未捕获的异常），检查可能在工作线程中进行
+inline std::atomic<int>& failureCount() {
+    static std::atomic<int> count = 0;
+    return count;
+}
+
+/// @brief 记录一次检查，失败时输出表达式与位置（由 TEST_CHECK 调用）
+inline void check(bool condition, const char* expression, const char* file, int line) {
+    if (condition) return;
+    ++failureCount();
+    spdlog::error("TEST::检查失败: {} ({}:{})", expression, file, line);
+}
+
+/**
+ * @brief 运行一个测试用例，用例中未捕获的异常记为失败
+ * @param name 用例名
+ * @param fn 用例
+ */
+template <typename Fn>
+void run(const char* name, Fn&& fn) {
+    const int failuresBefore = failureCount();
+    try {
+        fn();
+    } catch (const std::exception& e) {
+        ++failureCount();
+        spdlog::error("TEST::用例抛出异常: {}", e.what());
+    } catch (...) {
+        ++failureCount();
+        spdlog::error("TEST::用例抛出未知异常");
+    }
+    if (failureCount() == failuresBefore) {
+        spdlog::info("TEST::通过: {}", name);
+    } else {
+        spdlog::error("TEST::失败: {}", name);
+    }
+}
+
+/**
+ * @brief 输出汇总结果
+ * @param suite 测试名（日志前缀）
+ * @return main 的返回值：全部通过为 0，否则为 1
+ */
+inline int finish(const char* suite) {
+    if (failureCount() == 0) {
+        spdlog::info("{}::全部通过", suite);
+        return 0;
+    }
+    spdlog::error("{}::{} 项检查失败", suite, failureCount().load());
+    return 1;
+}
+
+} // namespace test
+
+/// @brief 检查表达式为真，失败时记录但继续执行
+#define TEST_CHECK(expression) ::test::check(static_cast<bool>(expression), #expression, __FILE__, __LINE__)
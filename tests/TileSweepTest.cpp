@@ -0,0 +1,180 @@
+/**
+ * @file TileSweepTest.cpp
+ * @brief 瓦片碰撞解算 (TileSweep) 的单元测试：高速穿墙、恰好落在瓦片边界、斜向拐角、分段接缝处的斜坡
+ *
+ * 只依赖碰撞类型网格，不需要 SDL。瓦片尺寸均为 16 像素。
+ */
+#include "TestHarness.hpp"
+#include "../src/engine/physics/BodyStore.hpp"
+#include "../src/engine/physics/TileSweep.hpp"
+
+#include <glm/geometric.hpp>
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+using engine::component::TileType;
+using engine::physics::TileGridView;
+using engine::physics::TileMoveState;
+
+namespace {
+
+constexpr float TILE = 16.0f;
+
+/// @brief 测试用的碰撞类型网格（与 TileLayerComponent 相同：四周各多出一圈 EMPTY 边框）
+struct Grid {
+    glm::ivec2 mapSize;
+    std::vector<std::uint8_t> cells;
+
+    explicit Grid(glm::ivec2 size)
+        : mapSize(size), cells(static_cast<size_t>(size.x + 2) * (size.y + 2), static_cast<std::uint8_t>(TileType::EMPTY)) {}
+
+    void set(int x, int y, TileType type) {
+        cells[static_cast<size_t>(y + 1) * (mapSize.x + 2) + (x + 1)] = static_cast<std::uint8_t>(type);
+    }
+    void fillRow(int y, TileType type) {
+        for (int x = 0; x < mapSize.x; ++x) set(x, y, type);
+    }
+    void fillColumn(int x, TileType type) {
+        for (int y = 0; y < mapSize.y; ++y) set(x, y, type);
+    }
+    TileGridView view() const { return {cells.data(), mapSize.x + 2, mapSize, glm::vec2(TILE)}; }
+};
+
+/// @brief 以速度 velocity 移动 deltaTime 秒（swept 为 false 时只做一次离散检测），返回包围盒的新位置
+glm::vec2 move(const Grid& grid, glm::vec2 pos, glm::vec2 size, glm::vec2 velocity, float deltaTime, TileMoveState& state,
+               bool swept = true) {
+    const TileGridView layers[] = {grid.view()};
+    state.velocity = velocity;
+    const glm::vec2 ds = velocity * deltaTime;
+    const int steps = swept ? engine::physics::getTileSweepSteps(layers, ds) : 1;
+    return engine::physics::sweepTileMove(layers, pos, size, ds, steps, state);
+}
+
+bool near(glm::vec2 a, glm::vec2 b) { return glm::distance(a, b) < 1e-3f; }
+
+void testFastBodyThinWall() {
+    Grid grid({20, 4});
+    grid.fillColumn(10, TileType::SOLID);      // 一个瓦片厚的墙：x 为 160~176
+
+    // 700 像素/秒、步长 0.13 秒（位移 91 像素，约 5.7 个瓦片）
+    TileMoveState state;
+    auto pos = move(grid, {100.0f, 20.0f}, {8.0f, 8.0f}, {700.0f, 0.0f}, 0.13f, state);
+    TEST_CHECK(near(pos, {152.0f, 20.0f}));    // 贴着墙的左侧停下
+    TEST_CHECK(state.velocity.x == 0.0f);
+    TEST_CHECK(state.contacts & engine::physics::CONTACT_RIGHT);
+
+    // 离散检测只检查终点，会直接穿过
+    TileMoveState discrete;
+    pos = move(grid, {100.0f, 20.0f}, {8.0f, 8.0f}, {700.0f, 0.0f}, 0.13f, discrete, false);
+    TEST_CHECK(pos.x > 176.0f);
+
+    // 向左同样停在墙的右侧
+    TileMoveState left;
+    pos = move(grid, {240.0f, 20.0f}, {8.0f, 8.0f}, {-700.0f, 0.0f}, 0.13f, left);
+    TEST_CHECK(near(pos, {176.0f, 20.0f}));
+    TEST_CHECK(left.contacts & engine::physics::CONTACT_LEFT);
+
+    // 高速下落经过单向平台时落在平台上，向上时穿过
+    Grid platform({4, 10});
+    platform.fillRow(4, TileType::UNISOLID);   // y 为 64~80
+    TileMoveState fall;
+    pos = move(platform, {20.0f, 0.0f}, {8.0f, 8.0f}, {0.0f, 700.0f}, 0.15f, fall);
+    TEST_CHECK(near(pos, {20.0f, 56.0f}));
+    TEST_CHECK(fall.velocity.y == 0.0f && (fall.contacts & engine::physics::CONTACT_BELOW));
+    TileMoveState jump;
+    pos = move(platform, {20.0f, 120.0f}, {8.0f, 8.0f}, {0.0f, -700.0f}, 0.15f, jump);
+    TEST_CHECK(near(pos, {20.0f, 15.0f}));
+    TEST_CHECK(jump.contacts == 0);
+}
+
+void testExactBoundary() {
+    Grid grid({20, 6});
+    grid.fillRow(4, TileType::SOLID);          // 地面：y 为 64~80
+    grid.fillColumn(10, TileType::SOLID);      // 墙：x 为 160~176
+
+    // 下边缘恰好移动到地面顶部：算作着地
+    TileMoveState land;
+    auto pos = move(grid, {20.0f, 32.0f}, {16.0f, 16.0f}, {0.0f, 160.0f}, 0.1f, land);
+    TEST_CHECK(near(pos, {20.0f, 48.0f}));
+    TEST_CHECK(land.velocity.y == 0.0f && (land.contacts & engine::physics::CONTACT_BELOW));
+
+    // 分段的接缝恰好落在墙的左边缘（两段各 16 像素，右边缘依次为 144、160）
+    TileMoveState wall;
+    pos = move(grid, {112.0f, 20.0f}, {16.0f, 16.0f}, {320.0f, 0.0f}, 0.1f, wall);
+    TEST_CHECK(near(pos, {144.0f, 20.0f}));
+    TEST_CHECK(wall.contacts & engine::physics::CONTACT_RIGHT);
+
+    // 右边缘恰好贴着墙时下落：不会被墙挡住，落到地面上
+    TileMoveState slide;
+    pos = move(grid, {144.0f, 0.0f}, {16.0f, 16.0f}, {0.0f, 600.0f}, 0.1f, slide);
+    TEST_CHECK(near(pos, {144.0f, 48.0f}));
+    TEST_CHECK(slide.contacts == engine::physics::CONTACT_BELOW);
+
+    // 站在地面上（下边缘恰好等于地面顶部）时受重力：保持在原处
+    TileMoveState rest;
+    pos = move(grid, {20.0f, 48.0f}, {16.0f, 16.0f}, {0.0f, 980.0f / 60.0f}, 1.0f / 60.0f, rest);
+    TEST_CHECK(near(pos, {20.0f, 48.0f}));
+    TEST_CHECK(rest.contacts & engine::physics::CONTACT_BELOW);
+}
+
+void testDiagonalCorner() {
+    Grid grid({8, 8});
+    grid.set(2, 2, TileType::SOLID);           // 单个瓦片：x、y 均为 32~48
+
+    // 斜向移动时两个方向的角点单独都没有碰到瓦片，但终点与拐角重叠：必须在某个方向被挡住
+    TileMoveState state;
+    auto pos = move(grid, {20.0f, 20.0f}, {8.0f, 8.0f}, {100.0f, 100.0f}, 0.1f, state);
+    const bool overlapsTile = pos.x + 8.0f > 32.0f && pos.x < 48.0f && pos.y + 8.0f > 32.0f && pos.y < 48.0f;
+    TEST_CHECK(!overlapsTile);
+    TEST_CHECK(near(pos, {30.0f, 24.0f}));
+    TEST_CHECK(state.contacts == engine::physics::CONTACT_BELOW);
+    TEST_CHECK(state.velocity.x == 100.0f && state.velocity.y == 0.0f);
+
+    // 高速斜向穿过拐角（多段）时同样停在拐角外
+    TileMoveState fast;
+    pos = move(grid, {4.0f, 4.0f}, {8.0f, 8.0f}, {600.0f, 600.0f}, 0.1f, fast);
+    TEST_CHECK(!(pos.x + 8.0f > 32.0f && pos.x < 48.0f && pos.y + 8.0f > 32.0f && pos.y < 48.0f));
+}
+
+void testSlopeSeams() {
+    // 两个半坡拼成的斜坡（x 为 32~64，高度从 0 均匀升到 16），下方是一行实心地面
+    Grid grid({10, 6});
+    grid.fillRow(5, TileType::SOLID);          // 地面：y 为 80~96
+    grid.set(2, 4, TileType::SLOPE_0_2);
+    grid.set(3, 4, TileType::SLOPE_2_1);
+    const glm::vec2 size = {8.0f, 8.0f};
+    auto groundY = [](float rightEdge) { return 80.0f - 8.0f - glm::clamp(rightEdge - 32.0f, 0.0f, 32.0f) * 0.5f; };
+
+    // 分段接缝落在两个斜坡的交界处（每段 16 像素，右边缘依次为 48、64）
+    TileMoveState seam;
+    auto pos = move(grid, {24.0f, 72.0f}, size, {320.0f, 10.0f}, 0.1f, seam);
+    TEST_CHECK(near(pos, {56.0f, groundY(64.0f)}));
+    TEST_CHECK(seam.velocity.x == 320.0f);     // 沿斜坡上行，没有被当作墙
+    TEST_CHECK(seam.contacts == engine::physics::CONTACT_BELOW);
+
+    // 分段接缝落在斜坡中间，终点在第二个斜坡上
+    TileMoveState middle;
+    pos = move(grid, {16.0f, 72.0f}, size, {360.0f, 10.0f}, 0.1f, middle);
+    TEST_CHECK(near(pos, {52.0f, groundY(60.0f)}));
+    TEST_CHECK(middle.velocity.x == 360.0f);
+
+    // 逐帧行走与一步走完的结果相同
+    TileMoveState walk;
+    glm::vec2 walkPos = {24.0f, 72.0f};
+    for (int i = 0; i < 16; ++i) {
+        walkPos = move(grid, walkPos, size, {120.0f, 10.0f}, 1.0f / 60.0f, walk);
+    }
+    TEST_CHECK(near(walkPos, {56.0f, groundY(64.0f)}));
+}
+
+} // namespace
+
+int main() {
+    test::run("高速物体不会穿过一个瓦片厚的墙", testFastBodyThinWall);
+    test::run("恰好移动到瓦片边界", testExactBoundary);
+    test::run("斜向移动经过拐角", testDiagonalCorner);
+    test::run("分段接缝处的斜坡", testSlopeSeams);
+    return test::finish("TILESWEEPTEST");
+}
@@ -0,0 +1,246 @@
+/**
+ * @file AtlasPacker.cpp
+ * @brief 纹理图集打包工具（独立的构建目标，不链接进游戏）
+ *
+ * 把若干目录下的小图片打包成一张或几张图集页，并生成清单文件：
+ *     {
+ *         "version": 1,
+ *         "pages": ["atlas_0.png", ...],                     // 相对于清单文件所在目录
+ *         "entries": {
+ *             "assets/textures/Props/crate.png": {"page": 0, "x": 1, "y": 1, "w": 32, "h": 32},
+ *             ...
+ *         }
+ *     }
+ * 清单中的图片路径相对于运行目录（与游戏中使用的纹理ID一致），
+ * 游戏运行时由 TextureManager::loadAtlasManifest 读取，原有的纹理ID与源矩形无需任何修改。
+ *
+ * 用法（在项目根目录运行）：
+ *     AtlasPacker [--size 页面边长] [--out 输出目录] [图片目录...]
+ * 未指定图片目录时，默认打包 assets/textures 下的 Props、Items、Actors、FX、UI 目录。
+ */
+#include <SDL3/SDL.h>
+#include <SDL3_image/SDL_image.h>
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr int DEFAULT_PAGE_SIZE = 1024;     ///< @brief 默认图集页边长（像素）
+constexpr int EXTRUDE = 1;                  ///< @brief 每张图片四周向外复制的边缘像素数（防止采样到相邻图片）
+const char* const DEFAULT_OUTPUT_DIR = "assets/textures/atlas";
+const char* const DEFAULT_INPUT_DIRS[] = {
+    "assets/textures/Props",
+    "assets/textures/Items",
+    "assets/textures/Actors",
+    "assets/textures/FX",
+    "assets/textures/UI",
+};
+
+struct SurfaceDeleter {
+    void operator()(SDL_Surface* surface) const { SDL_DestroySurface(surface); }
+};
+using SurfacePtr = std::unique_ptr<SDL_Surface, SurfaceDeleter>;
+
+/// @brief 待打包的图片
+struct PackImage {
+    std::string key;        ///< @brief 图片路径（清单中的键）
+    SurfacePtr surface;     ///< @brief RGBA32 格式的图片数据
+    int page = -1;          ///< @brief 所在图集页，-1 表示放不下
+    int x = 0;              ///< @brief 在图集页中的位置（不含外扩边缘）
+    int y = 0;
+};
+
+/// @brief 一张图集页的货架 (shelf) 排布状态
+struct PageCursor {
+    int shelfX = 0;         ///< @brief 当前货架已使用的宽度
+    int shelfY = 0;         ///< @brief 当前货架的顶部
+    int shelfHeight = 0;    ///< @brief 当前货架的高度
+};
+
+/// @brief 把路径转为相对于运行目录、使用 '/' 分隔的形式（与游戏中规范化纹理ID的方式一致）
+std::string makeKey(const std::filesystem::path& path) {
+    std::error_code ec;
+    auto relative = std::filesystem::relative(path, ec);
+    return (ec || relative.empty() ? path : relative).lexically_normal().generic_string();
+}
+
+/// @brief 递归收集目录中的 PNG 图片，并转换为 RGBA32 格式
+void collectImages(const std::filesystem::path& dir, std::vector<PackImage>& images) {
+    if (!std::filesystem::is_directory(dir)) {
+        spdlog::warn("ATLASPACKER::collectImages::目录不存在, 跳过: {}", dir.string());
+        return;
+    }
+    std::vector<std::filesystem::path> files;
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(dir)) {
+        if (entry.is_regular_file() && entry.path().extension() == ".png") {
+            files.push_back(entry.path());
+        }
+    }
+    std::sort(files.begin(), files.end());      // 保证输出稳定
+    for (const auto& file : files) {
+        SurfacePtr loaded(IMG_Load(file.string().c_str()));
+        if (!loaded) {
+            spdlog::error("ATLASPACKER::collectImages::加载图片失败: {} : {}", file.string(), SDL_GetError());
+            continue;
+        }
+        SurfacePtr converted(SDL_ConvertSurface(loaded.get(), SDL_PIXELFORMAT_RGBA32));
+        if (!converted) {
+            spdlog::error("ATLASPACKER::collectImages::转换图片格式失败: {} : {}", file.string(), SDL_GetError());
+            continue;
+        }
+        SDL_SetSurfaceBlendMode(converted.get(), SDL_BLENDMODE_NONE);   // 直接复制像素（包括透明度）
+        images.push_back({makeKey(file), std::move(converted)});
+    }
+}
+
+/**
+ * @brief 使用货架算法为所有图片分配位置（按高度从高到低依次摆放）
+ * @return 使用的图集页数量
+ */
+int packImages(std::vector<PackImage>& images, int pageSize) {
+    std::vector<PackImage*> order;
+    for (auto& image : images) order.push_back(&image);
+    std::stable_sort(order.begin(), order.end(), [](const PackImage* a, const PackImage* b) {
+        if (a->surface->h != b->surface->h) return a->surface->h > b->surface->h;
+        return a->surface->w > b->surface->w;
+    });
+
+    std::vector<PageCursor> pages;
+    for (auto* image : order) {
+        const int cellWidth = image->surface->w + EXTRUDE * 2;
+        const int cellHeight = image->surface->h + EXTRUDE * 2;
+        if (cellWidth > pageSize || cellHeight > pageSize) {
+            spdlog::warn("ATLASPACKER::packImages::图片 {} ({}x{}) 超出图集页尺寸, 将保持单独加载",
+                         image->key, image->surface->w, image->surface->h);
+            continue;
+        }
+        if (pages.empty()) pages.emplace_back();
+        auto* cursor = &pages.back();
+        if (cursor->shelfX + cellWidth > pageSize) {            // 当前货架已满，开启新货架
+            cursor->shelfY += cursor->shelfHeight;
+            cursor->shelfX = 0;
+            cursor->shelfHeight = 0;
+        }
+        if (cursor->shelfY + cellHeight > pageSize) {           // 当前页已满，开启新页
+            pages.emplace_back();
+            cursor = &pages.back();
+        }
+        image->page = static_cast<int>(pages.size()) - 1;
+        image->x = cursor->shelfX + EXTRUDE;
+        image->y = cursor->shelfY + EXTRUDE;
+        cursor->shelfX += cellWidth;
+        cursor->shelfHeight = std::max(cursor->shelfHeight, cellHeight);
+    }
+    return static_cast<int>(pages.size());
+}
+
+/// @brief 把图片复制到图集页，并把四条边向外复制 EXTRUDE 个像素
+void blitWithExtrude(SDL_Surface* src, SDL_Surface* page, int x, int y) {
+    const int w = src->w;
+    const int h = src->h;
+    auto blit = [&](SDL_Rect from, int toX, int toY) {
+        SDL_Rect to = {toX, toY, from.w, from.h};
+        SDL_BlitSurface(src, &from, page, &to);
+    };
+    blit({0, 0, w, h}, x, y);
+    for (int e = 1; e <= EXTRUDE; ++e) {
+        blit({0, 0, 1, h}, x - e, y);               // 左
+        blit({w - 1, 0, 1, h}, x + w - 1 + e, y);   // 右
+        blit({0, 0, w, 1}, x, y - e);               // 上
+        blit({0, h - 1, w, 1}, x, y + h - 1 + e);   // 下
+        for (int f = 1; f <= EXTRUDE; ++f) {        // 四角
+            blit({0, 0, 1, 1}, x - e, y - f);
+            blit({w - 1, 0, 1, 1}, x + w - 1 + e, y - f);
+            blit({0, h - 1, 1, 1}, x - e, y + h - 1 + f);
+            blit({w - 1, h - 1, 1, 1}, x + w - 1 + e, y + h - 1 + f);
+        }
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int pageSize = DEFAULT_PAGE_SIZE;
+    std::filesystem::path outputDir = DEFAULT_OUTPUT_DIR;
+    std::vector<std::filesystem::path> inputDirs;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--size" && i + 1 < argc) {
+            pageSize = std::max(64, std::atoi(argv[++i]));
+        } else if (arg == "--out" && i + 1 < argc) {
+            outputDir = argv[++i];
+        } else {
+            inputDirs.emplace_back(arg);
+        }
+    }
+    if (inputDirs.empty()) {
+        inputDirs.assign(std::begin(DEFAULT_INPUT_DIRS), std::end(DEFAULT_INPUT_DIRS));
+    }
+
+    // 1. 收集图片
+    std::vector<PackImage> images;
+    for (const auto& dir : inputDirs) {
+        collectImages(dir, images);
+    }
+    if (images.empty()) {
+        spdlog::error("ATLASPACKER::没有找到可打包的图片");
+        return 1;
+    }
+
+    // 2. 排布
+    const int pageCount = packImages(images, pageSize);
+
+    // 3. 生成图集页
+    std::error_code ec;
+    std::filesystem::create_directories(outputDir, ec);
+    nlohmann::ordered_json manifest;
+    manifest["version"] = 1;
+    manifest["pages"] = nlohmann::ordered_json::array();
+    for (int page = 0; page < pageCount; ++page) {
+        SurfacePtr pageSurface(SDL_CreateSurface(pageSize, pageSize, SDL_PIXELFORMAT_RGBA32));   // 新建的表面像素全为0（全透明）
+        if (!pageSurface) {
+            spdlog::error("ATLASPACKER::创建图集页失败: {}", SDL_GetError());
+            return 1;
+        }
+        for (const auto& image : images) {
+            if (image.page == page) blitWithExtrude(image.surface.get(), pageSurface.get(), image.x, image.y);
+        }
+        const std::string pageName = "atlas_" + std::to_string(page) + ".png";
+        if (!IMG_SavePNG(pageSurface.get(), (outputDir / pageName).string().c_str())) {
+            spdlog::error("ATLASPACKER::保存图集页失败: {} : {}", pageName, SDL_GetError());
+            return 1;
+        }
+        manifest["pages"].push_back(pageName);
+    }
+
+    // 4. 生成清单（按路径排序，便于比较版本差异）
+    std::sort(images.begin(), images.end(), [](const PackImage& a, const PackImage& b) { return a.key < b.key; });
+    manifest["entries"] = nlohmann::ordered_json::object();
+    int packedCount = 0;
+    for (const auto& image : images) {
+        if (image.page < 0) continue;
+        manifest["entries"][image.key] = {
+            {"page", image.page}, {"x", image.x}, {"y", image.y}, {"w", image.surface->w}, {"h", image.surface->h}
+        };
+        ++packedCount;
+    }
+    const auto manifestPath = outputDir / "atlas.json";
+    std::ofstream file(manifestPath);
+    if (!file.is_open()) {
+        spdlog::error("ATLASPACKER::无法写入清单文件: {}", manifestPath.string());
+        return 1;
+    }
+    file << manifest.dump(4);
+
+    spdlog::info("ATLASPACKER::打包完成: {} 张图片 -> {} 页 ({}x{}), 清单: {}",
+                 packedCount, pageCount, pageSize, pageSize, manifestPath.string());
+    return 0;
+}
@@ -0,0 +1,74 @@
+/**
+ * @file LevelCooker.cpp
+ * @brief 关卡预处理工具（独立的构建目标，不链接进游戏）
+ *
+ * 把 Tiled 地图 (.tmj) 及其引用的图块集 (.tsj) 解析为 LevelData，并写成二进制的预处理关卡文件 (.lvlb)，
+ * 保存在地图文件旁边。游戏加载关卡时会优先内存映射读取该文件，跳过 JSON 解析；
+ * 地图或图块集修改后预处理文件自动失效（游戏回退为解析 .tmj），重新运行本工具即可。
+ *
+ * 用法（在项目根目录运行）：
+ *     LevelCooker [地图文件...]
+ * 未指定地图文件时，默认处理 assets/maps 下的所有 .tmj 文件。
+ */
+#include "../../src/engine/scene/CookedLevel.hpp"
+#include "../../src/engine/scene/LevelParser.hpp"
+
+#include <spdlog/spdlog.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace {
+
+const char* const DEFAULT_MAP_DIR = "assets/maps";
+
+/// @brief 收集目录中的所有 .tmj 地图文件（路径相对于运行目录）
+std::vector<std::string> collectMaps(const std::filesystem::path& dir) {
+    std::vector<std::string> maps;
+    if (!std::filesystem::is_directory(dir)) {
+        spdlog::error("LEVELCOOKER::collectMaps::目录不存在: {}", dir.string());
+        return maps;
+    }
+    for (const auto& entry : std::filesystem::directory_iterator(dir)) {
+        if (entry.is_regular_file() && entry.path().extension() == ".tmj") {
+            maps.push_back(entry.path().generic_string());
+        }
+    }
+    std::sort(maps.begin(), maps.end());
+    return maps;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::vector<std::string> maps(argv + 1, argv + argc);
+    if (maps.empty()) {
+        maps = collectMaps(DEFAULT_MAP_DIR);
+    }
+    if (maps.empty()) {
+        spdlog::error("LEVELCOOKER::没有找到需要处理的地图文件");
+        return 1;
+    }
+
+    int failedCount = 0;
+    for (const auto& mapPath : maps) {
+        engine::scene::LevelData level;
+        engine::scene::LevelParser parser;
+        if (!parser.parse(mapPath, level)) {
+            spdlog::error("LEVELCOOKER::解析地图失败: {}", mapPath);
+            ++failedCount;
+            continue;
+        }
+        const auto cookedPath = engine::scene::CookedLevel::getCookedPath(mapPath);
+        if (!engine::scene::CookedLevel::save(level, cookedPath)) {
+            ++failedCount;
+            continue;
+        }
+        std::error_code ec;
+        spdlog::info("LEVELCOOKER::{} -> {} ({} 字节, {} 个图层)",
+                     mapPath, cookedPath, std::filesystem::file_size(cookedPath, ec), level.layers.size());
+    }
+    return failedCount == 0 ? 0 : 1;
+}